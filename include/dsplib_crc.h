@@ -0,0 +1,80 @@
+/*
+ * Table-driven CRC-16-CCITT, CRC-32 and CRC-32C over byte buffers of any
+ * alignment and length (n >= 0):
+ *
+ *	CRC-16-CCITT:  poly 0x1021, MSB first, init 0xFFFF, no final xor
+ *	CRC-32:        poly 0x04C11DB7 reflected (0xEDB88320), init and
+ *	               final xor 0xFFFFFFFF
+ *	CRC-32C:       poly 0x1EDC6F41 reflected (0x82F63B78), as CRC-32
+ *
+ * Slice-by-N takes one word load and N table lookups per N bytes in
+ * place of a load, lookup and a dependent shift per byte. The 32-bit
+ * CRCs have slice-by-8 tables of 8 x 256 entries (8 KB); the slice-by-4
+ * form uses their first 4 x 256. CRC-16 is slice-by-4, 4 x 256 (2 KB).
+ * Table k holds the CRC of byte i followed by k zero bytes.
+ *
+ * The const tables generated by crccgen.c are in flash. On parts where
+ * flash wait states dominate the lookups, mips_crc32_table() and
+ * mips_crc16_table() build the same tables in RAM for any polynomial,
+ * which can then be passed to the _update functions.
+ *
+ * The _update functions carry a CRC across calls, with neither the
+ * init value nor the final xor, so a buffer may be fed in pieces:
+ *
+ *	crc = 0xFFFFFFFF;
+ *	crc = mips_crc32_update8(crc, a, na, mips_crc32_tab);
+ *	crc = mips_crc32_update8(crc, b, nb, mips_crc32_tab);
+ *	crc = ~crc;
+ */
+
+#ifndef _DSPLIB_CRC_H_
+#define _DSPLIB_CRC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "dsplib_def.h"
+
+#define CRC32_POLY		0xEDB88320	/* reflected 0x04C11DB7 */
+#define CRC32C_POLY		0x82F63B78	/* reflected 0x1EDC6F41 */
+#define CRC16_CCITT_POLY	0x1021
+
+extern const uint32 mips_crc32_tab[8 * 256];
+extern const uint32 mips_crc32c_tab[8 * 256];
+extern const uint16 mips_crc16_tab[4 * 256];
+
+/* reflected 32-bit CRC, table of 8 x 256 or 4 x 256 entries */
+uint32 mips_crc32_update8(uint32 crc, const void *data, int n, const uint32 *table);
+uint32 mips_crc32_update4(uint32 crc, const void *data, int n, const uint32 *table);
+
+/* MSB-first 16-bit CRC, table of 4 x 256 entries */
+uint16 mips_crc16_update4(uint16 crc, const void *data, int n, const uint16 *table);
+
+/* slices = 4 or 8 (32-bit), 4 (16-bit) tables of 256 for poly */
+void mips_crc32_table(uint32 *table, uint32 poly, int slices);
+void mips_crc16_table(uint16 *table, uint16 poly, int slices);
+
+
+static inline uint32 mips_crc32(const void *data, int n)
+{
+	return ~mips_crc32_update8(0xFFFFFFFF, data, n, mips_crc32_tab);
+}
+
+
+static inline uint32 mips_crc32c(const void *data, int n)
+{
+	return ~mips_crc32_update8(0xFFFFFFFF, data, n, mips_crc32c_tab);
+}
+
+
+static inline uint16 mips_crc16_ccitt(const void *data, int n)
+{
+	return mips_crc16_update4(0xFFFF, data, n, mips_crc16_tab);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
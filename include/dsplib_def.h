@@ -79,6 +79,12 @@ static inline int32 mul32(int32 a, int32 b)
 }
 
 
+static inline int32 mul32r(int32 a, int32 b)
+{
+	return ((int64)a * b + 0x40000000) >> 31;
+}
+
+
 #define MIN16 ((int16) 0x8000)
 #define MAX16 ((int16) 0x7FFF)
 
@@ -86,15 +86,54 @@ void mips_vec_mulc16(int16 *outdata, int16 *indata, int16 c, int N);
 
 void mips_vec_abs16(int16 *outdata, int16 *indata, int N);
 
+void mips_vec_shl16(int16 *outdata, int16 *indata, int N, int shift);
+void mips_vec_shr16(int16 *outdata, int16 *indata, int N, int shift);
+void mips_vec_clamp16(int16 *outdata, int16 *indata, int16 lo, int16 hi, int N);
+
 int16 mips_vec_dotp16(int16 *indata1, int16 *indata2, int N, int scale);
+
+/* complex dot product, no conjugate; real and imaginary parts are each
+   rounded, shifted and saturated as by mips_vec_dotp16 */
+void mips_cvec_dotp16(int16c *result, int16c *indata1, int16c *indata2, int N, int scale);
+
+/* outdata[m] = sum_n A[m*N + n] * x[n] for a row-major M x N matrix, any M, N >= 1 */
+void mips_mat_vec16(int16 *outdata, int16 *A, int16 *x, int M, int N, int scale);
 int16 mips_vec_sum_squares16(int16 *indata, int N, int scale);
 
+void mips_vec_window16(int16c *outdata, int16 *indata, const int16 *window, int N);
+
 void mips_fir16_setup(int16 *coeffs2x, int16 *coeffs, int K);
 void mips_fir16(int16 *outdata, int16 *indata, int16 *coeffs2x, int16 *delayline,
 				int N, int K, int scale);
 
 void __attribute__((deprecated)) mips_fft16_setup(int16c *twiddles, int log2N);
 void mips_fft16(int16c *dout, int16c *din, int16c *twiddles, int16c *scratch, int log2N);
+void mips_fft16_r4(int16c *dout, int16c *din, int16c *twiddles, int16c *scratch, int log2N);
+/* in-place DFT/N of data[], natural order in and out: it calls
+   mips_fft16_bitrev itself, so data must not be bit-reversed first */
+void mips_fft16_ip(int16c *data, int16c *twiddles, int log2N);
+void mips_fft16_bitrev(int16c *data, int log2N);
+void mips_fft16_batch(int16c *dout, int16c *din, int16c *twiddles, int16c *scratch,
+				int log2N, int M);
+
+
+#define DCT_II			2
+#define DCT_IV			4
+
+/*
+ * DCT-II, DCT-IV, MDCT and IMDCT through an N/2-point mips_fft16_r4/
+ * mips_fft32_r4 (twiddles for log2N - 1), N = 2^log2N >= 16. Outputs are
+ * scaled by 1/N (1/2N for the MDCT). scratch is 3N/2 entries.
+ */
+void mips_dct16_setup(int16c *dcttw, int log2N, int type);
+void mips_dct2_16(int16 *outdata, int16 *indata, int16c *twiddles, int16c *dcttw,
+				  int16c *scratch, int log2N);
+void mips_dct4_16(int16 *outdata, int16 *indata, int16c *twiddles, int16c *dcttw,
+				  int16c *scratch, int log2N);
+void mips_mdct16(int16 *outdata, int16 *indata, int16c *twiddles, int16c *dcttw,
+				 int16c *scratch, int log2N);
+void mips_imdct16(int16 *outdata, int16 *indata, int16c *twiddles, int16c *dcttw,
+				  int16c *scratch, int log2N);
 
 void mips_iir16_setup(int16 *coeffs, biquad16 *bq, int B);
 int16 mips_iir16(int16 in, int16 *coeffs, int16 *delayline, int B, int scale);
@@ -102,6 +141,41 @@ int16 mips_iir16(int16 in, int16 *coeffs, int16 *delayline, int B, int scale);
 int16 mips_lms16(int16 in, int16 ref, int16 *coeffs, int16 *delayline,
 				 int16 *error, int16 K, int mu);
 
+void mips_goertzel16_setup(int16c *coeffs, int *bins, int B, int N);
+void mips_goertzel16(int32 *state, int16 *indata, int16c *coeffs, int B, int N);
+void mips_goertzel16_result(int16c *outdata, int32 *state, int16c *coeffs, int B, int scale);
+
+void mips_sdft16_setup(int16c *coeffs, int *bins, int B, int N, int16 r);
+void mips_sdft16(int16c *X, int16 *indata, int16c *coeffs, int16 *delayline,
+				 int B, int N, int M, int scale);
+
+
+#define STFT_MAG		0
+#define STFT_POWER		1
+
+/*
+ * Streaming STFT over mips_fft16. Samples go in through mips_stft16_push()
+ * (single producer, e.g. an ISR) and frames of N/2+1 Q15 magnitudes or
+ * powers come out of mips_stft16_frame() every hop samples.
+ */
+typedef struct
+{
+	int log2N;
+	int hop;				/* 1 .. N */
+	int mode;				/* STFT_MAG or STFT_POWER */
+	const int16 *window;			/* N, Q15, e.g. from winc.h (N = 64 .. 1024) */
+	int16c *twiddles;			/* as for mips_fft16 */
+	int16 *ring;				/* 2N */
+	int16c *buf;				/* 3N */
+	volatile uint32 wr;			/* samples pushed */
+	volatile uint32 rd;			/* start of the next frame */
+} stft16;
+
+void mips_stft16_init(stft16 *st, int16 *ring, int16c *buf, const int16 *window,
+					  int16c *twiddles, int log2N, int hop, int mode);
+int mips_stft16_push(stft16 *st, int16 *indata, int n);
+int mips_stft16_frame(stft16 *st, int16 *outdata);
+
 void mips_vec_abs32(int32 *outdata, int32 *indata, int N);
 
 void mips_vec_add32(int32 *outdata, int32 *indata1, int32 *indata2, int N);
@@ -112,11 +186,459 @@ void mips_vec_mulc32(int32 *outdata, int32 *indata, int32 c, int N);
 
 void mips_vec_sub32(int32 *outdata, int32 *indata1, int32 *indata2, int N);
 
+void mips_vec_shl32(int32 *outdata, int32 *indata, int N, int shift);
+void mips_vec_shr32(int32 *outdata, int32 *indata, int N, int shift);
+void mips_vec_clamp32(int32 *outdata, int32 *indata, int32 lo, int32 hi, int N);
+
 int32 mips_vec_dotp32(int32 *indata1, int32 *indata2, int N, int scale);
+
+/* complex dot product, no conjugate; real and imaginary parts are each
+   rounded and shifted as by mips_vec_dotp32, and wrap like it: the sum
+   is cut to 32 bits before the scale shift, so it must fit in Q31 */
+void mips_cvec_dotp32(int32c *result, int32c *indata1, int32c *indata2, int N, int scale);
+
+/* outdata[m] = sum_n A[m*N + n] * x[n] for a row-major M x N matrix, any M, N >= 1,
+   each sum scaled and wrapping like mips_vec_dotp32 */
+void mips_mat_vec32(int32 *outdata, int32 *A, int32 *x, int M, int N, int scale);
+
+/* outdata[i] = c[0] + c[1] x + ... + c[K] x^K by Horner's rule, x = indata[i]
+   in Q31, the coefficients and result in any one Q format, N = 4*n.
+   Each step c[k] + acc x is rounded to 32 bits and wraps rather than
+   saturates, as for mips_vec_dotp32, so the coefficients must keep every
+   partial sum in range for |x| < 1.
+   The _mc form takes any N frames of C interleaved channels, channel c with
+   coefficients coeffs[c*(K+1) .. c*(K+1) + K] */
+void mips_vec_poly32(int32 *outdata, int32 *indata, const int32 *coeffs, int K, int N);
+void mips_vec_poly32_mc(int32 *outdata, int32 *indata, const int32 *coeffs, int K, int C, int N);
+
 int32 mips_vec_sum_squares32(int32 *indata, int N, int scale);
 
+void mips_vec_window32(int32c *outdata, int32 *indata, const int32 *window, int N);
+
 void __attribute__((deprecated)) mips_fft32_setup(int32c *twiddles, int log2N);
 void mips_fft32(int32c *dout, int32c *din, int32c *twiddles, int32c *scratch, int log2N);
+void mips_fft32_r4(int32c *dout, int32c *din, int32c *twiddles, int32c *scratch, int log2N);
+/* in-place DFT/N of data[], natural order in and out: it calls
+   mips_fft32_bitrev itself, so data must not be bit-reversed first */
+void mips_fft32_ip(int32c *data, int32c *twiddles, int log2N);
+void mips_fft32_bitrev(int32c *data, int log2N);
+void mips_fft32_batch(int32c *dout, int32c *din, int32c *twiddles, int32c *scratch,
+				int log2N, int M);
+
+void mips_dct32_setup(int32c *dcttw, int log2N, int type);
+void mips_dct2_32(int32 *outdata, int32 *indata, int32c *twiddles, int32c *dcttw,
+				  int32c *scratch, int log2N);
+void mips_dct4_32(int32 *outdata, int32 *indata, int32c *twiddles, int32c *dcttw,
+				  int32c *scratch, int log2N);
+void mips_mdct32(int32 *outdata, int32 *indata, int32c *twiddles, int32c *dcttw,
+				 int32c *scratch, int log2N);
+void mips_imdct32(int32 *outdata, int32 *indata, int32c *twiddles, int32c *dcttw,
+				  int32c *scratch, int log2N);
+
+void mips_goertzel32_setup(int32c *coeffs, int *bins, int B, int N);
+void mips_goertzel32(int64 *state, int32 *indata, int32c *coeffs, int B, int N);
+void mips_goertzel32_result(int32c *outdata, int64 *state, int32c *coeffs, int B, int scale);
+
+void mips_sdft32_setup(int32c *coeffs, int *bins, int B, int N, int32 r);
+void mips_sdft32(int32c *X, int32 *indata, int32c *coeffs, int32 *delayline,
+				 int B, int N, int M, int scale);
+
+
+#define FFT32_PLAN_MAXPASS	20
+
+/*
+ * Any-length FFT: mixed radix 2/3/4/5 when N = 2^a * 3^b * 5^c, otherwise
+ * Bluestein through mips_fft32. All storage is supplied by the caller,
+ * sized by mips_fft32_plan_mem(). Output is DFT/N as for mips_fft32.
+ */
+typedef struct
+{
+	int N;
+	int npass;				/* mixed-radix passes, 0 for Bluestein */
+	uint8 radix[FFT32_PLAN_MAXPASS];
+	int log2M;				/* Bluestein convolution length */
+	int shift;				/* Bluestein output gain */
+	int32c *twiddles;			/* N, or M/2 for mips_fft32 */
+	int32c *chirp;				/* N */
+	int32c *filter;				/* M */
+} fft32_plan;
+
+int mips_fft32_plan_mem(int N, int *scratch);
+int mips_fft32_plan_setup(fft32_plan *plan, int32c *mem, int32c *scratch, int N);
+void mips_fft32_plan(int32c *dout, int32c *din, const fft32_plan *plan, int32c *scratch);
+
+/*
+ * Cross-correlation and autocorrelation plan. Time-domain dot products
+ * (log2M = 0) or a 2^log2M-point FFT method are chosen at setup; all
+ * storage is supplied by the caller, sized by mips_xcorr_plan_mem().
+ * Results are rounded, shifted down by 15/31 + scale and saturated;
+ * dot products are exact, the FFT method's error is given in xcorr.c.
+ */
+typedef struct
+{
+	int N;
+	int maxlag;
+	int log2M;				/* FFT length, 0 for dot products */
+	int scale;
+	int32c *twiddles;			/* M/2 */
+} xcorr_plan;
+
+int mips_xcorr_plan_mem(int N, int maxlag, int *scratch);
+int mips_xcorr_plan_setup(xcorr_plan *plan, int32c *mem, int N, int maxlag, int scale);
+void mips_xcorr16(int16 *outdata, int16 *x, int16 *y, const xcorr_plan *plan, int32c *scratch);
+void mips_autocorr16(int16 *outdata, int16 *x, const xcorr_plan *plan, int32c *scratch);
+void mips_xcorr32(int32 *outdata, int32 *x, int32 *y, const xcorr_plan *plan, int32c *scratch);
+void mips_autocorr32(int32 *outdata, int32 *x, const xcorr_plan *plan, int32c *scratch);
+
+/*
+ * Conversions between the fixed-point and float formats. scale is a
+ * power of two exponent: the float values are the Q15/Q31 values times
+ * 2^scale. Float to fixed rounds to nearest even and saturates. Cores
+ * with an FPU use it, soft-float builds use integer code only.
+ *
+ * These and widen/narrow take N = 4*n >= 4; N is rounded down to a
+ * multiple of 4 and the last N % 4 elements are left unconverted.
+ */
+void mips_vec_q15_to_f32(float *outdata, int16 *indata, int N, int scale);
+void mips_vec_f32_to_q15(int16 *outdata, float *indata, int N, int scale);
+void mips_vec_q31_to_f32(float *outdata, int32 *indata, int N, int scale);
+void mips_vec_f32_to_q31(int32 *outdata, float *indata, int N, int scale);
+
+void mips_vec_widen16to32(int32 *outdata, int16 *indata, int N, int shift);
+void mips_vec_narrow32to16(int16 *outdata, int32 *indata, int N, int shift);
+
+/*
+ * Unsigned 8-bit vectors (pixels, 8-bit PCM), N = 4*n. add and sub
+ * saturate to 0 .. 255, avg is (a + b + 1) >> 1 and absdiff |a - b|.
+ * The DSPr2 versions work on four bytes per word and need word-aligned
+ * buffers.
+ */
+void mips_vec_add8u(uint8 *outdata, uint8 *indata1, uint8 *indata2, int N);
+void mips_vec_sub8u(uint8 *outdata, uint8 *indata1, uint8 *indata2, int N);
+void mips_vec_avg8u(uint8 *outdata, uint8 *indata1, uint8 *indata2, int N);
+void mips_vec_absdiff8u(uint8 *outdata, uint8 *indata1, uint8 *indata2, int N);
+void mips_vec_min8u(uint8 *outdata, uint8 *indata1, uint8 *indata2, int N);
+void mips_vec_max8u(uint8 *outdata, uint8 *indata1, uint8 *indata2, int N);
+uint32 mips_vec_sum8u(uint8 *indata, int N);
+
+/*
+ * Sum, sum of squares, min and max of a vector in one pass, N = 4*n, from
+ * which mean = sum / N and variance = sumsq / N - mean^2. stats16 gives
+ * the exact sum of x^2 (Q30 for Q15 data); stats32 sums x^2 >> 31 (Q31
+ * for Q31 data), rounded down.
+ */
+typedef struct
+{
+	int64 sum;				/* sum of x */
+	int64 sumsq;			/* sum of squares, as above */
+	int32 min;
+	int32 max;
+} vec_stats;
+
+void mips_vec_stats16(vec_stats *st, int16 *indata, int N);
+void mips_vec_stats32(vec_stats *st, int32 *indata, int N);
+
+/*
+ * Histograms, any N >= 0, adding the counts to hist so that one histogram
+ * may be built over several calls. hist8u has 256 bins; hist16 has
+ * 65536 >> shift bins, bin (x + 32768) >> shift. For N >= 4 * bins the
+ * counts go first to four sub-histograms in scratch, one per sample of
+ * each group of four, so that a run of equal samples does not load a
+ * count just stored; shorter calls count straight into hist, where
+ * clearing and summing scratch would cost more than the stalls.
+ *
+ * scratch: 4 * bins uint32, 4 KB for hist8u and 1 MB for hist16 with
+ * shift = 0 (64 KB with shift = 4); unused, and may be NULL, when
+ * N < 4 * bins
+ */
+void mips_hist8u(uint32 *hist, uint8 *indata, int N, uint32 *scratch);
+void mips_hist16(uint32 *hist, int16 *indata, int N, int shift, uint32 *scratch);
+
+/*
+ * Fully unrolled 3x3, 4x4 and 6x6 matrix kernels, generated by matgen.c.
+ * Matrices are row-major N*N arrays; C must not be A or B except for add.
+ * mul: C = A B, mul_t: C = A B^T, add: C = A + B, and fpft: Pout =
+ * F P F^T + Q for symmetric P and Q, where Pout may be P or Q. The Q31
+ * versions round and saturate every result, fpft also F P.
+ */
+void mips_mat3_mul_f32(float *C, const float *A, const float *B);
+void mips_mat3_mul_t_f32(float *C, const float *A, const float *B);
+void mips_mat3_add_f32(float *C, const float *A, const float *B);
+void mips_mat3_fpft_f32(float *Pout, const float *F, const float *P, const float *Q);
+void mips_mat3_mul32(int32 *C, const int32 *A, const int32 *B);
+void mips_mat3_mul_t32(int32 *C, const int32 *A, const int32 *B);
+void mips_mat3_add32(int32 *C, const int32 *A, const int32 *B);
+void mips_mat3_fpft32(int32 *Pout, const int32 *F, const int32 *P, const int32 *Q);
+
+void mips_mat4_mul_f32(float *C, const float *A, const float *B);
+void mips_mat4_mul_t_f32(float *C, const float *A, const float *B);
+void mips_mat4_add_f32(float *C, const float *A, const float *B);
+void mips_mat4_fpft_f32(float *Pout, const float *F, const float *P, const float *Q);
+void mips_mat4_mul32(int32 *C, const int32 *A, const int32 *B);
+void mips_mat4_mul_t32(int32 *C, const int32 *A, const int32 *B);
+void mips_mat4_add32(int32 *C, const int32 *A, const int32 *B);
+void mips_mat4_fpft32(int32 *Pout, const int32 *F, const int32 *P, const int32 *Q);
+
+void mips_mat6_mul_f32(float *C, const float *A, const float *B);
+void mips_mat6_mul_t_f32(float *C, const float *A, const float *B);
+void mips_mat6_add_f32(float *C, const float *A, const float *B);
+void mips_mat6_fpft_f32(float *Pout, const float *F, const float *P, const float *Q);
+void mips_mat6_mul32(int32 *C, const int32 *A, const int32 *B);
+void mips_mat6_mul_t32(int32 *C, const int32 *A, const int32 *B);
+void mips_mat6_add32(int32 *C, const int32 *A, const int32 *B);
+void mips_mat6_fpft32(int32 *Pout, const int32 *F, const int32 *P, const int32 *Q);
+
+/*
+ * Batched quaternion kernels, Q30 so that 1.0 is exact. rotate and
+ * to_dcm expect unit quaternions, rotate also vectors of length < 2;
+ * normalize takes any q and leaves q = 0 zero. Vectors are 3 values and
+ * DCMs 9 row-major values per quaternion.
+ */
+typedef struct
+{
+	int32 w;
+	int32 x;
+	int32 y;
+	int32 z;
+} quat32;
+
+void mips_quat_mul32(quat32 *outdata, quat32 *a, quat32 *b, int N);
+void mips_quat_normalize32(quat32 *outdata, quat32 *q, int N);
+void mips_quat_rotate32(int32 *outdata, quat32 *q, int32 *v, int N);
+void mips_quat_to_dcm32(int32 *outdata, quat32 *q, int N);
+
+/*
+ * Lookup-table interpolation over N inputs, clamped to the end values
+ * outside the table. mips_interp1_16/32 take K sorted breakpoints x[]
+ * with values y[]; the segment of the previous input is tried before a
+ * binary search. The uniform versions and mips_interp2_16 (bilinear, z
+ * row-major with ay->K rows of ax->K values) take breakpoints x0 + k dx
+ * from an interp_axis set up by mips_interp_axis_setup(), which returns
+ * -1 for K < 2, dx <= 0 or a span (K - 1) dx beyond 32 bits.
+ */
+typedef struct
+{
+	int32 x0;
+	int32 dx;
+	uint32 span;				/* (K - 1) dx */
+	uint32 rdx;				/* 1/dx, Q(shift) */
+	int shift;
+	int K;					/* >= 2 */
+} interp_axis;
+
+int mips_interp_axis_setup(interp_axis *axis, int32 x0, int32 dx, int K);
+void mips_interp1_16(int16 *outdata, int16 *indata, const int16 *x, const int16 *y, int K, int N);
+void mips_interp1_32(int32 *outdata, int32 *indata, const int32 *x, const int32 *y, int K, int N);
+void mips_interp1u_16(int16 *outdata, int16 *indata, const int16 *y, const interp_axis *ax, int N);
+void mips_interp1u_32(int32 *outdata, int32 *indata, const int32 *y, const interp_axis *ax, int N);
+void mips_interp2_16(int16 *outdata, int16 *xin, int16 *yin, const int16 *z,
+				const interp_axis *ax, const interp_axis *ay, int N);
+
+/*
+ * Running median of an odd window of W samples, by a selection network
+ * for W <= 9 and a pair of heaps above. The window starts out filled
+ * with init; all storage is supplied by the caller, sized by
+ * mips_median_mem().
+ */
+typedef struct
+{
+	int W;					/* odd, 1 .. 32767 */
+	int idx;				/* oldest sample in data */
+	int32 *data;				/* W, the window */
+	int16 *pos;				/* W, heap position of data[i] */
+	int16 *heap;				/* indices into data, -W/2 .. W/2 */
+} median_filter;
+
+int mips_median_mem(int W);
+int mips_median_init(median_filter *st, int32 *mem, int W, int32 init);
+void mips_median16(int16 *outdata, int16 *indata, median_filter *st, int N);
+void mips_median32(int32 *outdata, int32 *indata, median_filter *st, int N);
+
+/*
+ * Moving minimum and maximum of the last W samples by monotonic deques,
+ * storage sized by mips_minmax_mem().
+ */
+typedef struct
+{
+	int W;
+	uint32 t;				/* samples seen */
+	int32 *maxv;				/* W, deque values */
+	uint32 *maxt;				/* W, deque sample times */
+	int32 *minv;				/* W, as maxv for ~x */
+	uint32 *mint;
+	int maxh, maxn;				/* deque head and length */
+	int minh, minn;
+} minmax_filter;
+
+int mips_minmax_mem(int W);
+int mips_minmax_init(minmax_filter *st, int32 *mem, int W);
+void mips_minmax16(int16 *minout, int16 *maxout, int16 *indata, minmax_filter *st, int N);
+void mips_minmax32(int32 *minout, int32 *maxout, int32 *indata, minmax_filter *st, int N);
+
+
+#define CIC_MAXORDER		6
+
+/*
+ * CIC decimator by R with 32-bit wraparound integrators; the output is
+ * scaled by 2^-ceil(order log2 R). mips_cic16/32 take any N and return
+ * the number of outputs written, the phase carrying over between calls.
+ * mips_cic_init() takes the input width in bits (16 for mips_cic16, up
+ * to 32 for mips_cic32) and returns -1 unless bits + ceil(order log2 R)
+ * <= 32, e.g. R^order <= 65536 for 16-bit data.
+ */
+typedef struct
+{
+	int order;				/* 1 .. CIC_MAXORDER */
+	int R;					/* R^order <= 2^(32 - bits) */
+	int shift;				/* ceil(order log2 R) */
+	int phase;				/* inputs since the last output */
+	int32 integ[CIC_MAXORDER];
+	int32 comb[CIC_MAXORDER];		/* previous comb inputs */
+} cic_filter;
+
+int mips_cic_init(cic_filter *st, int order, int R, int bits);
+int mips_cic16(int16 *outdata, int16 *indata, cic_filter *st, int N);
+int mips_cic32(int32 *outdata, int32 *indata, cic_filter *st, int N);
+
+/* recursive moving average of the last L samples, 1 <= L <= 65536 */
+typedef struct
+{
+	int L;
+	int k;					/* ceil(log2 L) */
+	uint32 recip;				/* 2^(31+k) / L */
+	int idx;				/* oldest sample in delayline */
+	int64 sum;
+	void *delayline;			/* L int16 or int32 */
+} movavg_filter;
+
+int mips_movavg16_init(movavg_filter *st, int16 *delayline, int L);
+int mips_movavg32_init(movavg_filter *st, int32 *delayline, int L);
+void mips_movavg16(int16 *outdata, int16 *indata, movavg_filter *st, int N);
+void mips_movavg32(int32 *outdata, int32 *indata, movavg_filter *st, int N);
+
+/*
+ * Arbitrary-ratio resampler from fs_in to fs_out: a bank of P = 2^log2P
+ * polyphase filters of K = 4*k taps, designed by the init functions,
+ * and a cubic between phases. step may be adjusted between calls to
+ * track clock drift. mips_resample16/32 return the number of outputs.
+ */
+typedef struct
+{
+	int K;
+	int log2P;				/* 0 .. 10 */
+	uint64 step;				/* fs_in / fs_out, Q32.32 */
+	uint64 pos;				/* next output time, Q32.32 */
+	int idx;				/* oldest sample in delayline */
+	int16 *coeffs;				/* (P + 3) K */
+	int16 *delayline;			/* 2K */
+} resample16;
+
+typedef struct
+{
+	int K;
+	int log2P;
+	uint64 step;
+	uint64 pos;
+	int idx;
+	int32 *coeffs;				/* (P + 3) K, Q30 */
+	int32 *delayline;			/* 2K */
+} resample32;
+
+int mips_resample16_init(resample16 *st, int16 *coeffs, int16 *delayline, int K,
+						 int log2P, uint32 fs_in, uint32 fs_out);
+int mips_resample16(int16 *outdata, int16 *indata, resample16 *st, int N);
+int mips_resample32_init(resample32 *st, int32 *coeffs, int32 *delayline, int K,
+						 int log2P, uint32 fs_in, uint32 fs_out);
+int mips_resample32(int32 *outdata, int32 *indata, resample32 *st, int N);
+
+/*
+ * Bank of N PID controllers, struct-of-arrays. Q15 error, gains (times
+ * 2^shift) and output, Q31 integrator clamped to the output limits.
+ * Each controller's kd and ki include its sample time.
+ */
+typedef struct
+{
+	int16 *kp;				/* N */
+	int16 *ki;				/* N */
+	int16 *kd;				/* N */
+	int16 *umin;				/* N, output limits */
+	int16 *umax;				/* N */
+	int32 *integ;				/* N, integrator state */
+	int16 *eprev;				/* N, previous error */
+	int shift;				/* 0 .. 15 */
+} pid16_bank;
+
+void mips_pid16(int16 *outdata, int16 *e, pid16_bank *pb, int N);
+
+#ifdef __mips_hard_float
+
+/*
+ * Single precision kernels for cores with an FPU (PIC32MZ-EF). Only the
+ * hard-float library contains them. mips_fft_f32 returns the plain DFT,
+ * without the 1/N scaling of the fixed-point transforms.
+ */
+typedef struct
+{
+	float re;
+	float im;
+} floatc;
+
+
+/* H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 - a1 z^-1 - a2 z^-2) */
+typedef struct
+{
+	float b0;
+	float b1;
+	float b2;
+	float a1;
+	float a2;
+} biquadf;
+
+void mips_fft_f32_setup(floatc *twiddles, int log2N);
+void mips_fft_f32(floatc *dout, floatc *din, floatc *twiddles, floatc *scratch, int log2N);
+
+float mips_vec_dotp_f32(float *indata1, float *indata2, int N);
+
+/* polynomial evaluation, as mips_vec_poly32 and mips_vec_poly32_mc */
+void mips_vec_poly_f32(float *outdata, float *indata, const float *coeffs, int K, int N);
+void mips_vec_poly_f32_mc(float *outdata, float *indata, const float *coeffs, int K, int C, int N);
+
+/* PID controller bank, as mips_pid16 */
+typedef struct
+{
+	float *kp;				/* N */
+	float *ki;				/* N */
+	float *kd;				/* N */
+	float *umin;				/* N, output limits */
+	float *umax;				/* N */
+	float *integ;				/* N, integrator state */
+	float *eprev;				/* N, previous error */
+} pidf_bank;
+
+void mips_pid_f32(float *outdata, float *e, pidf_bank *pb, int N);
+
+void mips_fir_f32_setup(float *coeffs2x, float *coeffs, int K);
+void mips_fir_f32(float *outdata, float *indata, float *coeffs2x, float *delayline,
+				int N, int K);
+
+void mips_iir_f32(float *outdata, float *indata, biquadf *bq, float *delayline,
+				int B, int N);
+
+/* quaternion kernels, as the Q30 versions */
+typedef struct
+{
+	float w;
+	float x;
+	float y;
+	float z;
+} quatf;
+
+void mips_quat_mul_f32(quatf *outdata, quatf *a, quatf *b, int N);
+void mips_quat_normalize_f32(quatf *outdata, quatf *q, int N);
+void mips_quat_rotate_f32(float *outdata, quatf *q, float *v, int N);
+void mips_quat_to_dcm_f32(float *outdata, quatf *q, int N);
+
+#endif
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,355 @@
+/*
+ * Fixed-point sin, cos, atan2, sqrt, reciprocal sqrt, log2 and exp2 for
+ * cores without an FPU. Each function has a scalar inline form and a
+ * mips_vec_* batch form over N values (any N >= 0) in vec_math16.c and
+ * vec_math32.c. The tables are generated by mathcgen.c.
+ *
+ * Formats, Q31 for the 32-bit functions and Q15 for the 16-bit ones
+ * unless noted:
+ *
+ *	sin, cos:  angle in binary angle units, the full int range is one
+ *	           turn, -pi .. pi; result Q31/Q15
+ *	atan2:     y, x of any scale; result angle as above, 0 for (0, 0)
+ *	sqrt:      x >= 0; result Q31/Q15, 0 for x <= 0
+ *	rsqrt:     x > 0; result 1/sqrt(x) in Q16.15/Q8.7, MAX32/MAX16 for x <= 0
+ *	log2:      x > 0; result in Q5.26/Q4.11, MIN32/MIN16 for x <= 0
+ *	exp2:      x in Q5.26/Q4.11; result 2^x in Q31/Q15, saturated for x >= 0
+ *
+ * log2 and exp2 use the formats of each other, so exp2(log2(x)) gives
+ * x back to the precision of the log2 format.
+ *
+ * The 32-bit functions are accurate to a few LSBs, atan2 to about 20:
+ * sin and cos take the nearest of 512 table points and a third order
+ * correction, atan2 is a 31 step CORDIC, sqrt and rsqrt take three
+ * Newton steps from a table, and log2 and exp2 a table and a third
+ * order series. The 16-bit sin and cos interpolate the same table
+ * linearly and atan2 takes 15 CORDIC steps; the other 16-bit functions
+ * go through the 32-bit ones.
+ */
+
+#ifndef _DSPLIB_MATH_H_
+#define _DSPLIB_MATH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "dsplib_def.h"
+
+extern const int32 mips_math32_sin[512];
+extern const int32 mips_math32_atan[32];
+extern const uint32 mips_math32_rsqrt[48];
+extern const uint32 mips_math32_log2_inv[129];
+extern const uint32 mips_math32_log2[129];
+extern const int32 mips_math32_exp2[64];
+
+
+static inline int32 mips_math32_round(int64 v, int s)
+{
+	v = (v + ((int64) 1 << (s - 1))) >> s;
+	return (v > MAX32) ? MAX32 : (v < MIN32) ? MIN32 : (int32) v;
+}
+
+
+/*
+ * sin(a) = sin(t) cos(d) + cos(t) sin(d), t the nearest table point
+ * and |d| <= pi/512, with cos(d) = 1 - d^2/2 and sin(d) = d - d^3/6.
+ */
+
+static inline int32 mips_sin32(int32 a)
+{
+	uint32 i = (((uint32) a >> 22) + 1) >> 1;
+	int32 f = (int32) ((uint32) a - (i << 23));
+	int32 s = mips_math32_sin[i & 511];
+	int32 c = mips_math32_sin[(i + 128) & 511];
+	int32 d = (int32) (((int64) f * 0x6487ED51) >> 29);		/* f pi, Q31 radians */
+	int32 d2 = mul32r(d, d);
+	int32 sd = d - mul32r(mul32r(d2, d), 0x15555555);
+
+	return mips_math32_round(((int64) s << 31) - (int64) s * (d2 >> 1)
+							 + (int64) c * sd, 31);
+}
+
+
+static inline int32 mips_cos32(int32 a)
+{
+	return mips_sin32((int32) ((uint32) a + 0x40000000));
+}
+
+
+static inline int16 mips_sin16(int16 a)
+{
+	uint32 u = (uint16) a;
+	int i = u >> 7;
+	int32 s0 = mips_math32_sin[i];
+	int32 s1 = mips_math32_sin[(i + 1) & 511];
+	int32 v = s0 + (int32) (((int64) (s1 - s0) * (int32) (u & 127)) >> 7);
+
+	return (int16) SAT16P(((v >> 15) + 1) >> 1);
+}
+
+
+static inline int16 mips_cos16(int16 a)
+{
+	return mips_sin16((int16) (a + 0x4000));
+}
+
+
+/*
+ * CORDIC vectoring: (x, y) is scaled to 29 bits, folded into the right
+ * half plane and rotated onto the x axis by n steps of atan(2^-i), the
+ * sign of y picking the direction without a branch.
+ */
+
+static inline int32 mips_math32_cordic(int32 y, int32 x, int n)
+{
+	uint32 m = (uint32) ((x < 0) ? -x : x) | (uint32) ((y < 0) ? -y : y);
+	int32 z = 0, t, s, xs, ys;
+	int i, sh;
+
+	if (m == 0)
+		return 0;
+
+	sh = __builtin_clz(m) - 3;
+	if (sh >= 0)
+	{
+		x = (int32) ((uint32) x << sh);
+		y = (int32) ((uint32) y << sh);
+	}
+	else
+	{
+		x >>= -sh;
+		y >>= -sh;
+	}
+
+	if (x < 0)
+	{
+		t = x;
+		if (y >= 0)
+		{
+			x = y;
+			y = -t;
+			z = 0x40000000;
+		}
+		else
+		{
+			x = -y;
+			y = t;
+			z = -0x40000000;
+		}
+	}
+
+	for (i = 0; i < n; i++)
+	{
+		s = y >> 31;
+		xs = x >> i;
+		ys = y >> i;
+		x += (ys ^ s) - s;
+		y -= (xs ^ s) - s;
+		z += (mips_math32_atan[i] ^ s) - s;
+	}
+
+	return z;
+}
+
+
+static inline int32 mips_atan2_32(int32 y, int32 x)
+{
+	return mips_math32_cordic(y, x, 31);
+}
+
+
+static inline int16 mips_atan2_16(int16 y, int16 x)
+{
+	uint32 z = (uint32) mips_math32_cordic((int32) y << 16, (int32) x << 16, 15);
+
+	return (int16) ((int32) (z + 0x8000) >> 16);
+}
+
+
+/*
+ * 1/sqrt(v) for v in [2^29, 2^31) (Q31 in [1/4, 1)), Q30. Three Newton
+ * steps y = y (3 - v y^2) / 2 from the table, each roughly squaring the
+ * relative error.
+ */
+
+static inline uint32 mips_math32_rsqrt_core(uint32 v)
+{
+	uint32 y = mips_math32_rsqrt[(v >> 25) - 16];
+	uint32 t;
+	int i;
+
+	for (i = 0; i < 3; i++)
+	{
+		t = (uint32) (((uint64) y * y) >> 32);				/* Q28 */
+		t = (uint32) (((uint64) v * t) >> 29);				/* Q30 */
+		y = (uint32) (((uint64) y * (0xC0000000u - t)) >> 31);
+	}
+
+	return y;
+}
+
+
+/* x is shifted by an even amount into [1/4, 1), sqrt(x) = x / sqrt(x) */
+
+static inline int32 mips_sqrt32(int32 x)
+{
+	uint32 v, y, s;
+	int64 r;
+	int sh;
+
+	if (x <= 0)
+		return 0;
+
+	sh = (__builtin_clz(x) - 1) & ~1;
+	v = (uint32) x << sh;
+	y = mips_math32_rsqrt_core(v);
+	s = (uint32) (((uint64) v * y) >> 30);
+
+	/* one more step on the residual, s += (v - s^2) / (2 s) */
+
+	r = ((int64) v << 31) - (int64) s * s;
+	s += (int32) (((r >> 8) * (int64) y) >> 54);
+
+	sh >>= 1;
+	if (sh)
+		s = (s + (1u << (sh - 1))) >> sh;
+
+	return (s > (uint32) MAX32) ? MAX32 : (int32) s;
+}
+
+
+static inline int32 mips_rsqrt32(int32 x)
+{
+	uint32 y;
+	int sh;
+
+	if (x <= 0)
+		return MAX32;
+
+	sh = (__builtin_clz(x) - 1) & ~1;
+	y = mips_math32_rsqrt_core((uint32) x << sh);
+
+	/* 1/sqrt(x) = y / 2^30 * 2^(sh/2), Q15 */
+
+	sh = 15 - (sh >> 1);
+	if (sh)
+		y = (y + (1u << (sh - 1))) >> sh;
+
+	return (y > (uint32) MAX32) ? MAX32 : (int32) y;
+}
+
+
+static inline int16 mips_sqrt16(int16 x)
+{
+	int32 v = mips_sqrt32((int32) x << 16);
+
+	return (int16) SAT16P(((v >> 15) + 1) >> 1);
+}
+
+
+static inline int16 mips_rsqrt16(int16 x)
+{
+	if (x <= 0)
+		return MAX16;
+
+	return (int16) ((mips_rsqrt32((int32) x << 16) + 0x80) >> 8);
+}
+
+
+/*
+ * x = m 2^-k with m in [1, 2); log2(m) = log2(t) + log2(1 + u) for the
+ * nearest t = 1 + i/128 and u = m/t - 1, |u| < 2^-8, with
+ * log2(1 + u) = (u - u^2/2 + u^3/3) / ln 2.
+ */
+
+static inline int32 mips_log2_32(int32 x)
+{
+	uint32 m, i, lg;
+	int32 u, u2, p;
+	int k;
+
+	if (x <= 0)
+		return MIN32;
+
+	k = __builtin_clz(x);
+	m = (uint32) x << k;
+	i = (((m >> 23) + 1) >> 1) - 128;
+	u = (int32) ((uint32) (((uint64) m * mips_math32_log2_inv[i]) >> 31) - 0x80000000u);
+	u2 = mul32r(u, u);
+	p = u - (u2 >> 1) + mul32r(mul32r(u2, u), 0x2AAAAAAB);
+	lg = mips_math32_log2[i] + (int32) (((int64) p * 0x5C551D95) >> 30);
+
+	return (int32) ((lg + 16) >> 5) - (k << 26);
+}
+
+
+/*
+ * x = -k + i/64 + d with 0 <= d < 1/64; 2^x = 2^(i/64) (1 + g + g^2/2 +
+ * g^3/6) 2^-k with g = d ln 2.
+ */
+
+static inline int32 mips_exp2_32(int32 x)
+{
+	int32 g, g2, p, e, v;
+	uint32 f;
+	int sh;
+
+	if (x >= 0)
+		return MAX32;
+
+	f = (uint32) x & 0x3FFFFFF;
+	sh = -1 - (x >> 26);
+	if (sh > 31)
+		return 0;
+
+	g = mul32r((int32) ((f & 0xFFFFF) << 5), 0x58B90BFC);
+	g2 = mul32r(g, g);
+	p = g + (g2 >> 1) + mul32r(mul32r(g2, g), 0x15555555);
+	e = mips_math32_exp2[f >> 20];
+	v = e + mul32r(e, p);
+
+	/* 2^(i/64 + d) is Q30, so the result is v 2^(-k + 1) in Q31 */
+
+	return sh ? (int32) (((uint32) v + (1u << (sh - 1))) >> sh) : v;
+}
+
+
+static inline int16 mips_log2_16(int16 x)
+{
+	if (x <= 0)
+		return MIN16;
+
+	return (int16) ((mips_log2_32((int32) x << 16) + 0x4000) >> 15);
+}
+
+
+static inline int16 mips_exp2_16(int16 x)
+{
+	int32 v = mips_exp2_32((int32) x << 15);
+
+	return (int16) SAT16P(((v >> 15) + 1) >> 1);
+}
+
+
+void mips_vec_sin16(int16 *outdata, int16 *indata, int N);
+void mips_vec_cos16(int16 *outdata, int16 *indata, int N);
+void mips_vec_atan2_16(int16 *outdata, int16 *y, int16 *x, int N);
+void mips_vec_sqrt16(int16 *outdata, int16 *indata, int N);
+void mips_vec_rsqrt16(int16 *outdata, int16 *indata, int N);
+void mips_vec_log2_16(int16 *outdata, int16 *indata, int N);
+void mips_vec_exp2_16(int16 *outdata, int16 *indata, int N);
+
+void mips_vec_sin32(int32 *outdata, int32 *indata, int N);
+void mips_vec_cos32(int32 *outdata, int32 *indata, int N);
+void mips_vec_atan2_32(int32 *outdata, int32 *y, int32 *x, int N);
+void mips_vec_sqrt32(int32 *outdata, int32 *indata, int N);
+void mips_vec_rsqrt32(int32 *outdata, int32 *indata, int N);
+void mips_vec_log2_32(int32 *outdata, int32 *indata, int N);
+void mips_vec_exp2_32(int32 *outdata, int32 *indata, int N);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,108 @@
+/*
+ * CIC decimator: order integrators at the input rate, decimation by R,
+ * then order combs (differential delay 1) at the output rate, with no
+ * multiplies. The gain R^order is taken out by a rounded shift by
+ * ceil(order log2 R), so the output has the format of the input and a
+ * DC gain in (1/2, 1].
+ *
+ * The integrators wrap in 32 bits; the combs undo the wrap exactly as
+ * long as the true output fits, that is for inputs of at most
+ * 32 - shift bits: 16-bit data for R^order <= 65536, or e.g. 24-bit ADC
+ * samples in int32 for R^order <= 256. mips_cic_init() checks this for
+ * the input width it is given.
+ *
+ * The passband droop of the sinc^order response is usually corrected by
+ * a short mips_fir16 at the output rate.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+/* one input sample; nonzero with the comb output in *y every R samples */
+
+static inline int cic_push(cic_filter *st, int32 x, int32 *y)
+{
+	int32 *integ = st->integ, *comb = st->comb, t;
+	int k, order = st->order;
+
+	for (k = 0; k < order; k++)
+		x = integ[k] = (int32) ((uint32) integ[k] + (uint32) x);
+
+	if (++st->phase < st->R)
+		return 0;
+
+	st->phase = 0;
+
+	for (k = 0; k < order; k++)
+	{
+		t = x;
+		x = (int32) ((uint32) x - (uint32) comb[k]);
+		comb[k] = t;
+	}
+
+	*y = (st->shift) ? ((x >> (st->shift - 1)) + 1) >> 1 : x;
+	return 1;
+}
+
+
+int mips_cic_init(cic_filter *st, int order, int R, int bits)
+{
+	uint64 g = 1;
+	int k, shift;
+
+	if (order < 1 || order > CIC_MAXORDER || R < 1 || bits < 1 || bits > 32)
+		return -1;
+
+	for (k = 0; k < order; k++)
+	{
+		g *= R;
+		if (g > ((uint64) 1 << 31))
+			return -1;
+	}
+
+	for (shift = 0; ((uint64) 1 << shift) < g; shift++)
+		;
+
+	if (bits + shift > 32)
+		return -1;
+
+	st->order = order;
+	st->R = R;
+	st->shift = shift;
+	st->phase = 0;
+
+	for (k = 0; k < CIC_MAXORDER; k++)
+		st->integ[k] = st->comb[k] = 0;
+
+	return 0;
+}
+
+
+int mips_cic16(int16 *outdata, int16 *indata, cic_filter *st, int N)
+{
+	int i, n = 0;
+	int32 y;
+
+	for (i = 0; i < N; i++)
+	{
+		if (cic_push(st, indata[i], &y))
+			outdata[n++] = (int16) SAT16(y);
+	}
+
+	return n;
+}
+
+
+int mips_cic32(int32 *outdata, int32 *indata, cic_filter *st, int N)
+{
+	int i, n = 0;
+	int32 y;
+
+	for (i = 0; i < N; i++)
+	{
+		if (cic_push(st, indata[i], &y))
+			outdata[n++] = y;
+	}
+
+	return n;
+}
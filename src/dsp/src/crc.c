@@ -0,0 +1,102 @@
+/*
+ * Slice-by-4 and slice-by-8 CRC, see dsplib_crc.h.
+ *
+ * The buffer is read a word at a time with mips_ulw(), lwl/lwr on MIPS32,
+ * so it may start at any address; the bytes of each word are then taken
+ * in memory order whatever the endianness. For the reflected 32-bit CRCs
+ * the first byte is the low byte of the CRC, so on a little endian core
+ * the word is xored in as loaded; the MSB-first CRC-16 wants it the other
+ * way round. The last n % 4 (or n % 8) bytes go a byte at a time.
+ */
+
+#include "../../../include/dsplib_crc.h"
+#include "../../include/mips_unaligned.h"
+
+
+/* bytes p[0] .. p[3] as the low to high bytes of a word */
+
+static inline uint32 crc_le32(const uint8 *p)
+{
+	uint32 w = (uint32) mips_ulw((void *) p);
+
+#ifdef __MIPSEB__
+	w = __builtin_bswap32(w);
+#endif
+	return w;
+}
+
+
+/* bytes p[0] .. p[3] as the high to low bytes of a word */
+
+static inline uint32 crc_be32(const uint8 *p)
+{
+	uint32 w = (uint32) mips_ulw((void *) p);
+
+#ifndef __MIPSEB__
+	w = __builtin_bswap32(w);
+#endif
+	return w;
+}
+
+
+uint32 mips_crc32_update8(uint32 crc, const void *data, int n, const uint32 *table)
+{
+	const uint8 *p = (const uint8 *) data;
+	uint32 a, b;
+
+	for (; n >= 8; n -= 8, p += 8)
+	{
+		a = crc_le32(p) ^ crc;
+		b = crc_le32(p + 4);
+
+		crc = table[7 * 256 + (a & 0xff)] ^ table[6 * 256 + ((a >> 8) & 0xff)]
+			^ table[5 * 256 + ((a >> 16) & 0xff)] ^ table[4 * 256 + (a >> 24)]
+			^ table[3 * 256 + (b & 0xff)] ^ table[2 * 256 + ((b >> 8) & 0xff)]
+			^ table[1 * 256 + ((b >> 16) & 0xff)] ^ table[b >> 24];
+	}
+
+	for (; n > 0; n--)
+		crc = table[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+
+	return crc;
+}
+
+
+uint32 mips_crc32_update4(uint32 crc, const void *data, int n, const uint32 *table)
+{
+	const uint8 *p = (const uint8 *) data;
+	uint32 a;
+
+	for (; n >= 4; n -= 4, p += 4)
+	{
+		a = crc_le32(p) ^ crc;
+
+		crc = table[3 * 256 + (a & 0xff)] ^ table[2 * 256 + ((a >> 8) & 0xff)]
+			^ table[1 * 256 + ((a >> 16) & 0xff)] ^ table[a >> 24];
+	}
+
+	for (; n > 0; n--)
+		crc = table[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+
+	return crc;
+}
+
+
+uint16 mips_crc16_update4(uint16 crc, const void *data, int n, const uint16 *table)
+{
+	const uint8 *p = (const uint8 *) data;
+	uint32 c = crc, a;
+
+	for (; n >= 4; n -= 4, p += 4)
+	{
+		a = crc_be32(p) ^ (c << 16);
+
+		c = table[3 * 256 + (a >> 24)] ^ table[2 * 256 + ((a >> 16) & 0xff)]
+			^ table[1 * 256 + ((a >> 8) & 0xff)] ^ table[a & 0xff];
+	}
+
+	for (; n > 0; n--)
+		c = (table[((c >> 8) ^ *p++) & 0xff] ^ (c << 8)) & 0xffff;
+
+	return (uint16) c;
+}
@@ -0,0 +1,55 @@
+/*
+ * RAM tables for the CRC functions of dsplib_crc.h, the same as the const
+ * ones from crccgen.c for the standard polynomials.
+ *
+ * Table 0 is the bitwise CRC of each byte; table k extends table k-1 by
+ * one zero byte through table 0.
+ *
+ * table: slices x 256 entries
+ */
+
+#include "../../../include/dsplib_crc.h"
+
+
+void mips_crc32_table(uint32 *table, uint32 poly, int slices)
+{
+	uint32 c;
+	int i, j, k;
+
+	for (i = 0; i < 256; i++)
+	{
+		c = i;
+		for (j = 0; j < 8; j++)
+			c = (c & 1) ? (c >> 1) ^ poly : c >> 1;
+		table[i] = c;
+	}
+
+	for (k = 1; k < slices; k++)
+		for (i = 0; i < 256; i++)
+		{
+			c = table[(k - 1) * 256 + i];
+			table[k * 256 + i] = (c >> 8) ^ table[c & 0xff];
+		}
+}
+
+
+void mips_crc16_table(uint16 *table, uint16 poly, int slices)
+{
+	uint32 c;
+	int i, j, k;
+
+	for (i = 0; i < 256; i++)
+	{
+		c = i << 8;
+		for (j = 0; j < 8; j++)
+			c = (c & 0x8000) ? (c << 1) ^ poly : c << 1;
+		table[i] = (uint16) c;
+	}
+
+	for (k = 1; k < slices; k++)
+		for (i = 0; i < 256; i++)
+		{
+			c = table[(k - 1) * 256 + i];
+			table[k * 256 + i] = (uint16) ((c << 8) ^ table[c >> 8]);
+		}
+}
@@ -0,0 +1,105 @@
+/*
+ * Table generator for the CRC functions in dsplib_crc.h, see
+ * fftc-README.txt for the approach. Writes one file per table:
+ *
+ *   crc32tab.c    CRC-32,  reflected 0xEDB88320, 8 x 256 entries
+ *   crc32ctab.c   CRC-32C, reflected 0x82F63B78, 8 x 256 entries
+ *   crc16tab.c    CRC-16-CCITT, 0x1021, 4 x 256 entries
+ *
+ * Table k holds the CRC of byte i followed by k zero bytes.
+ *
+ *   gcc -o crccgen crccgen.c && ./crccgen
+ */
+
+#include <stdio.h>
+#include <assert.h>
+
+
+static FILE *Open(const char *name)
+{
+  char filename[100];
+
+  sprintf(filename, "%s.c", name);
+  FILE *fp = fopen(filename, "wt");
+  assert(fp != NULL);
+
+  fprintf(fp, "#include \"../../../include/dsplib_crc.h\"\n\n");
+  return fp;
+}
+
+
+static void Table(FILE *fp, const char *type, const char *name, const unsigned int *v,
+				  int slices, int digits)
+{
+  int i;
+
+  fprintf(fp, "const %s %s[%d * 256] =\n{", type, name, slices);
+
+  for (i = 0; i < slices * 256; i++)
+  {
+	if (i % 256 == 0 && i)
+	  fprintf(fp, "\n");
+	fprintf(fp, (i % 8) ? " 0x%0*x," : "\n\t0x%0*x,", digits, v[i]);
+  }
+
+  fprintf(fp, "\n};\n\n");
+}
+
+
+static void Crc32(const char *name, unsigned int poly)
+{
+  unsigned int v[8 * 256], c;
+  FILE *fp;
+  int i, j, k;
+
+  for (i = 0; i < 256; i++)
+  {
+	c = i;
+	for (j = 0; j < 8; j++)
+	  c = (c & 1) ? (c >> 1) ^ poly : c >> 1;
+	v[i] = c;
+  }
+
+  for (k = 1; k < 8; k++)
+	for (i = 0; i < 256; i++)
+	{
+	  c = v[(k - 1) * 256 + i];
+	  v[k * 256 + i] = (c >> 8) ^ v[c & 0xff];
+	}
+
+  fp = Open(name);
+  Table(fp, "uint32", name[5] == 'c' ? "mips_crc32c_tab" : "mips_crc32_tab", v, 8, 8);
+  fclose(fp);
+}
+
+
+int main()
+{
+  unsigned int v[4 * 256], c;
+  FILE *fp;
+  int i, j, k;
+
+  Crc32("crc32tab", 0xEDB88320);
+  Crc32("crc32ctab", 0x82F63B78);
+
+  for (i = 0; i < 256; i++)
+  {
+	c = i << 8;
+	for (j = 0; j < 8; j++)
+	  c = (c & 0x8000) ? ((c << 1) ^ 0x1021) & 0xffff : (c << 1) & 0xffff;
+	v[i] = c;
+  }
+
+  for (k = 1; k < 4; k++)
+	for (i = 0; i < 256; i++)
+	{
+	  c = v[(k - 1) * 256 + i];
+	  v[k * 256 + i] = ((c << 8) & 0xffff) ^ v[c >> 8];
+	}
+
+  fp = Open("crc16tab");
+  Table(fp, "uint16", "mips_crc16_tab", v, 4, 4);
+  fclose(fp);
+
+  return 0;
+}
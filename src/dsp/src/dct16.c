@@ -0,0 +1,166 @@
+/*
+ * 16-bit DCT-II, DCT-IV, MDCT and IMDCT through an N/2-point complex
+ * mips_fft16_r4, with pre- and post-twiddles from mips_dct16_setup():
+ *
+ *	mips_dct2_16:  X[k] = 1/N * sum_n x[n] cos(pi/N (n + 1/2) k)
+ *	mips_dct4_16:  X[k] = 1/N * sum_n x[n] cos(pi/N (n + 1/2)(k + 1/2))
+ *	mips_mdct16:   X[k] = 1/(2N) * sum_n x[n] cos(pi/N (n + 1/2 + N/2)(k + 1/2)),
+ *	               2N inputs, N outputs
+ *	mips_imdct16:  y[n] = 1/N * sum_k X[k] cos(pi/N (n + 1/2 + N/2)(k + 1/2)),
+ *	               N inputs, 2N outputs
+ *
+ * The scaling keeps every intermediate in range, in the same way as the
+ * 1/N of the FFTs. N = 2^log2N >= 16.
+ *
+ * DCT-II reorders x into v = x[0], x[2], .. x[N-2], x[N-1], .. x[3], x[1],
+ * packs pairs of v into N/2 complex values and splits the even and odd
+ * halves of the spectrum after the FFT (Makhoul). DCT-IV packs
+ * x[2n] + j x[N-1-2n] and rotates before and after the FFT. The MDCT
+ * folds its 2N inputs into an N-point DCT-IV; the IMDCT unfolds one.
+ *
+ * twiddles: as for mips_fft16_r4 with log2N - 1
+ * dcttw:    N entries from mips_dct16_setup(), DCT_II or DCT_IV
+ * scratch:  3N/2 int16c
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static inline int16 dct16_sat(int32 v)
+{
+	return (int16) SAT16(v);
+}
+
+
+static inline int16 dct16_round(int64 v, int s)
+{
+	v = (v + ((int64) 1 << (s - 1))) >> s;
+	return (v > MAX16) ? MAX16 : (v < MIN16) ? MIN16 : (int16) v;
+}
+
+
+/* t[n] = (x[2n] + j x[N-1-2n]) * w[n] / 2 */
+
+static void dct16_pre4(int16c *t, int16 *x, int16c *w, int N)
+{
+	int n;
+	int32 a, b;
+
+	for (n = 0; n < N / 2; n++)
+	{
+		a = x[2 * n];
+		b = x[N - 1 - 2 * n];
+		t[n].re = (int16) ((a * w[n].re - b * w[n].im + 0x8000) >> 16);
+		t[n].im = (int16) ((a * w[n].im + b * w[n].re + 0x8000) >> 16);
+	}
+}
+
+
+void mips_dct4_16(int16 *outdata, int16 *indata, int16c *twiddles, int16c *dcttw,
+				  int16c *scratch, int log2N)
+{
+	int N = 1 << log2N, h = N / 2;
+	int16c *T = scratch + h;
+	int16c *w = dcttw + h;
+	int k;
+
+	dct16_pre4(scratch, indata, dcttw, N);
+	mips_fft16_r4(T, scratch, twiddles, scratch + N, log2N - 1);
+
+	for (k = 0; k < h; k++)
+	{
+		int64 re = (int64) T[k].re * w[k].re - (int64) T[k].im * w[k].im;
+		int64 im = (int64) T[k].re * w[k].im + (int64) T[k].im * w[k].re;
+
+		outdata[2 * k] = dct16_round(re, 15);
+		outdata[N - 1 - 2 * k] = dct16_round(-im, 15);
+	}
+}
+
+
+void mips_dct2_16(int16 *outdata, int16 *indata, int16c *twiddles, int16c *dcttw,
+				  int16c *scratch, int log2N)
+{
+	int N = 1 << log2N, h = N / 2;
+	int16c *Z = scratch + h;
+	int16c *w4 = dcttw + h;
+	int n, k;
+
+	/* z[m] = (v[2m] + j v[2m+1]) / 2 */
+
+	for (n = 0; n < h / 2; n++)
+	{
+		scratch[n].re = (int16) ((indata[4 * n] + 1) >> 1);
+		scratch[n].im = (int16) ((indata[4 * n + 2] + 1) >> 1);
+		scratch[h / 2 + n].re = (int16) ((indata[N - 1 - 4 * n] + 1) >> 1);
+		scratch[h / 2 + n].im = (int16) ((indata[N - 3 - 4 * n] + 1) >> 1);
+	}
+
+	mips_fft16_r4(Z, scratch, twiddles, scratch + N, log2N - 1);
+
+	outdata[0] = dct16_sat(Z[0].re + Z[0].im);
+	outdata[h] = dct16_round((int64) (Z[0].re - Z[0].im) * 23170, 15);
+
+	for (k = 1; k < h; k++)
+	{
+		/* A = Z[k], B = conj(Z[h-k]): e = A + B, q = -j(A - B) */
+
+		int32 er = Z[k].re + Z[h - k].re;
+		int32 ei = Z[k].im - Z[h - k].im;
+		int32 qr = Z[k].im + Z[h - k].im;
+		int32 qi = Z[h - k].re - Z[k].re;
+
+		/* v = e + W q = 2V, Q15 */
+
+		int64 vr = ((int64) er << 15) + (int64) qr * dcttw[k].re - (int64) qi * dcttw[k].im;
+		int64 vi = ((int64) ei << 15) + (int64) qr * dcttw[k].im + (int64) qi * dcttw[k].re;
+
+		int64 ur = vr * w4[k].re - vi * w4[k].im;
+		int64 ui = vr * w4[k].im + vi * w4[k].re;
+
+		outdata[k] = dct16_round(ur, 31);
+		outdata[N - k] = dct16_round(-ui, 31);
+	}
+}
+
+
+void mips_mdct16(int16 *outdata, int16 *indata, int16c *twiddles, int16c *dcttw,
+				 int16c *scratch, int log2N)
+{
+	int N = 1 << log2N, h = N / 2;
+	int16 *u = (int16 *) (scratch + N);
+	int n;
+
+	/* x = [a b c d]: u = (-c_r - d, a - b_r) / 2 */
+
+	for (n = 0; n < h; n++)
+	{
+		u[n] = dct16_sat((-indata[3 * h - 1 - n] - indata[3 * h + n]) >> 1);
+		u[h + n] = dct16_sat((indata[n] - indata[N - 1 - n]) >> 1);
+	}
+
+	mips_dct4_16(outdata, u, twiddles, dcttw, scratch, log2N);
+}
+
+
+void mips_imdct16(int16 *outdata, int16 *indata, int16c *twiddles, int16c *dcttw,
+				  int16c *scratch, int log2N)
+{
+	int N = 1 << log2N, h = N / 2;
+	int16 *u = (int16 *) (scratch + N);
+	int n;
+
+	/* DCT-IV into u, written after the FFT has finished with its scratch */
+
+	mips_dct4_16(u, indata, twiddles, dcttw, scratch, log2N);
+
+	/* u = (u1, u2): y = [u2, -u2_r, -u1_r, -u1] */
+
+	for (n = 0; n < h; n++)
+	{
+		outdata[n] = u[h + n];
+		outdata[N - 1 - n] = dct16_sat(-u[h + n]);
+		outdata[3 * h - 1 - n] = dct16_sat(-u[n]);
+		outdata[3 * h + n] = dct16_sat(-u[n]);
+	}
+}
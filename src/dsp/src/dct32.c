@@ -0,0 +1,172 @@
+/*
+ * 32-bit DCT-II, DCT-IV, MDCT and IMDCT through an N/2-point complex
+ * mips_fft32_r4, with pre- and post-twiddles from mips_dct32_setup():
+ *
+ *	mips_dct2_32:  X[k] = 1/N * sum_n x[n] cos(pi/N (n + 1/2) k)
+ *	mips_dct4_32:  X[k] = 1/N * sum_n x[n] cos(pi/N (n + 1/2)(k + 1/2))
+ *	mips_mdct32:   X[k] = 1/(2N) * sum_n x[n] cos(pi/N (n + 1/2 + N/2)(k + 1/2)),
+ *	               2N inputs, N outputs
+ *	mips_imdct32:  y[n] = 1/N * sum_k X[k] cos(pi/N (n + 1/2 + N/2)(k + 1/2)),
+ *	               N inputs, 2N outputs
+ *
+ * The scaling keeps every intermediate in range, in the same way as the
+ * 1/N of the FFTs. N = 2^log2N >= 16.
+ *
+ * DCT-II reorders x into v = x[0], x[2], .. x[N-2], x[N-1], .. x[3], x[1],
+ * packs pairs of v into N/2 complex values and splits the even and odd
+ * halves of the spectrum after the FFT (Makhoul). DCT-IV packs
+ * x[2n] + j x[N-1-2n] and rotates before and after the FFT. The MDCT
+ * folds its 2N inputs into an N-point DCT-IV; the IMDCT unfolds one.
+ *
+ * twiddles: as for mips_fft32_r4 with log2N - 1
+ * dcttw:    N entries from mips_dct32_setup(), DCT_II or DCT_IV
+ * scratch:  3N/2 int32c
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static inline int32 dct32_sat(int64 v)
+{
+	return (v > MAX32) ? MAX32 : (v < MIN32) ? MIN32 : (int32) v;
+}
+
+
+static inline int32 dct32_half(int32 v)
+{
+	return (v >> 1) + (v & 1);
+}
+
+
+static inline int32 dct32_round(int64 v, int s)
+{
+	v = (v + ((int64) 1 << (s - 1))) >> s;
+	return (v > MAX32) ? MAX32 : (v < MIN32) ? MIN32 : (int32) v;
+}
+
+
+/* t[n] = (x[2n] + j x[N-1-2n]) * w[n] / 2 */
+
+static void dct32_pre4(int32c *t, int32 *x, int32c *w, int N)
+{
+	int n;
+	int64 a, b;
+
+	for (n = 0; n < N / 2; n++)
+	{
+		a = x[2 * n];
+		b = x[N - 1 - 2 * n];
+		t[n].re = (int32) ((a * w[n].re - b * w[n].im + 0x80000000LL) >> 32);
+		t[n].im = (int32) ((a * w[n].im + b * w[n].re + 0x80000000LL) >> 32);
+	}
+}
+
+
+void mips_dct4_32(int32 *outdata, int32 *indata, int32c *twiddles, int32c *dcttw,
+				  int32c *scratch, int log2N)
+{
+	int N = 1 << log2N, h = N / 2;
+	int32c *T = scratch + h;
+	int32c *w = dcttw + h;
+	int k;
+
+	dct32_pre4(scratch, indata, dcttw, N);
+	mips_fft32_r4(T, scratch, twiddles, scratch + N, log2N - 1);
+
+	for (k = 0; k < h; k++)
+	{
+		int64 re = (int64) T[k].re * w[k].re - (int64) T[k].im * w[k].im;
+		int64 im = (int64) T[k].re * w[k].im + (int64) T[k].im * w[k].re;
+
+		outdata[2 * k] = dct32_round(re, 31);
+		outdata[N - 1 - 2 * k] = dct32_round(-im, 31);
+	}
+}
+
+
+void mips_dct2_32(int32 *outdata, int32 *indata, int32c *twiddles, int32c *dcttw,
+				  int32c *scratch, int log2N)
+{
+	int N = 1 << log2N, h = N / 2;
+	int32c *Z = scratch + h;
+	int32c *w4 = dcttw + h;
+	int n, k;
+
+	/* z[m] = (v[2m] + j v[2m+1]) / 2 */
+
+	for (n = 0; n < h / 2; n++)
+	{
+		scratch[n].re = dct32_half(indata[4 * n]);
+		scratch[n].im = dct32_half(indata[4 * n + 2]);
+		scratch[h / 2 + n].re = dct32_half(indata[N - 1 - 4 * n]);
+		scratch[h / 2 + n].im = dct32_half(indata[N - 3 - 4 * n]);
+	}
+
+	mips_fft32_r4(Z, scratch, twiddles, scratch + N, log2N - 1);
+
+	outdata[0] = dct32_sat((int64) Z[0].re + Z[0].im);
+	outdata[h] = dct32_round(((int64) Z[0].re - Z[0].im) * 1518500250, 31);
+
+	for (k = 1; k < h; k++)
+	{
+		/* A = Z[k], B = conj(Z[h-k]): E = (A + B) / 2, O = -j(A - B) / 2 */
+
+		int64 er = ((int64) Z[k].re + Z[h - k].re + 1) >> 1;
+		int64 ei = ((int64) Z[k].im - Z[h - k].im + 1) >> 1;
+		int64 qr = ((int64) Z[k].im + Z[h - k].im + 1) >> 1;
+		int64 qi = ((int64) Z[h - k].re - Z[k].re + 1) >> 1;
+
+		/* V = E + W O */
+
+		int64 vr = er + ((qr * dcttw[k].re - qi * dcttw[k].im + 0x40000000) >> 31);
+		int64 vi = ei + ((qr * dcttw[k].im + qi * dcttw[k].re + 0x40000000) >> 31);
+
+		int64 ur = vr * w4[k].re - vi * w4[k].im;
+		int64 ui = vr * w4[k].im + vi * w4[k].re;
+
+		outdata[k] = dct32_round(ur, 31);
+		outdata[N - k] = dct32_round(-ui, 31);
+	}
+}
+
+
+void mips_mdct32(int32 *outdata, int32 *indata, int32c *twiddles, int32c *dcttw,
+				 int32c *scratch, int log2N)
+{
+	int N = 1 << log2N, h = N / 2;
+	int32 *u = (int32 *) (scratch + N);
+	int n;
+
+	/* x = [a b c d]: u = (-c_r - d, a - b_r) / 2 */
+
+	for (n = 0; n < h; n++)
+	{
+		u[n] = dct32_sat((-(int64) indata[3 * h - 1 - n] - indata[3 * h + n]) >> 1);
+		u[h + n] = dct32_sat(((int64) indata[n] - indata[N - 1 - n]) >> 1);
+	}
+
+	mips_dct4_32(outdata, u, twiddles, dcttw, scratch, log2N);
+}
+
+
+void mips_imdct32(int32 *outdata, int32 *indata, int32c *twiddles, int32c *dcttw,
+				  int32c *scratch, int log2N)
+{
+	int N = 1 << log2N, h = N / 2;
+	int32 *u = (int32 *) (scratch + N);
+	int n;
+
+	/* DCT-IV into u, written after the FFT has finished with its scratch */
+
+	mips_dct4_32(u, indata, twiddles, dcttw, scratch, log2N);
+
+	/* u = (u1, u2): y = [u2, -u2_r, -u1_r, -u1] */
+
+	for (n = 0; n < h; n++)
+	{
+		outdata[n] = u[h + n];
+		outdata[N - 1 - n] = dct32_sat(-(int64) u[h + n]);
+		outdata[3 * h - 1 - n] = dct32_sat(-(int64) u[n]);
+		outdata[3 * h + n] = dct32_sat(-(int64) u[n]);
+	}
+}
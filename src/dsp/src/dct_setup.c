@@ -0,0 +1,52 @@
+/*
+ * Pre/post-twiddle tables for the FFT-based DCTs, N entries for an
+ * N-point transform:
+ *
+ *	DCT_II: exp(-2*pi*i*k/N), then exp(-pi*i*k/(2N)),    k = 0 .. N/2-1
+ *	DCT_IV: exp(-pi*i*(4k+1)/(4N)), then exp(-pi*i*k/N), k = 0 .. N/2-1
+ *
+ * mips_mdct16/32 and mips_imdct16/32 with N outputs (inputs) use the
+ * DCT_IV table for N.
+ */
+
+#include <math.h>
+#include "../../../include/dsplib_dsp.h"
+
+
+static double dct_angle(int i, int N, int type)
+{
+	int h = N / 2;
+
+	if (type == DCT_II)
+		return (i < h) ? -(2 * M_PI * i) / N : -(M_PI * (i - h)) / (2 * N);
+
+	return (i < h) ? -(M_PI * (4 * i + 1)) / (4 * N) : -(M_PI * (i - h)) / N;
+}
+
+
+void mips_dct16_setup(int16c *dcttw, int log2N, int type)
+{
+	int i;
+	int N = 1 << log2N;
+
+	for (i = 0; i < N; i++)
+	{
+		double a = dct_angle(i, N, type);
+		dcttw[i].re = (int16) floor(MAX16 * cos(a) + 0.5);
+		dcttw[i].im = (int16) floor(MAX16 * sin(a) + 0.5);
+	}
+}
+
+
+void mips_dct32_setup(int32c *dcttw, int log2N, int type)
+{
+	int i;
+	int N = 1 << log2N;
+
+	for (i = 0; i < N; i++)
+	{
+		double a = dct_angle(i, N, type);
+		dcttw[i].re = (int32) floor(MAX32 * cos(a) + 0.5);
+		dcttw[i].im = (int32) floor(MAX32 * sin(a) + 0.5);
+	}
+}
@@ -0,0 +1,329 @@
+/*
+ * Any-length 32-bit FFT, see fft32_plan_setup.c.
+ *
+ * The mixed-radix passes use the same Stockham auto-sort ordering as
+ * fft16r4.S: for a pass of radix r with n points per sub-transform and
+ * stride s = N/n, m = n/r,
+ *
+ *	y[q + s*(r*p + j)] = W_N^(j*p*s) / r * sum_k x[q + s*(p + k*m)] * W_r^(j*k)
+ *
+ * The 1/r scaling is applied to the inputs of each butterfly so that
+ * the output is DFT/N, as for mips_fft32. din is not modified.
+ *
+ * A full-scale complex input has magnitude up to sqrt(2), and so can
+ * any rotated butterfly output. The first pass therefore scales by
+ * 1/(2r), which keeps every intermediate value inside Q31, and the
+ * output is doubled with saturation at the end; Bluestein lengths keep
+ * the same guard bit through mips_fft32. The 1/3 and 1/5 factors are
+ * rounded down so that r times a scaled MIN32 cannot wrap, and cmul32
+ * sums its products with a guard bit and saturates.
+ *
+ * scratch: N int32c for mixed-radix lengths, 3*M for Bluestein lengths
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+#define Q31_1_3		0x2AAAAAAA	/* 1/3, rounded down so 3 * MIN32/3 fits */
+#define Q31_1_5		0x19999999	/* 1/5, rounded down likewise */
+#define Q31_SIN60	0x6ED9EBA1	/* sin(pi/3) */
+#define Q31_C1		663608942	/* cos(2pi/5) */
+#define Q31_C2		-1737350766	/* cos(4pi/5) */
+#define Q31_S1		2042378317	/* sin(2pi/5) */
+#define Q31_S2		1262259218	/* sin(4pi/5) */
+
+
+static inline int32 sat32(int64 v)
+{
+	return (v > MAX32) ? MAX32 : ((v < MIN32) ? MIN32 : (int32) v);
+}
+
+
+/*
+ * (re + j im) w, saturated. A butterfly difference can reach sqrt(2)
+ * full scale and the radix-3 and radix-5 ones 1.25 per component, so
+ * re and im come in as int64 and the products are summed in Q61, one
+ * guard bit above the Q62 products.
+ */
+
+static inline int32c cmul32(int64 re, int64 im, int32c w)
+{
+	int32c y;
+
+	y.re = sat32((((re * w.re) >> 1) - ((im * w.im) >> 1) + 0x20000000) >> 30);
+	y.im = sat32((((re * w.im) >> 1) + ((im * w.re) >> 1) + 0x20000000) >> 30);
+
+	return y;
+}
+
+
+static inline int32c cscale32(int32c a, int32 c)
+{
+	int32c y;
+
+	y.re = mul32r(a.re, c);
+	y.im = mul32r(a.im, c);
+
+	return y;
+}
+
+
+static void pass2(int32c *y, const int32c *x, const int32c *tw, int m, int s, int g)
+{
+	int p, q;
+	int32c a, b, w1;
+
+	for (p = 0; p < m; p++)
+	{
+		w1 = tw[p * s];
+
+		for (q = 0; q < s; q++)
+		{
+			a = x[q + s * p];
+			b = x[q + s * (p + m)];
+
+			y[q + s * 2 * p].re = (a.re >> (1 + g)) + (b.re >> (1 + g));
+			y[q + s * 2 * p].im = (a.im >> (1 + g)) + (b.im >> (1 + g));
+
+			y[q + s * (2 * p + 1)] = cmul32((a.re >> (1 + g)) - (b.re >> (1 + g)),
+											(a.im >> (1 + g)) - (b.im >> (1 + g)), w1);
+		}
+	}
+}
+
+
+static void pass3(int32c *y, const int32c *x, const int32c *tw, int m, int s, int g)
+{
+	int p, q;
+	int32c x0, x1, x2, t1, t2, t3, w1, w2;
+
+	for (p = 0; p < m; p++)
+	{
+		w1 = tw[p * s];
+		w2 = tw[2 * p * s];
+
+		for (q = 0; q < s; q++)
+		{
+			x0 = cscale32(x[q + s * p], Q31_1_3 >> g);
+			x1 = cscale32(x[q + s * (p + m)], Q31_1_3 >> g);
+			x2 = cscale32(x[q + s * (p + 2 * m)], Q31_1_3 >> g);
+
+			t1.re = x1.re + x2.re;
+			t1.im = x1.im + x2.im;
+			t2.re = x0.re - (t1.re >> 1);
+			t2.im = x0.im - (t1.im >> 1);
+			t3.re = mul32r(x1.re - x2.re, Q31_SIN60);
+			t3.im = mul32r(x1.im - x2.im, Q31_SIN60);
+
+			y[q + s * 3 * p].re = x0.re + t1.re;
+			y[q + s * 3 * p].im = x0.im + t1.im;
+
+			/* t2 -/+ j*t3 */
+
+			y[q + s * (3 * p + 1)] = cmul32((int64) t2.re + t3.im, (int64) t2.im - t3.re, w1);
+			y[q + s * (3 * p + 2)] = cmul32((int64) t2.re - t3.im, (int64) t2.im + t3.re, w2);
+		}
+	}
+}
+
+
+static void pass4(int32c *y, const int32c *x, const int32c *tw, int m, int s, int g)
+{
+	int p, q;
+	int32c a, b, c, d, apc, amc, bpd, bmd, w1, w2, w3;
+
+	for (p = 0; p < m; p++)
+	{
+		w1 = tw[p * s];
+		w2 = tw[2 * p * s];
+		w3 = tw[3 * p * s];
+
+		for (q = 0; q < s; q++)
+		{
+			a = x[q + s * p];
+			b = x[q + s * (p + m)];
+			c = x[q + s * (p + 2 * m)];
+			d = x[q + s * (p + 3 * m)];
+
+			apc.re = (a.re >> (2 + g)) + (c.re >> (2 + g));
+			apc.im = (a.im >> (2 + g)) + (c.im >> (2 + g));
+			amc.re = (a.re >> (2 + g)) - (c.re >> (2 + g));
+			amc.im = (a.im >> (2 + g)) - (c.im >> (2 + g));
+			bpd.re = (b.re >> (2 + g)) + (d.re >> (2 + g));
+			bpd.im = (b.im >> (2 + g)) + (d.im >> (2 + g));
+			bmd.re = (b.re >> (2 + g)) - (d.re >> (2 + g));
+			bmd.im = (b.im >> (2 + g)) - (d.im >> (2 + g));
+
+			y[q + s * 4 * p].re = apc.re + bpd.re;
+			y[q + s * 4 * p].im = apc.im + bpd.im;
+
+			/* (a - c) - j(b - d) */
+			y[q + s * (4 * p + 1)] = cmul32(amc.re + bmd.im, amc.im - bmd.re, w1);
+
+			y[q + s * (4 * p + 2)] = cmul32(apc.re - bpd.re, apc.im - bpd.im, w2);
+
+			/* (a - c) + j(b - d) */
+			y[q + s * (4 * p + 3)] = cmul32(amc.re - bmd.im, amc.im + bmd.re, w3);
+		}
+	}
+}
+
+
+static void pass5(int32c *y, const int32c *x, const int32c *tw, int m, int s, int g)
+{
+	int p, q;
+	int32c x0, x1, x2, x3, x4, t1, t2, t3, t4, a1, a2, b1, b2;
+	int32c w1, w2, w3, w4;
+
+	for (p = 0; p < m; p++)
+	{
+		w1 = tw[p * s];
+		w2 = tw[2 * p * s];
+		w3 = tw[3 * p * s];
+		w4 = tw[4 * p * s];
+
+		for (q = 0; q < s; q++)
+		{
+			x0 = cscale32(x[q + s * p], Q31_1_5 >> g);
+			x1 = cscale32(x[q + s * (p + m)], Q31_1_5 >> g);
+			x2 = cscale32(x[q + s * (p + 2 * m)], Q31_1_5 >> g);
+			x3 = cscale32(x[q + s * (p + 3 * m)], Q31_1_5 >> g);
+			x4 = cscale32(x[q + s * (p + 4 * m)], Q31_1_5 >> g);
+
+			t1.re = x1.re + x4.re;
+			t1.im = x1.im + x4.im;
+			t2.re = x2.re + x3.re;
+			t2.im = x2.im + x3.im;
+			t3.re = x1.re - x4.re;
+			t3.im = x1.im - x4.im;
+			t4.re = x2.re - x3.re;
+			t4.im = x2.im - x3.im;
+
+			y[q + s * 5 * p].re = x0.re + t1.re + t2.re;
+			y[q + s * 5 * p].im = x0.im + t1.im + t2.im;
+
+			a1.re = x0.re + mul32r(t1.re, Q31_C1) + mul32r(t2.re, Q31_C2);
+			a1.im = x0.im + mul32r(t1.im, Q31_C1) + mul32r(t2.im, Q31_C2);
+			a2.re = x0.re + mul32r(t1.re, Q31_C2) + mul32r(t2.re, Q31_C1);
+			a2.im = x0.im + mul32r(t1.im, Q31_C2) + mul32r(t2.im, Q31_C1);
+
+			b1.re = mul32r(t3.re, Q31_S1) + mul32r(t4.re, Q31_S2);
+			b1.im = mul32r(t3.im, Q31_S1) + mul32r(t4.im, Q31_S2);
+			b2.re = mul32r(t3.re, Q31_S2) - mul32r(t4.re, Q31_S1);
+			b2.im = mul32r(t3.im, Q31_S2) - mul32r(t4.im, Q31_S1);
+
+			/* a1 -/+ j*b1 and a2 -/+ j*b2 */
+
+			y[q + s * (5 * p + 1)] = cmul32((int64) a1.re + b1.im, (int64) a1.im - b1.re, w1);
+			y[q + s * (5 * p + 2)] = cmul32((int64) a2.re + b2.im, (int64) a2.im - b2.re, w2);
+			y[q + s * (5 * p + 3)] = cmul32((int64) a2.re - b2.im, (int64) a2.im + b2.re, w3);
+			y[q + s * (5 * p + 4)] = cmul32((int64) a1.re - b1.im, (int64) a1.im + b1.re, w4);
+		}
+	}
+}
+
+
+static void fft32_mixed(int32c *dout, int32c *din, const fft32_plan *plan, int32c *scratch)
+{
+	int i, m, s, g;
+	const int32c *x;
+	int32c *y;
+
+	/* ping-pong between dout and scratch so that the last pass lands in dout */
+
+	x = din;
+	y = (plan->npass & 1) ? dout : scratch;
+	s = 1;
+	m = plan->N;
+
+	for (i = 0; i < plan->npass; i++)
+	{
+		m /= plan->radix[i];
+		g = (i == 0);
+
+		switch (plan->radix[i])
+		{
+		case 2:
+			pass2(y, x, plan->twiddles, m, s, g);
+			break;
+		case 3:
+			pass3(y, x, plan->twiddles, m, s, g);
+			break;
+		case 4:
+			pass4(y, x, plan->twiddles, m, s, g);
+			break;
+		default:
+			pass5(y, x, plan->twiddles, m, s, g);
+			break;
+		}
+
+		s *= plan->radix[i];
+		x = y;
+		y = (y == dout) ? scratch : dout;
+	}
+
+	for (i = 0; i < plan->N; i++)
+	{
+		dout[i].re = sat32(2 * (int64) dout[i].re);
+		dout[i].im = sat32(2 * (int64) dout[i].im);
+	}
+}
+
+
+static void fft32_bluestein(int32c *dout, int32c *din, const fft32_plan *plan, int32c *scratch)
+{
+	int i, N, M;
+	int64 re, im;
+	int32c t;
+	int32c *a = scratch;
+	int32c *A = scratch + (1 << plan->log2M);
+	int32c *fs = scratch + 2 * (1 << plan->log2M);
+
+	N = plan->N;
+	M = 1 << plan->log2M;
+
+	/*
+	 * mips_fft32 wraps once an input's magnitude passes full scale, so
+	 * the input is halved before the chirp and the output shift makes
+	 * up for it. The filter has magnitude below sqrt(2), so the filtered
+	 * spectrum of the halved input stays inside full scale.
+	 */
+
+	for (i = 0; i < N; i++)
+		a[i] = cmul32(din[i].re >> 1, din[i].im >> 1, plan->chirp[i]);
+
+	for (; i < M; i++)
+		a[i].re = a[i].im = 0;
+
+	mips_fft32(A, a, plan->twiddles, fs, plan->log2M);
+
+	/* inverse transform as conj(fft(conj(x))) */
+
+	for (i = 0; i < M; i++)
+	{
+		t = cmul32(A[i].re, A[i].im, plan->filter[i]);
+		a[i].re = t.re;
+		a[i].im = -t.im;
+	}
+
+	mips_fft32(A, a, plan->twiddles, fs, plan->log2M);
+
+	for (i = 0; i < N; i++)
+	{
+		t = cmul32(A[i].re, -(int64)A[i].im, plan->chirp[i]);
+
+		re = (int64)t.re * ((int64)1 << (plan->shift + 1));
+		im = (int64)t.im * ((int64)1 << (plan->shift + 1));
+
+		dout[i].re = (re > MAX32) ? MAX32 : ((re < MIN32) ? MIN32 : re);
+		dout[i].im = (im > MAX32) ? MAX32 : ((im < MIN32) ? MIN32 : im);
+	}
+}
+
+
+void mips_fft32_plan(int32c *dout, int32c *din, const fft32_plan *plan, int32c *scratch)
+{
+	if (plan->npass)
+		fft32_mixed(dout, din, plan, scratch);
+	else
+		fft32_bluestein(dout, din, plan, scratch);
+}
@@ -0,0 +1,189 @@
+/*
+ * Setup for mips_fft32_plan().
+ *
+ * Lengths of the form 2^a * 3^b * 5^c are split into radix-4 passes, at
+ * most one radix-2 pass, and radix-3 and radix-5 passes. The plan holds
+ * an N-entry Q31 twiddle table.
+ *
+ * Any other length uses Bluestein's algorithm: a chirp multiply, a
+ * circular convolution of length M = 2^log2M >= 2N - 1 done with two
+ * mips_fft32() calls, and a second chirp multiply. The plan holds the
+ * chirp, the mips_fft32 twiddles and the pre-transformed convolution
+ * filter. The filter is scaled down by 2^shift to fit Q31 and the gain
+ * is restored on output.
+ *
+ * mem:     mips_fft32_plan_mem(N) int32c entries
+ * scratch: *scratch int32c entries as returned by mips_fft32_plan_mem();
+ *          only used during setup for Bluestein lengths
+ */
+
+#include <math.h>
+#include "../../../include/dsplib_dsp.h"
+
+
+static int fft32_plan_factor(uint8 *radix, int N)
+{
+	int n = 0;
+
+	while (N % 4 == 0 && n < FFT32_PLAN_MAXPASS)
+	{
+		radix[n++] = 4;
+		N /= 4;
+	}
+
+	if (N % 2 == 0 && n < FFT32_PLAN_MAXPASS)
+	{
+		radix[n++] = 2;
+		N /= 2;
+	}
+
+	while (N % 3 == 0 && n < FFT32_PLAN_MAXPASS)
+	{
+		radix[n++] = 3;
+		N /= 3;
+	}
+
+	while (N % 5 == 0 && n < FFT32_PLAN_MAXPASS)
+	{
+		radix[n++] = 5;
+		N /= 5;
+	}
+
+	return (N == 1) ? n : 0;
+}
+
+
+static int fft32_plan_log2M(int N)
+{
+	int log2M = 3;
+
+	while ((1 << log2M) < 2 * N - 1)
+		log2M++;
+
+	return log2M;
+}
+
+
+int mips_fft32_plan_mem(int N, int *scratch)
+{
+	uint8 radix[FFT32_PLAN_MAXPASS];
+	int M;
+
+	if (N < 2)
+		return 0;
+
+	if (fft32_plan_factor(radix, N))
+	{
+		if (scratch)
+			*scratch = N;
+		return N;
+	}
+
+	M = 1 << fft32_plan_log2M(N);
+
+	if (scratch)
+		*scratch = 3 * M;
+
+	return M / 2 + N + M;
+}
+
+
+int mips_fft32_plan_setup(fft32_plan *plan, int32c *mem, int32c *scratch, int N)
+{
+	int i, M;
+	double a, g, k;
+
+	if (N < 2)
+		return -1;
+
+	plan->N = N;
+	plan->npass = fft32_plan_factor(plan->radix, N);
+
+	if (plan->npass)
+	{
+		plan->log2M = 0;
+		plan->shift = 0;
+		plan->twiddles = mem;
+		plan->chirp = 0;
+		plan->filter = 0;
+
+		for (i = 0; i < N; i++)
+		{
+			a = -(2 * M_PI * i) / N;
+			mem[i].re = (int32) floor(MAX32 * cos(a) + 0.5);
+			mem[i].im = (int32) floor(MAX32 * sin(a) + 0.5);
+		}
+
+		return 0;
+	}
+
+	plan->log2M = fft32_plan_log2M(N);
+	M = 1 << plan->log2M;
+
+	plan->twiddles = mem;
+	plan->chirp = mem + M / 2;
+	plan->filter = mem + M / 2 + N;
+
+	for (i = 0; i < M / 2; i++)
+	{
+		a = -(2 * M_PI * i) / M;
+		plan->twiddles[i].re = (int32) floor(MAX32 * cos(a) + 0.5);
+		plan->twiddles[i].im = (int32) floor(MAX32 * sin(a) + 0.5);
+	}
+
+	/* w[n] = exp(-j * pi * n^2 / N), n^2 reduced mod 2N to keep the angle exact */
+
+	for (i = 0; i < N; i++)
+	{
+		a = -(M_PI * (int)(((int64)i * i) % (2 * N))) / N;
+		plan->chirp[i].re = (int32) floor(MAX32 * cos(a) + 0.5);
+		plan->chirp[i].im = (int32) floor(MAX32 * sin(a) + 0.5);
+	}
+
+	/* filter = DFT(conj(w[n]), n = -(N-1) .. N-1, wrapped to length M) */
+
+	for (i = 0; i < M; i++)
+		scratch[i].re = scratch[i].im = 0;
+
+	for (i = 0; i < N; i++)
+	{
+		scratch[i].re = plan->chirp[i].re;
+		scratch[i].im = -plan->chirp[i].im;
+		if (i)
+			scratch[M - i] = scratch[i];
+	}
+
+	mips_fft32(plan->filter, scratch, plan->twiddles, scratch + M, plan->log2M);
+
+	/*
+	 * mips_fft32 returns DFT/M. The forward transform in mips_fft32_plan
+	 * divides by M once more and the result must come out divided by N,
+	 * so the filter needs a gain of M^2/N, split into a Q31 part and a
+	 * power of two applied on output.
+	 */
+
+	g = 0;
+	for (i = 0; i < M; i++)
+	{
+		if (fabs((double) plan->filter[i].re) > g)
+			g = fabs((double) plan->filter[i].re);
+		if (fabs((double) plan->filter[i].im) > g)
+			g = fabs((double) plan->filter[i].im);
+	}
+
+	k = (double) M * M / N;
+	plan->shift = 0;
+	while (g * k >= MAX32)
+	{
+		k /= 2;
+		plan->shift++;
+	}
+
+	for (i = 0; i < M; i++)
+	{
+		plan->filter[i].re = (int32) floor(plan->filter[i].re * k + 0.5);
+		plan->filter[i].im = (int32) floor(plan->filter[i].im * k + 0.5);
+	}
+
+	return 0;
+}
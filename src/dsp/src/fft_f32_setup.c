@@ -0,0 +1,24 @@
+/*
+ * Twiddle table for mips_fft_f32: N/2 entries exp(-2*pi*i*k/N), the
+ * same layout as the fixed-point fft16c/fft32c tables.
+ */
+
+#include <math.h>
+#include "../../../include/dsplib_dsp.h"
+
+#ifdef __mips_hard_float
+
+void mips_fft_f32_setup(floatc *twiddles, int log2N)
+{
+	int i;
+	int N = 1 << log2N;
+
+	for (i = 0; i < (N / 2); i++)
+	{
+		double a = -(2 * M_PI * i) / N;
+		twiddles[i].re = (float) cos(a);
+		twiddles[i].im = (float) sin(a);
+	}
+}
+
+#endif
@@ -0,0 +1,20 @@
+/*
+ * Coefficient setup for mips_fir_f32, see mips_fir16_setup.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+#ifdef __mips_hard_float
+
+void mips_fir_f32_setup(float *coeffs2x, float *coeffs, int K)
+{
+	int k;
+
+	for (k = 0; k < K; k++)
+	{
+		coeffs2x[k] = coeffs[k];
+		coeffs2x[k+K] = coeffs[k];
+	}
+}
+
+#endif
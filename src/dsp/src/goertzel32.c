@@ -0,0 +1,49 @@
+/*
+ * Goertzel bank, Q31 input and coefficients.
+ *
+ * Runs N samples through each of B bins:
+ *
+ *	s = x + 2*cos(w)*s1 - s2
+ *
+ * state holds (s1, s2) per bin as int64 so there is no headroom limit on
+ * the block length. The samples may be fed in any number of calls;
+ * mips_goertzel32_result() reads the bins and clears the state.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static inline int64 mul64x30(int64 s, int32 c)
+{
+	/* (s * c) >> 30, s split into a signed high part and 31 low bits */
+
+	int32 hi = (int32) (s >> 31);
+	int64 lo = (int64) (s & 0x7FFFFFFF);
+
+	return (int64)hi * c * 2 + ((lo * c + 0x20000000) >> 30);
+}
+
+
+void mips_goertzel32(int64 *state, int32 *indata, int32c *coeffs, int B, int N)
+{
+	int b, n;
+	int32 c;
+	int64 s0, s1, s2;
+
+	for (b = 0; b < B; b++)
+	{
+		c = coeffs[b].re;
+		s1 = state[2*b];
+		s2 = state[2*b+1];
+
+		for (n = 0; n < N; n++)
+		{
+			s0 = indata[n] + mul64x30(s1, c) - s2;
+			s2 = s1;
+			s1 = s0;
+		}
+
+		state[2*b] = s1;
+		state[2*b+1] = s2;
+	}
+}
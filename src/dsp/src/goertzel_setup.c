@@ -0,0 +1,105 @@
+/*
+ * Goertzel bank setup and read-out.
+ *
+ * coeffs[b] = (cos(w), sin(w)), w = 2*pi*bins[b]/N. After exactly N
+ * samples have been run through mips_goertzel16/32 the bins are read
+ * with one more (zero input) step folded into the result:
+ *
+ *	X = (cos(w)*s1 - s2) + j*sin(w)*s1
+ *
+ * which is the N-point DFT bin with no phase correction needed. The
+ * result is returned as X / 2^scale (scale = log2N gives the same
+ * scaling as mips_fft16/32) and the state is cleared for the next block.
+ */
+
+#include <math.h>
+#include "../../../include/dsplib_dsp.h"
+
+
+void mips_goertzel16_setup(int16c *coeffs, int *bins, int B, int N)
+{
+	int b;
+
+	for (b = 0; b < B; b++)
+	{
+		double a = (2 * M_PI * bins[b]) / N;
+		double c = floor(32768 * cos(a) + 0.5);
+		double s = floor(32768 * sin(a) + 0.5);
+
+		coeffs[b].re = (int16) ((c > MAX16) ? MAX16 : c);
+		coeffs[b].im = (int16) ((s > MAX16) ? MAX16 : s);
+	}
+}
+
+
+void mips_goertzel16_result(int16c *outdata, int32 *state, int16c *coeffs, int B, int scale)
+{
+	int b;
+	int32 re, im, rnd;
+
+	rnd = (1 << scale) >> 1;
+
+	for (b = 0; b < B; b++)
+	{
+		int32 s1 = state[2*b];
+		int32 s2 = state[2*b+1];
+
+		re = (((int64)coeffs[b].re * s1 + 0x4000) >> 15) - s2;
+		im = ((int64)coeffs[b].im * s1 + 0x4000) >> 15;
+
+		outdata[b].re = SAT16((re + rnd) >> scale);
+		outdata[b].im = SAT16((im + rnd) >> scale);
+
+		state[2*b] = state[2*b+1] = 0;
+	}
+}
+
+
+void mips_goertzel32_setup(int32c *coeffs, int *bins, int B, int N)
+{
+	int b;
+
+	for (b = 0; b < B; b++)
+	{
+		double a = (2 * M_PI * bins[b]) / N;
+		double c = floor(2147483648.0 * cos(a) + 0.5);
+		double s = floor(2147483648.0 * sin(a) + 0.5);
+
+		coeffs[b].re = (int32) ((c > MAX32) ? MAX32 : c);
+		coeffs[b].im = (int32) ((s > MAX32) ? MAX32 : s);
+	}
+}
+
+
+static inline int64 mul64x31(int64 s, int32 c)
+{
+	/* (s * c) >> 31 without a 96-bit product */
+
+	int32 hi = (int32) (s >> 31);
+	int64 lo = (int64) (s & 0x7FFFFFFF);
+
+	return (int64)hi * c + ((lo * c + 0x40000000) >> 31);
+}
+
+
+void mips_goertzel32_result(int32c *outdata, int64 *state, int32c *coeffs, int B, int scale)
+{
+	int b;
+	int64 re, im, rnd;
+
+	rnd = ((int64)1 << scale) >> 1;
+
+	for (b = 0; b < B; b++)
+	{
+		int64 s1 = state[2*b];
+		int64 s2 = state[2*b+1];
+
+		re = ((mul64x31(s1, coeffs[b].re) - s2) + rnd) >> scale;
+		im = (mul64x31(s1, coeffs[b].im) + rnd) >> scale;
+
+		outdata[b].re = (re > MAX32) ? MAX32 : ((re < MIN32) ? MIN32 : (int32) re);
+		outdata[b].im = (im > MAX32) ? MAX32 : ((im < MIN32) ? MIN32 : (int32) im);
+
+		state[2*b] = state[2*b+1] = 0;
+	}
+}
@@ -0,0 +1,85 @@
+/*
+ * Histograms of 8-bit and 16-bit samples, see mips_hist8u/16 in
+ * dsplib_dsp.h.
+ *
+ * Counting straight into one table, a run of equal samples (a flat
+ * image area, a stuck sensor) loads each count right after it was
+ * stored, and the load waits on the store. Here sample i % 4 of each
+ * group goes to sub-histogram i % 4, so consecutive increments are to
+ * different tables; the four are summed into hist at the end. That
+ * costs 4 * bins stores and loads, so below N = 4 * bins the samples
+ * are counted into hist directly.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static void hist_sum(uint32 *hist, uint32 *scratch, int bins)
+{
+	int b;
+
+	for (b = 0; b < bins; b++)
+		hist[b] += scratch[b] + scratch[bins + b] + scratch[2 * bins + b]
+			+ scratch[3 * bins + b];
+}
+
+
+void mips_hist8u(uint32 *hist, uint8 *indata, int N, uint32 *scratch)
+{
+	uint32 *h0 = scratch, *h1 = h0 + 256, *h2 = h1 + 256, *h3 = h2 + 256;
+	int i;
+
+	if (N < 4 * 256)
+	{
+		for (i = 0; i < N; i++)
+			hist[indata[i]]++;
+		return;
+	}
+
+	for (i = 0; i < 4 * 256; i++)
+		scratch[i] = 0;
+
+	for (i = 0; i + 4 <= N; i += 4)
+	{
+		h0[indata[i]]++;
+		h1[indata[i + 1]]++;
+		h2[indata[i + 2]]++;
+		h3[indata[i + 3]]++;
+	}
+
+	for (; i < N; i++)
+		h0[indata[i]]++;
+
+	hist_sum(hist, scratch, 256);
+}
+
+
+void mips_hist16(uint32 *hist, int16 *indata, int N, int shift, uint32 *scratch)
+{
+	int bins = 0x10000 >> shift;
+	uint32 *h0 = scratch, *h1 = h0 + bins, *h2 = h1 + bins, *h3 = h2 + bins;
+	int i;
+
+	if (N < 4 * bins)
+	{
+		for (i = 0; i < N; i++)
+			hist[(uint16) (indata[i] + 0x8000) >> shift]++;
+		return;
+	}
+
+	for (i = 0; i < 4 * bins; i++)
+		scratch[i] = 0;
+
+	for (i = 0; i + 4 <= N; i += 4)
+	{
+		h0[(uint16) (indata[i] + 0x8000) >> shift]++;
+		h1[(uint16) (indata[i + 1] + 0x8000) >> shift]++;
+		h2[(uint16) (indata[i + 2] + 0x8000) >> shift]++;
+		h3[(uint16) (indata[i + 3] + 0x8000) >> shift]++;
+	}
+
+	for (; i < N; i++)
+		h0[(uint16) (indata[i] + 0x8000) >> shift]++;
+
+	hist_sum(hist, scratch, bins);
+}
@@ -0,0 +1,30 @@
+/*
+ * Setup of a uniform axis for mips_interp1u_16/32 and mips_interp2_16,
+ * breakpoints x0 + k dx for k = 0 .. K-1. Returns -1 unless K >= 2,
+ * dx > 0 and the span (K-1) dx fits in 32 bits.
+ *
+ * The segment index of x is (x - x0) rdx >> shift, with rdx in
+ * [2^31, 2^32), and the Q31 fraction is taken from the remainder in the
+ * same way, so there is no divide per sample.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+int mips_interp_axis_setup(interp_axis *axis, int32 x0, int32 dx, int K)
+{
+	int s;
+
+	if (K < 2 || dx <= 0 || (uint64) (K - 1) * (uint32) dx > 0xFFFFFFFFu)
+		return -1;
+
+	s = __builtin_clz(dx);
+
+	axis->x0 = x0;
+	axis->dx = dx;
+	axis->span = (uint32) (K - 1) * (uint32) dx;
+	axis->rdx = (uint32) (0x7FFFFFFFFFFFFFFFull / ((uint64) dx << s));
+	axis->shift = 63 - s;
+	axis->K = K;
+	return 0;
+}
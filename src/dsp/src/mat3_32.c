@@ -0,0 +1,162 @@
+/* generated by matgen.c */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static inline int32 mat32_sat(int64 v)
+{
+	return (v > MAX32) ? MAX32 : (v < MIN32) ? MIN32 : (int32) v;
+}
+
+
+/* round a Q61 sum to Q31 and saturate */
+
+static inline int32 mat32_round(int64 v)
+{
+	return mat32_sat((v + 0x20000000) >> 30);
+}
+
+
+void mips_mat3_mul32(int32 *C, const int32 *A, const int32 *B)
+{
+	C[0] = mat32_round((((int64) A[0] * B[0]) >> 1)
+		+ (((int64) A[1] * B[3]) >> 1)
+		+ (((int64) A[2] * B[6]) >> 1));
+	C[1] = mat32_round((((int64) A[0] * B[1]) >> 1)
+		+ (((int64) A[1] * B[4]) >> 1)
+		+ (((int64) A[2] * B[7]) >> 1));
+	C[2] = mat32_round((((int64) A[0] * B[2]) >> 1)
+		+ (((int64) A[1] * B[5]) >> 1)
+		+ (((int64) A[2] * B[8]) >> 1));
+	C[3] = mat32_round((((int64) A[3] * B[0]) >> 1)
+		+ (((int64) A[4] * B[3]) >> 1)
+		+ (((int64) A[5] * B[6]) >> 1));
+	C[4] = mat32_round((((int64) A[3] * B[1]) >> 1)
+		+ (((int64) A[4] * B[4]) >> 1)
+		+ (((int64) A[5] * B[7]) >> 1));
+	C[5] = mat32_round((((int64) A[3] * B[2]) >> 1)
+		+ (((int64) A[4] * B[5]) >> 1)
+		+ (((int64) A[5] * B[8]) >> 1));
+	C[6] = mat32_round((((int64) A[6] * B[0]) >> 1)
+		+ (((int64) A[7] * B[3]) >> 1)
+		+ (((int64) A[8] * B[6]) >> 1));
+	C[7] = mat32_round((((int64) A[6] * B[1]) >> 1)
+		+ (((int64) A[7] * B[4]) >> 1)
+		+ (((int64) A[8] * B[7]) >> 1));
+	C[8] = mat32_round((((int64) A[6] * B[2]) >> 1)
+		+ (((int64) A[7] * B[5]) >> 1)
+		+ (((int64) A[8] * B[8]) >> 1));
+}
+
+
+void mips_mat3_mul_t32(int32 *C, const int32 *A, const int32 *B)
+{
+	C[0] = mat32_round((((int64) A[0] * B[0]) >> 1)
+		+ (((int64) A[1] * B[1]) >> 1)
+		+ (((int64) A[2] * B[2]) >> 1));
+	C[1] = mat32_round((((int64) A[0] * B[3]) >> 1)
+		+ (((int64) A[1] * B[4]) >> 1)
+		+ (((int64) A[2] * B[5]) >> 1));
+	C[2] = mat32_round((((int64) A[0] * B[6]) >> 1)
+		+ (((int64) A[1] * B[7]) >> 1)
+		+ (((int64) A[2] * B[8]) >> 1));
+	C[3] = mat32_round((((int64) A[3] * B[0]) >> 1)
+		+ (((int64) A[4] * B[1]) >> 1)
+		+ (((int64) A[5] * B[2]) >> 1));
+	C[4] = mat32_round((((int64) A[3] * B[3]) >> 1)
+		+ (((int64) A[4] * B[4]) >> 1)
+		+ (((int64) A[5] * B[5]) >> 1));
+	C[5] = mat32_round((((int64) A[3] * B[6]) >> 1)
+		+ (((int64) A[4] * B[7]) >> 1)
+		+ (((int64) A[5] * B[8]) >> 1));
+	C[6] = mat32_round((((int64) A[6] * B[0]) >> 1)
+		+ (((int64) A[7] * B[1]) >> 1)
+		+ (((int64) A[8] * B[2]) >> 1));
+	C[7] = mat32_round((((int64) A[6] * B[3]) >> 1)
+		+ (((int64) A[7] * B[4]) >> 1)
+		+ (((int64) A[8] * B[5]) >> 1));
+	C[8] = mat32_round((((int64) A[6] * B[6]) >> 1)
+		+ (((int64) A[7] * B[7]) >> 1)
+		+ (((int64) A[8] * B[8]) >> 1));
+}
+
+
+void mips_mat3_add32(int32 *C, const int32 *A, const int32 *B)
+{
+	C[0] = mat32_sat((int64) A[0] + B[0]);
+	C[1] = mat32_sat((int64) A[1] + B[1]);
+	C[2] = mat32_sat((int64) A[2] + B[2]);
+	C[3] = mat32_sat((int64) A[3] + B[3]);
+	C[4] = mat32_sat((int64) A[4] + B[4]);
+	C[5] = mat32_sat((int64) A[5] + B[5]);
+	C[6] = mat32_sat((int64) A[6] + B[6]);
+	C[7] = mat32_sat((int64) A[7] + B[7]);
+	C[8] = mat32_sat((int64) A[8] + B[8]);
+}
+
+
+void mips_mat3_fpft32(int32 *Pout, const int32 *F, const int32 *P, const int32 *Q)
+{
+	int32 T[9];
+	int32 v;
+
+	T[0] = mat32_round((((int64) F[0] * P[0]) >> 1)
+		+ (((int64) F[1] * P[3]) >> 1)
+		+ (((int64) F[2] * P[6]) >> 1));
+	T[1] = mat32_round((((int64) F[0] * P[1]) >> 1)
+		+ (((int64) F[1] * P[4]) >> 1)
+		+ (((int64) F[2] * P[7]) >> 1));
+	T[2] = mat32_round((((int64) F[0] * P[2]) >> 1)
+		+ (((int64) F[1] * P[5]) >> 1)
+		+ (((int64) F[2] * P[8]) >> 1));
+	T[3] = mat32_round((((int64) F[3] * P[0]) >> 1)
+		+ (((int64) F[4] * P[3]) >> 1)
+		+ (((int64) F[5] * P[6]) >> 1));
+	T[4] = mat32_round((((int64) F[3] * P[1]) >> 1)
+		+ (((int64) F[4] * P[4]) >> 1)
+		+ (((int64) F[5] * P[7]) >> 1));
+	T[5] = mat32_round((((int64) F[3] * P[2]) >> 1)
+		+ (((int64) F[4] * P[5]) >> 1)
+		+ (((int64) F[5] * P[8]) >> 1));
+	T[6] = mat32_round((((int64) F[6] * P[0]) >> 1)
+		+ (((int64) F[7] * P[3]) >> 1)
+		+ (((int64) F[8] * P[6]) >> 1));
+	T[7] = mat32_round((((int64) F[6] * P[1]) >> 1)
+		+ (((int64) F[7] * P[4]) >> 1)
+		+ (((int64) F[8] * P[7]) >> 1));
+	T[8] = mat32_round((((int64) F[6] * P[2]) >> 1)
+		+ (((int64) F[7] * P[5]) >> 1)
+		+ (((int64) F[8] * P[8]) >> 1));
+
+	v = mat32_round((((int64) T[0] * F[0]) >> 1)
+		+ (((int64) T[1] * F[1]) >> 1)
+		+ (((int64) T[2] * F[2]) >> 1)
+		+ (int64) Q[0] * (1 << 30));
+	Pout[0] = v;
+	v = mat32_round((((int64) T[0] * F[3]) >> 1)
+		+ (((int64) T[1] * F[4]) >> 1)
+		+ (((int64) T[2] * F[5]) >> 1)
+		+ (int64) Q[1] * (1 << 30));
+	Pout[1] = Pout[3] = v;
+	v = mat32_round((((int64) T[0] * F[6]) >> 1)
+		+ (((int64) T[1] * F[7]) >> 1)
+		+ (((int64) T[2] * F[8]) >> 1)
+		+ (int64) Q[2] * (1 << 30));
+	Pout[2] = Pout[6] = v;
+	v = mat32_round((((int64) T[3] * F[3]) >> 1)
+		+ (((int64) T[4] * F[4]) >> 1)
+		+ (((int64) T[5] * F[5]) >> 1)
+		+ (int64) Q[4] * (1 << 30));
+	Pout[4] = v;
+	v = mat32_round((((int64) T[3] * F[6]) >> 1)
+		+ (((int64) T[4] * F[7]) >> 1)
+		+ (((int64) T[5] * F[8]) >> 1)
+		+ (int64) Q[5] * (1 << 30));
+	Pout[5] = Pout[7] = v;
+	v = mat32_round((((int64) T[6] * F[6]) >> 1)
+		+ (((int64) T[7] * F[7]) >> 1)
+		+ (((int64) T[8] * F[8]) >> 1)
+		+ (int64) Q[8] * (1 << 30));
+	Pout[8] = v;
+}
+
@@ -0,0 +1,76 @@
+/* generated by matgen.c */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+void mips_mat3_mul_f32(float *C, const float *A, const float *B)
+{
+	C[0] = A[0] * B[0] + A[1] * B[3] + A[2] * B[6];
+	C[1] = A[0] * B[1] + A[1] * B[4] + A[2] * B[7];
+	C[2] = A[0] * B[2] + A[1] * B[5] + A[2] * B[8];
+	C[3] = A[3] * B[0] + A[4] * B[3] + A[5] * B[6];
+	C[4] = A[3] * B[1] + A[4] * B[4] + A[5] * B[7];
+	C[5] = A[3] * B[2] + A[4] * B[5] + A[5] * B[8];
+	C[6] = A[6] * B[0] + A[7] * B[3] + A[8] * B[6];
+	C[7] = A[6] * B[1] + A[7] * B[4] + A[8] * B[7];
+	C[8] = A[6] * B[2] + A[7] * B[5] + A[8] * B[8];
+}
+
+
+void mips_mat3_mul_t_f32(float *C, const float *A, const float *B)
+{
+	C[0] = A[0] * B[0] + A[1] * B[1] + A[2] * B[2];
+	C[1] = A[0] * B[3] + A[1] * B[4] + A[2] * B[5];
+	C[2] = A[0] * B[6] + A[1] * B[7] + A[2] * B[8];
+	C[3] = A[3] * B[0] + A[4] * B[1] + A[5] * B[2];
+	C[4] = A[3] * B[3] + A[4] * B[4] + A[5] * B[5];
+	C[5] = A[3] * B[6] + A[4] * B[7] + A[5] * B[8];
+	C[6] = A[6] * B[0] + A[7] * B[1] + A[8] * B[2];
+	C[7] = A[6] * B[3] + A[7] * B[4] + A[8] * B[5];
+	C[8] = A[6] * B[6] + A[7] * B[7] + A[8] * B[8];
+}
+
+
+void mips_mat3_add_f32(float *C, const float *A, const float *B)
+{
+	C[0] = A[0] + B[0];
+	C[1] = A[1] + B[1];
+	C[2] = A[2] + B[2];
+	C[3] = A[3] + B[3];
+	C[4] = A[4] + B[4];
+	C[5] = A[5] + B[5];
+	C[6] = A[6] + B[6];
+	C[7] = A[7] + B[7];
+	C[8] = A[8] + B[8];
+}
+
+
+void mips_mat3_fpft_f32(float *Pout, const float *F, const float *P, const float *Q)
+{
+	float T[9];
+	float v;
+
+	T[0] = F[0] * P[0] + F[1] * P[3] + F[2] * P[6];
+	T[1] = F[0] * P[1] + F[1] * P[4] + F[2] * P[7];
+	T[2] = F[0] * P[2] + F[1] * P[5] + F[2] * P[8];
+	T[3] = F[3] * P[0] + F[4] * P[3] + F[5] * P[6];
+	T[4] = F[3] * P[1] + F[4] * P[4] + F[5] * P[7];
+	T[5] = F[3] * P[2] + F[4] * P[5] + F[5] * P[8];
+	T[6] = F[6] * P[0] + F[7] * P[3] + F[8] * P[6];
+	T[7] = F[6] * P[1] + F[7] * P[4] + F[8] * P[7];
+	T[8] = F[6] * P[2] + F[7] * P[5] + F[8] * P[8];
+
+	v = T[0] * F[0] + T[1] * F[1] + T[2] * F[2] + Q[0];
+	Pout[0] = v;
+	v = T[0] * F[3] + T[1] * F[4] + T[2] * F[5] + Q[1];
+	Pout[1] = Pout[3] = v;
+	v = T[0] * F[6] + T[1] * F[7] + T[2] * F[8] + Q[2];
+	Pout[2] = Pout[6] = v;
+	v = T[3] * F[3] + T[4] * F[4] + T[5] * F[5] + Q[4];
+	Pout[4] = v;
+	v = T[3] * F[6] + T[4] * F[7] + T[5] * F[8] + Q[5];
+	Pout[5] = Pout[7] = v;
+	v = T[6] * F[6] + T[7] * F[7] + T[8] * F[8] + Q[8];
+	Pout[8] = v;
+}
+
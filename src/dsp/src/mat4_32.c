@@ -0,0 +1,310 @@
+/* generated by matgen.c */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static inline int32 mat32_sat(int64 v)
+{
+	return (v > MAX32) ? MAX32 : (v < MIN32) ? MIN32 : (int32) v;
+}
+
+
+/* round a Q60 sum to Q31 and saturate */
+
+static inline int32 mat32_round(int64 v)
+{
+	return mat32_sat((v + 0x10000000) >> 29);
+}
+
+
+void mips_mat4_mul32(int32 *C, const int32 *A, const int32 *B)
+{
+	C[0] = mat32_round((((int64) A[0] * B[0]) >> 2)
+		+ (((int64) A[1] * B[4]) >> 2)
+		+ (((int64) A[2] * B[8]) >> 2)
+		+ (((int64) A[3] * B[12]) >> 2));
+	C[1] = mat32_round((((int64) A[0] * B[1]) >> 2)
+		+ (((int64) A[1] * B[5]) >> 2)
+		+ (((int64) A[2] * B[9]) >> 2)
+		+ (((int64) A[3] * B[13]) >> 2));
+	C[2] = mat32_round((((int64) A[0] * B[2]) >> 2)
+		+ (((int64) A[1] * B[6]) >> 2)
+		+ (((int64) A[2] * B[10]) >> 2)
+		+ (((int64) A[3] * B[14]) >> 2));
+	C[3] = mat32_round((((int64) A[0] * B[3]) >> 2)
+		+ (((int64) A[1] * B[7]) >> 2)
+		+ (((int64) A[2] * B[11]) >> 2)
+		+ (((int64) A[3] * B[15]) >> 2));
+	C[4] = mat32_round((((int64) A[4] * B[0]) >> 2)
+		+ (((int64) A[5] * B[4]) >> 2)
+		+ (((int64) A[6] * B[8]) >> 2)
+		+ (((int64) A[7] * B[12]) >> 2));
+	C[5] = mat32_round((((int64) A[4] * B[1]) >> 2)
+		+ (((int64) A[5] * B[5]) >> 2)
+		+ (((int64) A[6] * B[9]) >> 2)
+		+ (((int64) A[7] * B[13]) >> 2));
+	C[6] = mat32_round((((int64) A[4] * B[2]) >> 2)
+		+ (((int64) A[5] * B[6]) >> 2)
+		+ (((int64) A[6] * B[10]) >> 2)
+		+ (((int64) A[7] * B[14]) >> 2));
+	C[7] = mat32_round((((int64) A[4] * B[3]) >> 2)
+		+ (((int64) A[5] * B[7]) >> 2)
+		+ (((int64) A[6] * B[11]) >> 2)
+		+ (((int64) A[7] * B[15]) >> 2));
+	C[8] = mat32_round((((int64) A[8] * B[0]) >> 2)
+		+ (((int64) A[9] * B[4]) >> 2)
+		+ (((int64) A[10] * B[8]) >> 2)
+		+ (((int64) A[11] * B[12]) >> 2));
+	C[9] = mat32_round((((int64) A[8] * B[1]) >> 2)
+		+ (((int64) A[9] * B[5]) >> 2)
+		+ (((int64) A[10] * B[9]) >> 2)
+		+ (((int64) A[11] * B[13]) >> 2));
+	C[10] = mat32_round((((int64) A[8] * B[2]) >> 2)
+		+ (((int64) A[9] * B[6]) >> 2)
+		+ (((int64) A[10] * B[10]) >> 2)
+		+ (((int64) A[11] * B[14]) >> 2));
+	C[11] = mat32_round((((int64) A[8] * B[3]) >> 2)
+		+ (((int64) A[9] * B[7]) >> 2)
+		+ (((int64) A[10] * B[11]) >> 2)
+		+ (((int64) A[11] * B[15]) >> 2));
+	C[12] = mat32_round((((int64) A[12] * B[0]) >> 2)
+		+ (((int64) A[13] * B[4]) >> 2)
+		+ (((int64) A[14] * B[8]) >> 2)
+		+ (((int64) A[15] * B[12]) >> 2));
+	C[13] = mat32_round((((int64) A[12] * B[1]) >> 2)
+		+ (((int64) A[13] * B[5]) >> 2)
+		+ (((int64) A[14] * B[9]) >> 2)
+		+ (((int64) A[15] * B[13]) >> 2));
+	C[14] = mat32_round((((int64) A[12] * B[2]) >> 2)
+		+ (((int64) A[13] * B[6]) >> 2)
+		+ (((int64) A[14] * B[10]) >> 2)
+		+ (((int64) A[15] * B[14]) >> 2));
+	C[15] = mat32_round((((int64) A[12] * B[3]) >> 2)
+		+ (((int64) A[13] * B[7]) >> 2)
+		+ (((int64) A[14] * B[11]) >> 2)
+		+ (((int64) A[15] * B[15]) >> 2));
+}
+
+
+void mips_mat4_mul_t32(int32 *C, const int32 *A, const int32 *B)
+{
+	C[0] = mat32_round((((int64) A[0] * B[0]) >> 2)
+		+ (((int64) A[1] * B[1]) >> 2)
+		+ (((int64) A[2] * B[2]) >> 2)
+		+ (((int64) A[3] * B[3]) >> 2));
+	C[1] = mat32_round((((int64) A[0] * B[4]) >> 2)
+		+ (((int64) A[1] * B[5]) >> 2)
+		+ (((int64) A[2] * B[6]) >> 2)
+		+ (((int64) A[3] * B[7]) >> 2));
+	C[2] = mat32_round((((int64) A[0] * B[8]) >> 2)
+		+ (((int64) A[1] * B[9]) >> 2)
+		+ (((int64) A[2] * B[10]) >> 2)
+		+ (((int64) A[3] * B[11]) >> 2));
+	C[3] = mat32_round((((int64) A[0] * B[12]) >> 2)
+		+ (((int64) A[1] * B[13]) >> 2)
+		+ (((int64) A[2] * B[14]) >> 2)
+		+ (((int64) A[3] * B[15]) >> 2));
+	C[4] = mat32_round((((int64) A[4] * B[0]) >> 2)
+		+ (((int64) A[5] * B[1]) >> 2)
+		+ (((int64) A[6] * B[2]) >> 2)
+		+ (((int64) A[7] * B[3]) >> 2));
+	C[5] = mat32_round((((int64) A[4] * B[4]) >> 2)
+		+ (((int64) A[5] * B[5]) >> 2)
+		+ (((int64) A[6] * B[6]) >> 2)
+		+ (((int64) A[7] * B[7]) >> 2));
+	C[6] = mat32_round((((int64) A[4] * B[8]) >> 2)
+		+ (((int64) A[5] * B[9]) >> 2)
+		+ (((int64) A[6] * B[10]) >> 2)
+		+ (((int64) A[7] * B[11]) >> 2));
+	C[7] = mat32_round((((int64) A[4] * B[12]) >> 2)
+		+ (((int64) A[5] * B[13]) >> 2)
+		+ (((int64) A[6] * B[14]) >> 2)
+		+ (((int64) A[7] * B[15]) >> 2));
+	C[8] = mat32_round((((int64) A[8] * B[0]) >> 2)
+		+ (((int64) A[9] * B[1]) >> 2)
+		+ (((int64) A[10] * B[2]) >> 2)
+		+ (((int64) A[11] * B[3]) >> 2));
+	C[9] = mat32_round((((int64) A[8] * B[4]) >> 2)
+		+ (((int64) A[9] * B[5]) >> 2)
+		+ (((int64) A[10] * B[6]) >> 2)
+		+ (((int64) A[11] * B[7]) >> 2));
+	C[10] = mat32_round((((int64) A[8] * B[8]) >> 2)
+		+ (((int64) A[9] * B[9]) >> 2)
+		+ (((int64) A[10] * B[10]) >> 2)
+		+ (((int64) A[11] * B[11]) >> 2));
+	C[11] = mat32_round((((int64) A[8] * B[12]) >> 2)
+		+ (((int64) A[9] * B[13]) >> 2)
+		+ (((int64) A[10] * B[14]) >> 2)
+		+ (((int64) A[11] * B[15]) >> 2));
+	C[12] = mat32_round((((int64) A[12] * B[0]) >> 2)
+		+ (((int64) A[13] * B[1]) >> 2)
+		+ (((int64) A[14] * B[2]) >> 2)
+		+ (((int64) A[15] * B[3]) >> 2));
+	C[13] = mat32_round((((int64) A[12] * B[4]) >> 2)
+		+ (((int64) A[13] * B[5]) >> 2)
+		+ (((int64) A[14] * B[6]) >> 2)
+		+ (((int64) A[15] * B[7]) >> 2));
+	C[14] = mat32_round((((int64) A[12] * B[8]) >> 2)
+		+ (((int64) A[13] * B[9]) >> 2)
+		+ (((int64) A[14] * B[10]) >> 2)
+		+ (((int64) A[15] * B[11]) >> 2));
+	C[15] = mat32_round((((int64) A[12] * B[12]) >> 2)
+		+ (((int64) A[13] * B[13]) >> 2)
+		+ (((int64) A[14] * B[14]) >> 2)
+		+ (((int64) A[15] * B[15]) >> 2));
+}
+
+
+void mips_mat4_add32(int32 *C, const int32 *A, const int32 *B)
+{
+	C[0] = mat32_sat((int64) A[0] + B[0]);
+	C[1] = mat32_sat((int64) A[1] + B[1]);
+	C[2] = mat32_sat((int64) A[2] + B[2]);
+	C[3] = mat32_sat((int64) A[3] + B[3]);
+	C[4] = mat32_sat((int64) A[4] + B[4]);
+	C[5] = mat32_sat((int64) A[5] + B[5]);
+	C[6] = mat32_sat((int64) A[6] + B[6]);
+	C[7] = mat32_sat((int64) A[7] + B[7]);
+	C[8] = mat32_sat((int64) A[8] + B[8]);
+	C[9] = mat32_sat((int64) A[9] + B[9]);
+	C[10] = mat32_sat((int64) A[10] + B[10]);
+	C[11] = mat32_sat((int64) A[11] + B[11]);
+	C[12] = mat32_sat((int64) A[12] + B[12]);
+	C[13] = mat32_sat((int64) A[13] + B[13]);
+	C[14] = mat32_sat((int64) A[14] + B[14]);
+	C[15] = mat32_sat((int64) A[15] + B[15]);
+}
+
+
+void mips_mat4_fpft32(int32 *Pout, const int32 *F, const int32 *P, const int32 *Q)
+{
+	int32 T[16];
+	int32 v;
+
+	T[0] = mat32_round((((int64) F[0] * P[0]) >> 2)
+		+ (((int64) F[1] * P[4]) >> 2)
+		+ (((int64) F[2] * P[8]) >> 2)
+		+ (((int64) F[3] * P[12]) >> 2));
+	T[1] = mat32_round((((int64) F[0] * P[1]) >> 2)
+		+ (((int64) F[1] * P[5]) >> 2)
+		+ (((int64) F[2] * P[9]) >> 2)
+		+ (((int64) F[3] * P[13]) >> 2));
+	T[2] = mat32_round((((int64) F[0] * P[2]) >> 2)
+		+ (((int64) F[1] * P[6]) >> 2)
+		+ (((int64) F[2] * P[10]) >> 2)
+		+ (((int64) F[3] * P[14]) >> 2));
+	T[3] = mat32_round((((int64) F[0] * P[3]) >> 2)
+		+ (((int64) F[1] * P[7]) >> 2)
+		+ (((int64) F[2] * P[11]) >> 2)
+		+ (((int64) F[3] * P[15]) >> 2));
+	T[4] = mat32_round((((int64) F[4] * P[0]) >> 2)
+		+ (((int64) F[5] * P[4]) >> 2)
+		+ (((int64) F[6] * P[8]) >> 2)
+		+ (((int64) F[7] * P[12]) >> 2));
+	T[5] = mat32_round((((int64) F[4] * P[1]) >> 2)
+		+ (((int64) F[5] * P[5]) >> 2)
+		+ (((int64) F[6] * P[9]) >> 2)
+		+ (((int64) F[7] * P[13]) >> 2));
+	T[6] = mat32_round((((int64) F[4] * P[2]) >> 2)
+		+ (((int64) F[5] * P[6]) >> 2)
+		+ (((int64) F[6] * P[10]) >> 2)
+		+ (((int64) F[7] * P[14]) >> 2));
+	T[7] = mat32_round((((int64) F[4] * P[3]) >> 2)
+		+ (((int64) F[5] * P[7]) >> 2)
+		+ (((int64) F[6] * P[11]) >> 2)
+		+ (((int64) F[7] * P[15]) >> 2));
+	T[8] = mat32_round((((int64) F[8] * P[0]) >> 2)
+		+ (((int64) F[9] * P[4]) >> 2)
+		+ (((int64) F[10] * P[8]) >> 2)
+		+ (((int64) F[11] * P[12]) >> 2));
+	T[9] = mat32_round((((int64) F[8] * P[1]) >> 2)
+		+ (((int64) F[9] * P[5]) >> 2)
+		+ (((int64) F[10] * P[9]) >> 2)
+		+ (((int64) F[11] * P[13]) >> 2));
+	T[10] = mat32_round((((int64) F[8] * P[2]) >> 2)
+		+ (((int64) F[9] * P[6]) >> 2)
+		+ (((int64) F[10] * P[10]) >> 2)
+		+ (((int64) F[11] * P[14]) >> 2));
+	T[11] = mat32_round((((int64) F[8] * P[3]) >> 2)
+		+ (((int64) F[9] * P[7]) >> 2)
+		+ (((int64) F[10] * P[11]) >> 2)
+		+ (((int64) F[11] * P[15]) >> 2));
+	T[12] = mat32_round((((int64) F[12] * P[0]) >> 2)
+		+ (((int64) F[13] * P[4]) >> 2)
+		+ (((int64) F[14] * P[8]) >> 2)
+		+ (((int64) F[15] * P[12]) >> 2));
+	T[13] = mat32_round((((int64) F[12] * P[1]) >> 2)
+		+ (((int64) F[13] * P[5]) >> 2)
+		+ (((int64) F[14] * P[9]) >> 2)
+		+ (((int64) F[15] * P[13]) >> 2));
+	T[14] = mat32_round((((int64) F[12] * P[2]) >> 2)
+		+ (((int64) F[13] * P[6]) >> 2)
+		+ (((int64) F[14] * P[10]) >> 2)
+		+ (((int64) F[15] * P[14]) >> 2));
+	T[15] = mat32_round((((int64) F[12] * P[3]) >> 2)
+		+ (((int64) F[13] * P[7]) >> 2)
+		+ (((int64) F[14] * P[11]) >> 2)
+		+ (((int64) F[15] * P[15]) >> 2));
+
+	v = mat32_round((((int64) T[0] * F[0]) >> 2)
+		+ (((int64) T[1] * F[1]) >> 2)
+		+ (((int64) T[2] * F[2]) >> 2)
+		+ (((int64) T[3] * F[3]) >> 2)
+		+ (int64) Q[0] * (1 << 29));
+	Pout[0] = v;
+	v = mat32_round((((int64) T[0] * F[4]) >> 2)
+		+ (((int64) T[1] * F[5]) >> 2)
+		+ (((int64) T[2] * F[6]) >> 2)
+		+ (((int64) T[3] * F[7]) >> 2)
+		+ (int64) Q[1] * (1 << 29));
+	Pout[1] = Pout[4] = v;
+	v = mat32_round((((int64) T[0] * F[8]) >> 2)
+		+ (((int64) T[1] * F[9]) >> 2)
+		+ (((int64) T[2] * F[10]) >> 2)
+		+ (((int64) T[3] * F[11]) >> 2)
+		+ (int64) Q[2] * (1 << 29));
+	Pout[2] = Pout[8] = v;
+	v = mat32_round((((int64) T[0] * F[12]) >> 2)
+		+ (((int64) T[1] * F[13]) >> 2)
+		+ (((int64) T[2] * F[14]) >> 2)
+		+ (((int64) T[3] * F[15]) >> 2)
+		+ (int64) Q[3] * (1 << 29));
+	Pout[3] = Pout[12] = v;
+	v = mat32_round((((int64) T[4] * F[4]) >> 2)
+		+ (((int64) T[5] * F[5]) >> 2)
+		+ (((int64) T[6] * F[6]) >> 2)
+		+ (((int64) T[7] * F[7]) >> 2)
+		+ (int64) Q[5] * (1 << 29));
+	Pout[5] = v;
+	v = mat32_round((((int64) T[4] * F[8]) >> 2)
+		+ (((int64) T[5] * F[9]) >> 2)
+		+ (((int64) T[6] * F[10]) >> 2)
+		+ (((int64) T[7] * F[11]) >> 2)
+		+ (int64) Q[6] * (1 << 29));
+	Pout[6] = Pout[9] = v;
+	v = mat32_round((((int64) T[4] * F[12]) >> 2)
+		+ (((int64) T[5] * F[13]) >> 2)
+		+ (((int64) T[6] * F[14]) >> 2)
+		+ (((int64) T[7] * F[15]) >> 2)
+		+ (int64) Q[7] * (1 << 29));
+	Pout[7] = Pout[13] = v;
+	v = mat32_round((((int64) T[8] * F[8]) >> 2)
+		+ (((int64) T[9] * F[9]) >> 2)
+		+ (((int64) T[10] * F[10]) >> 2)
+		+ (((int64) T[11] * F[11]) >> 2)
+		+ (int64) Q[10] * (1 << 29));
+	Pout[10] = v;
+	v = mat32_round((((int64) T[8] * F[12]) >> 2)
+		+ (((int64) T[9] * F[13]) >> 2)
+		+ (((int64) T[10] * F[14]) >> 2)
+		+ (((int64) T[11] * F[15]) >> 2)
+		+ (int64) Q[11] * (1 << 29));
+	Pout[11] = Pout[14] = v;
+	v = mat32_round((((int64) T[12] * F[12]) >> 2)
+		+ (((int64) T[13] * F[13]) >> 2)
+		+ (((int64) T[14] * F[14]) >> 2)
+		+ (((int64) T[15] * F[15]) >> 2)
+		+ (int64) Q[15] * (1 << 29));
+	Pout[15] = v;
+}
+
@@ -0,0 +1,112 @@
+/* generated by matgen.c */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+void mips_mat4_mul_f32(float *C, const float *A, const float *B)
+{
+	C[0] = A[0] * B[0] + A[1] * B[4] + A[2] * B[8] + A[3] * B[12];
+	C[1] = A[0] * B[1] + A[1] * B[5] + A[2] * B[9] + A[3] * B[13];
+	C[2] = A[0] * B[2] + A[1] * B[6] + A[2] * B[10] + A[3] * B[14];
+	C[3] = A[0] * B[3] + A[1] * B[7] + A[2] * B[11] + A[3] * B[15];
+	C[4] = A[4] * B[0] + A[5] * B[4] + A[6] * B[8] + A[7] * B[12];
+	C[5] = A[4] * B[1] + A[5] * B[5] + A[6] * B[9] + A[7] * B[13];
+	C[6] = A[4] * B[2] + A[5] * B[6] + A[6] * B[10] + A[7] * B[14];
+	C[7] = A[4] * B[3] + A[5] * B[7] + A[6] * B[11] + A[7] * B[15];
+	C[8] = A[8] * B[0] + A[9] * B[4] + A[10] * B[8] + A[11] * B[12];
+	C[9] = A[8] * B[1] + A[9] * B[5] + A[10] * B[9] + A[11] * B[13];
+	C[10] = A[8] * B[2] + A[9] * B[6] + A[10] * B[10] + A[11] * B[14];
+	C[11] = A[8] * B[3] + A[9] * B[7] + A[10] * B[11] + A[11] * B[15];
+	C[12] = A[12] * B[0] + A[13] * B[4] + A[14] * B[8] + A[15] * B[12];
+	C[13] = A[12] * B[1] + A[13] * B[5] + A[14] * B[9] + A[15] * B[13];
+	C[14] = A[12] * B[2] + A[13] * B[6] + A[14] * B[10] + A[15] * B[14];
+	C[15] = A[12] * B[3] + A[13] * B[7] + A[14] * B[11] + A[15] * B[15];
+}
+
+
+void mips_mat4_mul_t_f32(float *C, const float *A, const float *B)
+{
+	C[0] = A[0] * B[0] + A[1] * B[1] + A[2] * B[2] + A[3] * B[3];
+	C[1] = A[0] * B[4] + A[1] * B[5] + A[2] * B[6] + A[3] * B[7];
+	C[2] = A[0] * B[8] + A[1] * B[9] + A[2] * B[10] + A[3] * B[11];
+	C[3] = A[0] * B[12] + A[1] * B[13] + A[2] * B[14] + A[3] * B[15];
+	C[4] = A[4] * B[0] + A[5] * B[1] + A[6] * B[2] + A[7] * B[3];
+	C[5] = A[4] * B[4] + A[5] * B[5] + A[6] * B[6] + A[7] * B[7];
+	C[6] = A[4] * B[8] + A[5] * B[9] + A[6] * B[10] + A[7] * B[11];
+	C[7] = A[4] * B[12] + A[5] * B[13] + A[6] * B[14] + A[7] * B[15];
+	C[8] = A[8] * B[0] + A[9] * B[1] + A[10] * B[2] + A[11] * B[3];
+	C[9] = A[8] * B[4] + A[9] * B[5] + A[10] * B[6] + A[11] * B[7];
+	C[10] = A[8] * B[8] + A[9] * B[9] + A[10] * B[10] + A[11] * B[11];
+	C[11] = A[8] * B[12] + A[9] * B[13] + A[10] * B[14] + A[11] * B[15];
+	C[12] = A[12] * B[0] + A[13] * B[1] + A[14] * B[2] + A[15] * B[3];
+	C[13] = A[12] * B[4] + A[13] * B[5] + A[14] * B[6] + A[15] * B[7];
+	C[14] = A[12] * B[8] + A[13] * B[9] + A[14] * B[10] + A[15] * B[11];
+	C[15] = A[12] * B[12] + A[13] * B[13] + A[14] * B[14] + A[15] * B[15];
+}
+
+
+void mips_mat4_add_f32(float *C, const float *A, const float *B)
+{
+	C[0] = A[0] + B[0];
+	C[1] = A[1] + B[1];
+	C[2] = A[2] + B[2];
+	C[3] = A[3] + B[3];
+	C[4] = A[4] + B[4];
+	C[5] = A[5] + B[5];
+	C[6] = A[6] + B[6];
+	C[7] = A[7] + B[7];
+	C[8] = A[8] + B[8];
+	C[9] = A[9] + B[9];
+	C[10] = A[10] + B[10];
+	C[11] = A[11] + B[11];
+	C[12] = A[12] + B[12];
+	C[13] = A[13] + B[13];
+	C[14] = A[14] + B[14];
+	C[15] = A[15] + B[15];
+}
+
+
+void mips_mat4_fpft_f32(float *Pout, const float *F, const float *P, const float *Q)
+{
+	float T[16];
+	float v;
+
+	T[0] = F[0] * P[0] + F[1] * P[4] + F[2] * P[8] + F[3] * P[12];
+	T[1] = F[0] * P[1] + F[1] * P[5] + F[2] * P[9] + F[3] * P[13];
+	T[2] = F[0] * P[2] + F[1] * P[6] + F[2] * P[10] + F[3] * P[14];
+	T[3] = F[0] * P[3] + F[1] * P[7] + F[2] * P[11] + F[3] * P[15];
+	T[4] = F[4] * P[0] + F[5] * P[4] + F[6] * P[8] + F[7] * P[12];
+	T[5] = F[4] * P[1] + F[5] * P[5] + F[6] * P[9] + F[7] * P[13];
+	T[6] = F[4] * P[2] + F[5] * P[6] + F[6] * P[10] + F[7] * P[14];
+	T[7] = F[4] * P[3] + F[5] * P[7] + F[6] * P[11] + F[7] * P[15];
+	T[8] = F[8] * P[0] + F[9] * P[4] + F[10] * P[8] + F[11] * P[12];
+	T[9] = F[8] * P[1] + F[9] * P[5] + F[10] * P[9] + F[11] * P[13];
+	T[10] = F[8] * P[2] + F[9] * P[6] + F[10] * P[10] + F[11] * P[14];
+	T[11] = F[8] * P[3] + F[9] * P[7] + F[10] * P[11] + F[11] * P[15];
+	T[12] = F[12] * P[0] + F[13] * P[4] + F[14] * P[8] + F[15] * P[12];
+	T[13] = F[12] * P[1] + F[13] * P[5] + F[14] * P[9] + F[15] * P[13];
+	T[14] = F[12] * P[2] + F[13] * P[6] + F[14] * P[10] + F[15] * P[14];
+	T[15] = F[12] * P[3] + F[13] * P[7] + F[14] * P[11] + F[15] * P[15];
+
+	v = T[0] * F[0] + T[1] * F[1] + T[2] * F[2] + T[3] * F[3] + Q[0];
+	Pout[0] = v;
+	v = T[0] * F[4] + T[1] * F[5] + T[2] * F[6] + T[3] * F[7] + Q[1];
+	Pout[1] = Pout[4] = v;
+	v = T[0] * F[8] + T[1] * F[9] + T[2] * F[10] + T[3] * F[11] + Q[2];
+	Pout[2] = Pout[8] = v;
+	v = T[0] * F[12] + T[1] * F[13] + T[2] * F[14] + T[3] * F[15] + Q[3];
+	Pout[3] = Pout[12] = v;
+	v = T[4] * F[4] + T[5] * F[5] + T[6] * F[6] + T[7] * F[7] + Q[5];
+	Pout[5] = v;
+	v = T[4] * F[8] + T[5] * F[9] + T[6] * F[10] + T[7] * F[11] + Q[6];
+	Pout[6] = Pout[9] = v;
+	v = T[4] * F[12] + T[5] * F[13] + T[6] * F[14] + T[7] * F[15] + Q[7];
+	Pout[7] = Pout[13] = v;
+	v = T[8] * F[8] + T[9] * F[9] + T[10] * F[10] + T[11] * F[11] + Q[10];
+	Pout[10] = v;
+	v = T[8] * F[12] + T[9] * F[13] + T[10] * F[14] + T[11] * F[15] + Q[11];
+	Pout[11] = Pout[14] = v;
+	v = T[12] * F[12] + T[13] * F[13] + T[14] * F[14] + T[15] * F[15] + Q[15];
+	Pout[15] = v;
+}
+
@@ -0,0 +1,894 @@
+/* generated by matgen.c */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static inline int32 mat32_sat(int64 v)
+{
+	return (v > MAX32) ? MAX32 : (v < MIN32) ? MIN32 : (int32) v;
+}
+
+
+/* round a Q60 sum to Q31 and saturate */
+
+static inline int32 mat32_round(int64 v)
+{
+	return mat32_sat((v + 0x10000000) >> 29);
+}
+
+
+void mips_mat6_mul32(int32 *C, const int32 *A, const int32 *B)
+{
+	C[0] = mat32_round((((int64) A[0] * B[0]) >> 2)
+		+ (((int64) A[1] * B[6]) >> 2)
+		+ (((int64) A[2] * B[12]) >> 2)
+		+ (((int64) A[3] * B[18]) >> 2)
+		+ (((int64) A[4] * B[24]) >> 2)
+		+ (((int64) A[5] * B[30]) >> 2));
+	C[1] = mat32_round((((int64) A[0] * B[1]) >> 2)
+		+ (((int64) A[1] * B[7]) >> 2)
+		+ (((int64) A[2] * B[13]) >> 2)
+		+ (((int64) A[3] * B[19]) >> 2)
+		+ (((int64) A[4] * B[25]) >> 2)
+		+ (((int64) A[5] * B[31]) >> 2));
+	C[2] = mat32_round((((int64) A[0] * B[2]) >> 2)
+		+ (((int64) A[1] * B[8]) >> 2)
+		+ (((int64) A[2] * B[14]) >> 2)
+		+ (((int64) A[3] * B[20]) >> 2)
+		+ (((int64) A[4] * B[26]) >> 2)
+		+ (((int64) A[5] * B[32]) >> 2));
+	C[3] = mat32_round((((int64) A[0] * B[3]) >> 2)
+		+ (((int64) A[1] * B[9]) >> 2)
+		+ (((int64) A[2] * B[15]) >> 2)
+		+ (((int64) A[3] * B[21]) >> 2)
+		+ (((int64) A[4] * B[27]) >> 2)
+		+ (((int64) A[5] * B[33]) >> 2));
+	C[4] = mat32_round((((int64) A[0] * B[4]) >> 2)
+		+ (((int64) A[1] * B[10]) >> 2)
+		+ (((int64) A[2] * B[16]) >> 2)
+		+ (((int64) A[3] * B[22]) >> 2)
+		+ (((int64) A[4] * B[28]) >> 2)
+		+ (((int64) A[5] * B[34]) >> 2));
+	C[5] = mat32_round((((int64) A[0] * B[5]) >> 2)
+		+ (((int64) A[1] * B[11]) >> 2)
+		+ (((int64) A[2] * B[17]) >> 2)
+		+ (((int64) A[3] * B[23]) >> 2)
+		+ (((int64) A[4] * B[29]) >> 2)
+		+ (((int64) A[5] * B[35]) >> 2));
+	C[6] = mat32_round((((int64) A[6] * B[0]) >> 2)
+		+ (((int64) A[7] * B[6]) >> 2)
+		+ (((int64) A[8] * B[12]) >> 2)
+		+ (((int64) A[9] * B[18]) >> 2)
+		+ (((int64) A[10] * B[24]) >> 2)
+		+ (((int64) A[11] * B[30]) >> 2));
+	C[7] = mat32_round((((int64) A[6] * B[1]) >> 2)
+		+ (((int64) A[7] * B[7]) >> 2)
+		+ (((int64) A[8] * B[13]) >> 2)
+		+ (((int64) A[9] * B[19]) >> 2)
+		+ (((int64) A[10] * B[25]) >> 2)
+		+ (((int64) A[11] * B[31]) >> 2));
+	C[8] = mat32_round((((int64) A[6] * B[2]) >> 2)
+		+ (((int64) A[7] * B[8]) >> 2)
+		+ (((int64) A[8] * B[14]) >> 2)
+		+ (((int64) A[9] * B[20]) >> 2)
+		+ (((int64) A[10] * B[26]) >> 2)
+		+ (((int64) A[11] * B[32]) >> 2));
+	C[9] = mat32_round((((int64) A[6] * B[3]) >> 2)
+		+ (((int64) A[7] * B[9]) >> 2)
+		+ (((int64) A[8] * B[15]) >> 2)
+		+ (((int64) A[9] * B[21]) >> 2)
+		+ (((int64) A[10] * B[27]) >> 2)
+		+ (((int64) A[11] * B[33]) >> 2));
+	C[10] = mat32_round((((int64) A[6] * B[4]) >> 2)
+		+ (((int64) A[7] * B[10]) >> 2)
+		+ (((int64) A[8] * B[16]) >> 2)
+		+ (((int64) A[9] * B[22]) >> 2)
+		+ (((int64) A[10] * B[28]) >> 2)
+		+ (((int64) A[11] * B[34]) >> 2));
+	C[11] = mat32_round((((int64) A[6] * B[5]) >> 2)
+		+ (((int64) A[7] * B[11]) >> 2)
+		+ (((int64) A[8] * B[17]) >> 2)
+		+ (((int64) A[9] * B[23]) >> 2)
+		+ (((int64) A[10] * B[29]) >> 2)
+		+ (((int64) A[11] * B[35]) >> 2));
+	C[12] = mat32_round((((int64) A[12] * B[0]) >> 2)
+		+ (((int64) A[13] * B[6]) >> 2)
+		+ (((int64) A[14] * B[12]) >> 2)
+		+ (((int64) A[15] * B[18]) >> 2)
+		+ (((int64) A[16] * B[24]) >> 2)
+		+ (((int64) A[17] * B[30]) >> 2));
+	C[13] = mat32_round((((int64) A[12] * B[1]) >> 2)
+		+ (((int64) A[13] * B[7]) >> 2)
+		+ (((int64) A[14] * B[13]) >> 2)
+		+ (((int64) A[15] * B[19]) >> 2)
+		+ (((int64) A[16] * B[25]) >> 2)
+		+ (((int64) A[17] * B[31]) >> 2));
+	C[14] = mat32_round((((int64) A[12] * B[2]) >> 2)
+		+ (((int64) A[13] * B[8]) >> 2)
+		+ (((int64) A[14] * B[14]) >> 2)
+		+ (((int64) A[15] * B[20]) >> 2)
+		+ (((int64) A[16] * B[26]) >> 2)
+		+ (((int64) A[17] * B[32]) >> 2));
+	C[15] = mat32_round((((int64) A[12] * B[3]) >> 2)
+		+ (((int64) A[13] * B[9]) >> 2)
+		+ (((int64) A[14] * B[15]) >> 2)
+		+ (((int64) A[15] * B[21]) >> 2)
+		+ (((int64) A[16] * B[27]) >> 2)
+		+ (((int64) A[17] * B[33]) >> 2));
+	C[16] = mat32_round((((int64) A[12] * B[4]) >> 2)
+		+ (((int64) A[13] * B[10]) >> 2)
+		+ (((int64) A[14] * B[16]) >> 2)
+		+ (((int64) A[15] * B[22]) >> 2)
+		+ (((int64) A[16] * B[28]) >> 2)
+		+ (((int64) A[17] * B[34]) >> 2));
+	C[17] = mat32_round((((int64) A[12] * B[5]) >> 2)
+		+ (((int64) A[13] * B[11]) >> 2)
+		+ (((int64) A[14] * B[17]) >> 2)
+		+ (((int64) A[15] * B[23]) >> 2)
+		+ (((int64) A[16] * B[29]) >> 2)
+		+ (((int64) A[17] * B[35]) >> 2));
+	C[18] = mat32_round((((int64) A[18] * B[0]) >> 2)
+		+ (((int64) A[19] * B[6]) >> 2)
+		+ (((int64) A[20] * B[12]) >> 2)
+		+ (((int64) A[21] * B[18]) >> 2)
+		+ (((int64) A[22] * B[24]) >> 2)
+		+ (((int64) A[23] * B[30]) >> 2));
+	C[19] = mat32_round((((int64) A[18] * B[1]) >> 2)
+		+ (((int64) A[19] * B[7]) >> 2)
+		+ (((int64) A[20] * B[13]) >> 2)
+		+ (((int64) A[21] * B[19]) >> 2)
+		+ (((int64) A[22] * B[25]) >> 2)
+		+ (((int64) A[23] * B[31]) >> 2));
+	C[20] = mat32_round((((int64) A[18] * B[2]) >> 2)
+		+ (((int64) A[19] * B[8]) >> 2)
+		+ (((int64) A[20] * B[14]) >> 2)
+		+ (((int64) A[21] * B[20]) >> 2)
+		+ (((int64) A[22] * B[26]) >> 2)
+		+ (((int64) A[23] * B[32]) >> 2));
+	C[21] = mat32_round((((int64) A[18] * B[3]) >> 2)
+		+ (((int64) A[19] * B[9]) >> 2)
+		+ (((int64) A[20] * B[15]) >> 2)
+		+ (((int64) A[21] * B[21]) >> 2)
+		+ (((int64) A[22] * B[27]) >> 2)
+		+ (((int64) A[23] * B[33]) >> 2));
+	C[22] = mat32_round((((int64) A[18] * B[4]) >> 2)
+		+ (((int64) A[19] * B[10]) >> 2)
+		+ (((int64) A[20] * B[16]) >> 2)
+		+ (((int64) A[21] * B[22]) >> 2)
+		+ (((int64) A[22] * B[28]) >> 2)
+		+ (((int64) A[23] * B[34]) >> 2));
+	C[23] = mat32_round((((int64) A[18] * B[5]) >> 2)
+		+ (((int64) A[19] * B[11]) >> 2)
+		+ (((int64) A[20] * B[17]) >> 2)
+		+ (((int64) A[21] * B[23]) >> 2)
+		+ (((int64) A[22] * B[29]) >> 2)
+		+ (((int64) A[23] * B[35]) >> 2));
+	C[24] = mat32_round((((int64) A[24] * B[0]) >> 2)
+		+ (((int64) A[25] * B[6]) >> 2)
+		+ (((int64) A[26] * B[12]) >> 2)
+		+ (((int64) A[27] * B[18]) >> 2)
+		+ (((int64) A[28] * B[24]) >> 2)
+		+ (((int64) A[29] * B[30]) >> 2));
+	C[25] = mat32_round((((int64) A[24] * B[1]) >> 2)
+		+ (((int64) A[25] * B[7]) >> 2)
+		+ (((int64) A[26] * B[13]) >> 2)
+		+ (((int64) A[27] * B[19]) >> 2)
+		+ (((int64) A[28] * B[25]) >> 2)
+		+ (((int64) A[29] * B[31]) >> 2));
+	C[26] = mat32_round((((int64) A[24] * B[2]) >> 2)
+		+ (((int64) A[25] * B[8]) >> 2)
+		+ (((int64) A[26] * B[14]) >> 2)
+		+ (((int64) A[27] * B[20]) >> 2)
+		+ (((int64) A[28] * B[26]) >> 2)
+		+ (((int64) A[29] * B[32]) >> 2));
+	C[27] = mat32_round((((int64) A[24] * B[3]) >> 2)
+		+ (((int64) A[25] * B[9]) >> 2)
+		+ (((int64) A[26] * B[15]) >> 2)
+		+ (((int64) A[27] * B[21]) >> 2)
+		+ (((int64) A[28] * B[27]) >> 2)
+		+ (((int64) A[29] * B[33]) >> 2));
+	C[28] = mat32_round((((int64) A[24] * B[4]) >> 2)
+		+ (((int64) A[25] * B[10]) >> 2)
+		+ (((int64) A[26] * B[16]) >> 2)
+		+ (((int64) A[27] * B[22]) >> 2)
+		+ (((int64) A[28] * B[28]) >> 2)
+		+ (((int64) A[29] * B[34]) >> 2));
+	C[29] = mat32_round((((int64) A[24] * B[5]) >> 2)
+		+ (((int64) A[25] * B[11]) >> 2)
+		+ (((int64) A[26] * B[17]) >> 2)
+		+ (((int64) A[27] * B[23]) >> 2)
+		+ (((int64) A[28] * B[29]) >> 2)
+		+ (((int64) A[29] * B[35]) >> 2));
+	C[30] = mat32_round((((int64) A[30] * B[0]) >> 2)
+		+ (((int64) A[31] * B[6]) >> 2)
+		+ (((int64) A[32] * B[12]) >> 2)
+		+ (((int64) A[33] * B[18]) >> 2)
+		+ (((int64) A[34] * B[24]) >> 2)
+		+ (((int64) A[35] * B[30]) >> 2));
+	C[31] = mat32_round((((int64) A[30] * B[1]) >> 2)
+		+ (((int64) A[31] * B[7]) >> 2)
+		+ (((int64) A[32] * B[13]) >> 2)
+		+ (((int64) A[33] * B[19]) >> 2)
+		+ (((int64) A[34] * B[25]) >> 2)
+		+ (((int64) A[35] * B[31]) >> 2));
+	C[32] = mat32_round((((int64) A[30] * B[2]) >> 2)
+		+ (((int64) A[31] * B[8]) >> 2)
+		+ (((int64) A[32] * B[14]) >> 2)
+		+ (((int64) A[33] * B[20]) >> 2)
+		+ (((int64) A[34] * B[26]) >> 2)
+		+ (((int64) A[35] * B[32]) >> 2));
+	C[33] = mat32_round((((int64) A[30] * B[3]) >> 2)
+		+ (((int64) A[31] * B[9]) >> 2)
+		+ (((int64) A[32] * B[15]) >> 2)
+		+ (((int64) A[33] * B[21]) >> 2)
+		+ (((int64) A[34] * B[27]) >> 2)
+		+ (((int64) A[35] * B[33]) >> 2));
+	C[34] = mat32_round((((int64) A[30] * B[4]) >> 2)
+		+ (((int64) A[31] * B[10]) >> 2)
+		+ (((int64) A[32] * B[16]) >> 2)
+		+ (((int64) A[33] * B[22]) >> 2)
+		+ (((int64) A[34] * B[28]) >> 2)
+		+ (((int64) A[35] * B[34]) >> 2));
+	C[35] = mat32_round((((int64) A[30] * B[5]) >> 2)
+		+ (((int64) A[31] * B[11]) >> 2)
+		+ (((int64) A[32] * B[17]) >> 2)
+		+ (((int64) A[33] * B[23]) >> 2)
+		+ (((int64) A[34] * B[29]) >> 2)
+		+ (((int64) A[35] * B[35]) >> 2));
+}
+
+
+void mips_mat6_mul_t32(int32 *C, const int32 *A, const int32 *B)
+{
+	C[0] = mat32_round((((int64) A[0] * B[0]) >> 2)
+		+ (((int64) A[1] * B[1]) >> 2)
+		+ (((int64) A[2] * B[2]) >> 2)
+		+ (((int64) A[3] * B[3]) >> 2)
+		+ (((int64) A[4] * B[4]) >> 2)
+		+ (((int64) A[5] * B[5]) >> 2));
+	C[1] = mat32_round((((int64) A[0] * B[6]) >> 2)
+		+ (((int64) A[1] * B[7]) >> 2)
+		+ (((int64) A[2] * B[8]) >> 2)
+		+ (((int64) A[3] * B[9]) >> 2)
+		+ (((int64) A[4] * B[10]) >> 2)
+		+ (((int64) A[5] * B[11]) >> 2));
+	C[2] = mat32_round((((int64) A[0] * B[12]) >> 2)
+		+ (((int64) A[1] * B[13]) >> 2)
+		+ (((int64) A[2] * B[14]) >> 2)
+		+ (((int64) A[3] * B[15]) >> 2)
+		+ (((int64) A[4] * B[16]) >> 2)
+		+ (((int64) A[5] * B[17]) >> 2));
+	C[3] = mat32_round((((int64) A[0] * B[18]) >> 2)
+		+ (((int64) A[1] * B[19]) >> 2)
+		+ (((int64) A[2] * B[20]) >> 2)
+		+ (((int64) A[3] * B[21]) >> 2)
+		+ (((int64) A[4] * B[22]) >> 2)
+		+ (((int64) A[5] * B[23]) >> 2));
+	C[4] = mat32_round((((int64) A[0] * B[24]) >> 2)
+		+ (((int64) A[1] * B[25]) >> 2)
+		+ (((int64) A[2] * B[26]) >> 2)
+		+ (((int64) A[3] * B[27]) >> 2)
+		+ (((int64) A[4] * B[28]) >> 2)
+		+ (((int64) A[5] * B[29]) >> 2));
+	C[5] = mat32_round((((int64) A[0] * B[30]) >> 2)
+		+ (((int64) A[1] * B[31]) >> 2)
+		+ (((int64) A[2] * B[32]) >> 2)
+		+ (((int64) A[3] * B[33]) >> 2)
+		+ (((int64) A[4] * B[34]) >> 2)
+		+ (((int64) A[5] * B[35]) >> 2));
+	C[6] = mat32_round((((int64) A[6] * B[0]) >> 2)
+		+ (((int64) A[7] * B[1]) >> 2)
+		+ (((int64) A[8] * B[2]) >> 2)
+		+ (((int64) A[9] * B[3]) >> 2)
+		+ (((int64) A[10] * B[4]) >> 2)
+		+ (((int64) A[11] * B[5]) >> 2));
+	C[7] = mat32_round((((int64) A[6] * B[6]) >> 2)
+		+ (((int64) A[7] * B[7]) >> 2)
+		+ (((int64) A[8] * B[8]) >> 2)
+		+ (((int64) A[9] * B[9]) >> 2)
+		+ (((int64) A[10] * B[10]) >> 2)
+		+ (((int64) A[11] * B[11]) >> 2));
+	C[8] = mat32_round((((int64) A[6] * B[12]) >> 2)
+		+ (((int64) A[7] * B[13]) >> 2)
+		+ (((int64) A[8] * B[14]) >> 2)
+		+ (((int64) A[9] * B[15]) >> 2)
+		+ (((int64) A[10] * B[16]) >> 2)
+		+ (((int64) A[11] * B[17]) >> 2));
+	C[9] = mat32_round((((int64) A[6] * B[18]) >> 2)
+		+ (((int64) A[7] * B[19]) >> 2)
+		+ (((int64) A[8] * B[20]) >> 2)
+		+ (((int64) A[9] * B[21]) >> 2)
+		+ (((int64) A[10] * B[22]) >> 2)
+		+ (((int64) A[11] * B[23]) >> 2));
+	C[10] = mat32_round((((int64) A[6] * B[24]) >> 2)
+		+ (((int64) A[7] * B[25]) >> 2)
+		+ (((int64) A[8] * B[26]) >> 2)
+		+ (((int64) A[9] * B[27]) >> 2)
+		+ (((int64) A[10] * B[28]) >> 2)
+		+ (((int64) A[11] * B[29]) >> 2));
+	C[11] = mat32_round((((int64) A[6] * B[30]) >> 2)
+		+ (((int64) A[7] * B[31]) >> 2)
+		+ (((int64) A[8] * B[32]) >> 2)
+		+ (((int64) A[9] * B[33]) >> 2)
+		+ (((int64) A[10] * B[34]) >> 2)
+		+ (((int64) A[11] * B[35]) >> 2));
+	C[12] = mat32_round((((int64) A[12] * B[0]) >> 2)
+		+ (((int64) A[13] * B[1]) >> 2)
+		+ (((int64) A[14] * B[2]) >> 2)
+		+ (((int64) A[15] * B[3]) >> 2)
+		+ (((int64) A[16] * B[4]) >> 2)
+		+ (((int64) A[17] * B[5]) >> 2));
+	C[13] = mat32_round((((int64) A[12] * B[6]) >> 2)
+		+ (((int64) A[13] * B[7]) >> 2)
+		+ (((int64) A[14] * B[8]) >> 2)
+		+ (((int64) A[15] * B[9]) >> 2)
+		+ (((int64) A[16] * B[10]) >> 2)
+		+ (((int64) A[17] * B[11]) >> 2));
+	C[14] = mat32_round((((int64) A[12] * B[12]) >> 2)
+		+ (((int64) A[13] * B[13]) >> 2)
+		+ (((int64) A[14] * B[14]) >> 2)
+		+ (((int64) A[15] * B[15]) >> 2)
+		+ (((int64) A[16] * B[16]) >> 2)
+		+ (((int64) A[17] * B[17]) >> 2));
+	C[15] = mat32_round((((int64) A[12] * B[18]) >> 2)
+		+ (((int64) A[13] * B[19]) >> 2)
+		+ (((int64) A[14] * B[20]) >> 2)
+		+ (((int64) A[15] * B[21]) >> 2)
+		+ (((int64) A[16] * B[22]) >> 2)
+		+ (((int64) A[17] * B[23]) >> 2));
+	C[16] = mat32_round((((int64) A[12] * B[24]) >> 2)
+		+ (((int64) A[13] * B[25]) >> 2)
+		+ (((int64) A[14] * B[26]) >> 2)
+		+ (((int64) A[15] * B[27]) >> 2)
+		+ (((int64) A[16] * B[28]) >> 2)
+		+ (((int64) A[17] * B[29]) >> 2));
+	C[17] = mat32_round((((int64) A[12] * B[30]) >> 2)
+		+ (((int64) A[13] * B[31]) >> 2)
+		+ (((int64) A[14] * B[32]) >> 2)
+		+ (((int64) A[15] * B[33]) >> 2)
+		+ (((int64) A[16] * B[34]) >> 2)
+		+ (((int64) A[17] * B[35]) >> 2));
+	C[18] = mat32_round((((int64) A[18] * B[0]) >> 2)
+		+ (((int64) A[19] * B[1]) >> 2)
+		+ (((int64) A[20] * B[2]) >> 2)
+		+ (((int64) A[21] * B[3]) >> 2)
+		+ (((int64) A[22] * B[4]) >> 2)
+		+ (((int64) A[23] * B[5]) >> 2));
+	C[19] = mat32_round((((int64) A[18] * B[6]) >> 2)
+		+ (((int64) A[19] * B[7]) >> 2)
+		+ (((int64) A[20] * B[8]) >> 2)
+		+ (((int64) A[21] * B[9]) >> 2)
+		+ (((int64) A[22] * B[10]) >> 2)
+		+ (((int64) A[23] * B[11]) >> 2));
+	C[20] = mat32_round((((int64) A[18] * B[12]) >> 2)
+		+ (((int64) A[19] * B[13]) >> 2)
+		+ (((int64) A[20] * B[14]) >> 2)
+		+ (((int64) A[21] * B[15]) >> 2)
+		+ (((int64) A[22] * B[16]) >> 2)
+		+ (((int64) A[23] * B[17]) >> 2));
+	C[21] = mat32_round((((int64) A[18] * B[18]) >> 2)
+		+ (((int64) A[19] * B[19]) >> 2)
+		+ (((int64) A[20] * B[20]) >> 2)
+		+ (((int64) A[21] * B[21]) >> 2)
+		+ (((int64) A[22] * B[22]) >> 2)
+		+ (((int64) A[23] * B[23]) >> 2));
+	C[22] = mat32_round((((int64) A[18] * B[24]) >> 2)
+		+ (((int64) A[19] * B[25]) >> 2)
+		+ (((int64) A[20] * B[26]) >> 2)
+		+ (((int64) A[21] * B[27]) >> 2)
+		+ (((int64) A[22] * B[28]) >> 2)
+		+ (((int64) A[23] * B[29]) >> 2));
+	C[23] = mat32_round((((int64) A[18] * B[30]) >> 2)
+		+ (((int64) A[19] * B[31]) >> 2)
+		+ (((int64) A[20] * B[32]) >> 2)
+		+ (((int64) A[21] * B[33]) >> 2)
+		+ (((int64) A[22] * B[34]) >> 2)
+		+ (((int64) A[23] * B[35]) >> 2));
+	C[24] = mat32_round((((int64) A[24] * B[0]) >> 2)
+		+ (((int64) A[25] * B[1]) >> 2)
+		+ (((int64) A[26] * B[2]) >> 2)
+		+ (((int64) A[27] * B[3]) >> 2)
+		+ (((int64) A[28] * B[4]) >> 2)
+		+ (((int64) A[29] * B[5]) >> 2));
+	C[25] = mat32_round((((int64) A[24] * B[6]) >> 2)
+		+ (((int64) A[25] * B[7]) >> 2)
+		+ (((int64) A[26] * B[8]) >> 2)
+		+ (((int64) A[27] * B[9]) >> 2)
+		+ (((int64) A[28] * B[10]) >> 2)
+		+ (((int64) A[29] * B[11]) >> 2));
+	C[26] = mat32_round((((int64) A[24] * B[12]) >> 2)
+		+ (((int64) A[25] * B[13]) >> 2)
+		+ (((int64) A[26] * B[14]) >> 2)
+		+ (((int64) A[27] * B[15]) >> 2)
+		+ (((int64) A[28] * B[16]) >> 2)
+		+ (((int64) A[29] * B[17]) >> 2));
+	C[27] = mat32_round((((int64) A[24] * B[18]) >> 2)
+		+ (((int64) A[25] * B[19]) >> 2)
+		+ (((int64) A[26] * B[20]) >> 2)
+		+ (((int64) A[27] * B[21]) >> 2)
+		+ (((int64) A[28] * B[22]) >> 2)
+		+ (((int64) A[29] * B[23]) >> 2));
+	C[28] = mat32_round((((int64) A[24] * B[24]) >> 2)
+		+ (((int64) A[25] * B[25]) >> 2)
+		+ (((int64) A[26] * B[26]) >> 2)
+		+ (((int64) A[27] * B[27]) >> 2)
+		+ (((int64) A[28] * B[28]) >> 2)
+		+ (((int64) A[29] * B[29]) >> 2));
+	C[29] = mat32_round((((int64) A[24] * B[30]) >> 2)
+		+ (((int64) A[25] * B[31]) >> 2)
+		+ (((int64) A[26] * B[32]) >> 2)
+		+ (((int64) A[27] * B[33]) >> 2)
+		+ (((int64) A[28] * B[34]) >> 2)
+		+ (((int64) A[29] * B[35]) >> 2));
+	C[30] = mat32_round((((int64) A[30] * B[0]) >> 2)
+		+ (((int64) A[31] * B[1]) >> 2)
+		+ (((int64) A[32] * B[2]) >> 2)
+		+ (((int64) A[33] * B[3]) >> 2)
+		+ (((int64) A[34] * B[4]) >> 2)
+		+ (((int64) A[35] * B[5]) >> 2));
+	C[31] = mat32_round((((int64) A[30] * B[6]) >> 2)
+		+ (((int64) A[31] * B[7]) >> 2)
+		+ (((int64) A[32] * B[8]) >> 2)
+		+ (((int64) A[33] * B[9]) >> 2)
+		+ (((int64) A[34] * B[10]) >> 2)
+		+ (((int64) A[35] * B[11]) >> 2));
+	C[32] = mat32_round((((int64) A[30] * B[12]) >> 2)
+		+ (((int64) A[31] * B[13]) >> 2)
+		+ (((int64) A[32] * B[14]) >> 2)
+		+ (((int64) A[33] * B[15]) >> 2)
+		+ (((int64) A[34] * B[16]) >> 2)
+		+ (((int64) A[35] * B[17]) >> 2));
+	C[33] = mat32_round((((int64) A[30] * B[18]) >> 2)
+		+ (((int64) A[31] * B[19]) >> 2)
+		+ (((int64) A[32] * B[20]) >> 2)
+		+ (((int64) A[33] * B[21]) >> 2)
+		+ (((int64) A[34] * B[22]) >> 2)
+		+ (((int64) A[35] * B[23]) >> 2));
+	C[34] = mat32_round((((int64) A[30] * B[24]) >> 2)
+		+ (((int64) A[31] * B[25]) >> 2)
+		+ (((int64) A[32] * B[26]) >> 2)
+		+ (((int64) A[33] * B[27]) >> 2)
+		+ (((int64) A[34] * B[28]) >> 2)
+		+ (((int64) A[35] * B[29]) >> 2));
+	C[35] = mat32_round((((int64) A[30] * B[30]) >> 2)
+		+ (((int64) A[31] * B[31]) >> 2)
+		+ (((int64) A[32] * B[32]) >> 2)
+		+ (((int64) A[33] * B[33]) >> 2)
+		+ (((int64) A[34] * B[34]) >> 2)
+		+ (((int64) A[35] * B[35]) >> 2));
+}
+
+
+void mips_mat6_add32(int32 *C, const int32 *A, const int32 *B)
+{
+	C[0] = mat32_sat((int64) A[0] + B[0]);
+	C[1] = mat32_sat((int64) A[1] + B[1]);
+	C[2] = mat32_sat((int64) A[2] + B[2]);
+	C[3] = mat32_sat((int64) A[3] + B[3]);
+	C[4] = mat32_sat((int64) A[4] + B[4]);
+	C[5] = mat32_sat((int64) A[5] + B[5]);
+	C[6] = mat32_sat((int64) A[6] + B[6]);
+	C[7] = mat32_sat((int64) A[7] + B[7]);
+	C[8] = mat32_sat((int64) A[8] + B[8]);
+	C[9] = mat32_sat((int64) A[9] + B[9]);
+	C[10] = mat32_sat((int64) A[10] + B[10]);
+	C[11] = mat32_sat((int64) A[11] + B[11]);
+	C[12] = mat32_sat((int64) A[12] + B[12]);
+	C[13] = mat32_sat((int64) A[13] + B[13]);
+	C[14] = mat32_sat((int64) A[14] + B[14]);
+	C[15] = mat32_sat((int64) A[15] + B[15]);
+	C[16] = mat32_sat((int64) A[16] + B[16]);
+	C[17] = mat32_sat((int64) A[17] + B[17]);
+	C[18] = mat32_sat((int64) A[18] + B[18]);
+	C[19] = mat32_sat((int64) A[19] + B[19]);
+	C[20] = mat32_sat((int64) A[20] + B[20]);
+	C[21] = mat32_sat((int64) A[21] + B[21]);
+	C[22] = mat32_sat((int64) A[22] + B[22]);
+	C[23] = mat32_sat((int64) A[23] + B[23]);
+	C[24] = mat32_sat((int64) A[24] + B[24]);
+	C[25] = mat32_sat((int64) A[25] + B[25]);
+	C[26] = mat32_sat((int64) A[26] + B[26]);
+	C[27] = mat32_sat((int64) A[27] + B[27]);
+	C[28] = mat32_sat((int64) A[28] + B[28]);
+	C[29] = mat32_sat((int64) A[29] + B[29]);
+	C[30] = mat32_sat((int64) A[30] + B[30]);
+	C[31] = mat32_sat((int64) A[31] + B[31]);
+	C[32] = mat32_sat((int64) A[32] + B[32]);
+	C[33] = mat32_sat((int64) A[33] + B[33]);
+	C[34] = mat32_sat((int64) A[34] + B[34]);
+	C[35] = mat32_sat((int64) A[35] + B[35]);
+}
+
+
+void mips_mat6_fpft32(int32 *Pout, const int32 *F, const int32 *P, const int32 *Q)
+{
+	int32 T[36];
+	int32 v;
+
+	T[0] = mat32_round((((int64) F[0] * P[0]) >> 2)
+		+ (((int64) F[1] * P[6]) >> 2)
+		+ (((int64) F[2] * P[12]) >> 2)
+		+ (((int64) F[3] * P[18]) >> 2)
+		+ (((int64) F[4] * P[24]) >> 2)
+		+ (((int64) F[5] * P[30]) >> 2));
+	T[1] = mat32_round((((int64) F[0] * P[1]) >> 2)
+		+ (((int64) F[1] * P[7]) >> 2)
+		+ (((int64) F[2] * P[13]) >> 2)
+		+ (((int64) F[3] * P[19]) >> 2)
+		+ (((int64) F[4] * P[25]) >> 2)
+		+ (((int64) F[5] * P[31]) >> 2));
+	T[2] = mat32_round((((int64) F[0] * P[2]) >> 2)
+		+ (((int64) F[1] * P[8]) >> 2)
+		+ (((int64) F[2] * P[14]) >> 2)
+		+ (((int64) F[3] * P[20]) >> 2)
+		+ (((int64) F[4] * P[26]) >> 2)
+		+ (((int64) F[5] * P[32]) >> 2));
+	T[3] = mat32_round((((int64) F[0] * P[3]) >> 2)
+		+ (((int64) F[1] * P[9]) >> 2)
+		+ (((int64) F[2] * P[15]) >> 2)
+		+ (((int64) F[3] * P[21]) >> 2)
+		+ (((int64) F[4] * P[27]) >> 2)
+		+ (((int64) F[5] * P[33]) >> 2));
+	T[4] = mat32_round((((int64) F[0] * P[4]) >> 2)
+		+ (((int64) F[1] * P[10]) >> 2)
+		+ (((int64) F[2] * P[16]) >> 2)
+		+ (((int64) F[3] * P[22]) >> 2)
+		+ (((int64) F[4] * P[28]) >> 2)
+		+ (((int64) F[5] * P[34]) >> 2));
+	T[5] = mat32_round((((int64) F[0] * P[5]) >> 2)
+		+ (((int64) F[1] * P[11]) >> 2)
+		+ (((int64) F[2] * P[17]) >> 2)
+		+ (((int64) F[3] * P[23]) >> 2)
+		+ (((int64) F[4] * P[29]) >> 2)
+		+ (((int64) F[5] * P[35]) >> 2));
+	T[6] = mat32_round((((int64) F[6] * P[0]) >> 2)
+		+ (((int64) F[7] * P[6]) >> 2)
+		+ (((int64) F[8] * P[12]) >> 2)
+		+ (((int64) F[9] * P[18]) >> 2)
+		+ (((int64) F[10] * P[24]) >> 2)
+		+ (((int64) F[11] * P[30]) >> 2));
+	T[7] = mat32_round((((int64) F[6] * P[1]) >> 2)
+		+ (((int64) F[7] * P[7]) >> 2)
+		+ (((int64) F[8] * P[13]) >> 2)
+		+ (((int64) F[9] * P[19]) >> 2)
+		+ (((int64) F[10] * P[25]) >> 2)
+		+ (((int64) F[11] * P[31]) >> 2));
+	T[8] = mat32_round((((int64) F[6] * P[2]) >> 2)
+		+ (((int64) F[7] * P[8]) >> 2)
+		+ (((int64) F[8] * P[14]) >> 2)
+		+ (((int64) F[9] * P[20]) >> 2)
+		+ (((int64) F[10] * P[26]) >> 2)
+		+ (((int64) F[11] * P[32]) >> 2));
+	T[9] = mat32_round((((int64) F[6] * P[3]) >> 2)
+		+ (((int64) F[7] * P[9]) >> 2)
+		+ (((int64) F[8] * P[15]) >> 2)
+		+ (((int64) F[9] * P[21]) >> 2)
+		+ (((int64) F[10] * P[27]) >> 2)
+		+ (((int64) F[11] * P[33]) >> 2));
+	T[10] = mat32_round((((int64) F[6] * P[4]) >> 2)
+		+ (((int64) F[7] * P[10]) >> 2)
+		+ (((int64) F[8] * P[16]) >> 2)
+		+ (((int64) F[9] * P[22]) >> 2)
+		+ (((int64) F[10] * P[28]) >> 2)
+		+ (((int64) F[11] * P[34]) >> 2));
+	T[11] = mat32_round((((int64) F[6] * P[5]) >> 2)
+		+ (((int64) F[7] * P[11]) >> 2)
+		+ (((int64) F[8] * P[17]) >> 2)
+		+ (((int64) F[9] * P[23]) >> 2)
+		+ (((int64) F[10] * P[29]) >> 2)
+		+ (((int64) F[11] * P[35]) >> 2));
+	T[12] = mat32_round((((int64) F[12] * P[0]) >> 2)
+		+ (((int64) F[13] * P[6]) >> 2)
+		+ (((int64) F[14] * P[12]) >> 2)
+		+ (((int64) F[15] * P[18]) >> 2)
+		+ (((int64) F[16] * P[24]) >> 2)
+		+ (((int64) F[17] * P[30]) >> 2));
+	T[13] = mat32_round((((int64) F[12] * P[1]) >> 2)
+		+ (((int64) F[13] * P[7]) >> 2)
+		+ (((int64) F[14] * P[13]) >> 2)
+		+ (((int64) F[15] * P[19]) >> 2)
+		+ (((int64) F[16] * P[25]) >> 2)
+		+ (((int64) F[17] * P[31]) >> 2));
+	T[14] = mat32_round((((int64) F[12] * P[2]) >> 2)
+		+ (((int64) F[13] * P[8]) >> 2)
+		+ (((int64) F[14] * P[14]) >> 2)
+		+ (((int64) F[15] * P[20]) >> 2)
+		+ (((int64) F[16] * P[26]) >> 2)
+		+ (((int64) F[17] * P[32]) >> 2));
+	T[15] = mat32_round((((int64) F[12] * P[3]) >> 2)
+		+ (((int64) F[13] * P[9]) >> 2)
+		+ (((int64) F[14] * P[15]) >> 2)
+		+ (((int64) F[15] * P[21]) >> 2)
+		+ (((int64) F[16] * P[27]) >> 2)
+		+ (((int64) F[17] * P[33]) >> 2));
+	T[16] = mat32_round((((int64) F[12] * P[4]) >> 2)
+		+ (((int64) F[13] * P[10]) >> 2)
+		+ (((int64) F[14] * P[16]) >> 2)
+		+ (((int64) F[15] * P[22]) >> 2)
+		+ (((int64) F[16] * P[28]) >> 2)
+		+ (((int64) F[17] * P[34]) >> 2));
+	T[17] = mat32_round((((int64) F[12] * P[5]) >> 2)
+		+ (((int64) F[13] * P[11]) >> 2)
+		+ (((int64) F[14] * P[17]) >> 2)
+		+ (((int64) F[15] * P[23]) >> 2)
+		+ (((int64) F[16] * P[29]) >> 2)
+		+ (((int64) F[17] * P[35]) >> 2));
+	T[18] = mat32_round((((int64) F[18] * P[0]) >> 2)
+		+ (((int64) F[19] * P[6]) >> 2)
+		+ (((int64) F[20] * P[12]) >> 2)
+		+ (((int64) F[21] * P[18]) >> 2)
+		+ (((int64) F[22] * P[24]) >> 2)
+		+ (((int64) F[23] * P[30]) >> 2));
+	T[19] = mat32_round((((int64) F[18] * P[1]) >> 2)
+		+ (((int64) F[19] * P[7]) >> 2)
+		+ (((int64) F[20] * P[13]) >> 2)
+		+ (((int64) F[21] * P[19]) >> 2)
+		+ (((int64) F[22] * P[25]) >> 2)
+		+ (((int64) F[23] * P[31]) >> 2));
+	T[20] = mat32_round((((int64) F[18] * P[2]) >> 2)
+		+ (((int64) F[19] * P[8]) >> 2)
+		+ (((int64) F[20] * P[14]) >> 2)
+		+ (((int64) F[21] * P[20]) >> 2)
+		+ (((int64) F[22] * P[26]) >> 2)
+		+ (((int64) F[23] * P[32]) >> 2));
+	T[21] = mat32_round((((int64) F[18] * P[3]) >> 2)
+		+ (((int64) F[19] * P[9]) >> 2)
+		+ (((int64) F[20] * P[15]) >> 2)
+		+ (((int64) F[21] * P[21]) >> 2)
+		+ (((int64) F[22] * P[27]) >> 2)
+		+ (((int64) F[23] * P[33]) >> 2));
+	T[22] = mat32_round((((int64) F[18] * P[4]) >> 2)
+		+ (((int64) F[19] * P[10]) >> 2)
+		+ (((int64) F[20] * P[16]) >> 2)
+		+ (((int64) F[21] * P[22]) >> 2)
+		+ (((int64) F[22] * P[28]) >> 2)
+		+ (((int64) F[23] * P[34]) >> 2));
+	T[23] = mat32_round((((int64) F[18] * P[5]) >> 2)
+		+ (((int64) F[19] * P[11]) >> 2)
+		+ (((int64) F[20] * P[17]) >> 2)
+		+ (((int64) F[21] * P[23]) >> 2)
+		+ (((int64) F[22] * P[29]) >> 2)
+		+ (((int64) F[23] * P[35]) >> 2));
+	T[24] = mat32_round((((int64) F[24] * P[0]) >> 2)
+		+ (((int64) F[25] * P[6]) >> 2)
+		+ (((int64) F[26] * P[12]) >> 2)
+		+ (((int64) F[27] * P[18]) >> 2)
+		+ (((int64) F[28] * P[24]) >> 2)
+		+ (((int64) F[29] * P[30]) >> 2));
+	T[25] = mat32_round((((int64) F[24] * P[1]) >> 2)
+		+ (((int64) F[25] * P[7]) >> 2)
+		+ (((int64) F[26] * P[13]) >> 2)
+		+ (((int64) F[27] * P[19]) >> 2)
+		+ (((int64) F[28] * P[25]) >> 2)
+		+ (((int64) F[29] * P[31]) >> 2));
+	T[26] = mat32_round((((int64) F[24] * P[2]) >> 2)
+		+ (((int64) F[25] * P[8]) >> 2)
+		+ (((int64) F[26] * P[14]) >> 2)
+		+ (((int64) F[27] * P[20]) >> 2)
+		+ (((int64) F[28] * P[26]) >> 2)
+		+ (((int64) F[29] * P[32]) >> 2));
+	T[27] = mat32_round((((int64) F[24] * P[3]) >> 2)
+		+ (((int64) F[25] * P[9]) >> 2)
+		+ (((int64) F[26] * P[15]) >> 2)
+		+ (((int64) F[27] * P[21]) >> 2)
+		+ (((int64) F[28] * P[27]) >> 2)
+		+ (((int64) F[29] * P[33]) >> 2));
+	T[28] = mat32_round((((int64) F[24] * P[4]) >> 2)
+		+ (((int64) F[25] * P[10]) >> 2)
+		+ (((int64) F[26] * P[16]) >> 2)
+		+ (((int64) F[27] * P[22]) >> 2)
+		+ (((int64) F[28] * P[28]) >> 2)
+		+ (((int64) F[29] * P[34]) >> 2));
+	T[29] = mat32_round((((int64) F[24] * P[5]) >> 2)
+		+ (((int64) F[25] * P[11]) >> 2)
+		+ (((int64) F[26] * P[17]) >> 2)
+		+ (((int64) F[27] * P[23]) >> 2)
+		+ (((int64) F[28] * P[29]) >> 2)
+		+ (((int64) F[29] * P[35]) >> 2));
+	T[30] = mat32_round((((int64) F[30] * P[0]) >> 2)
+		+ (((int64) F[31] * P[6]) >> 2)
+		+ (((int64) F[32] * P[12]) >> 2)
+		+ (((int64) F[33] * P[18]) >> 2)
+		+ (((int64) F[34] * P[24]) >> 2)
+		+ (((int64) F[35] * P[30]) >> 2));
+	T[31] = mat32_round((((int64) F[30] * P[1]) >> 2)
+		+ (((int64) F[31] * P[7]) >> 2)
+		+ (((int64) F[32] * P[13]) >> 2)
+		+ (((int64) F[33] * P[19]) >> 2)
+		+ (((int64) F[34] * P[25]) >> 2)
+		+ (((int64) F[35] * P[31]) >> 2));
+	T[32] = mat32_round((((int64) F[30] * P[2]) >> 2)
+		+ (((int64) F[31] * P[8]) >> 2)
+		+ (((int64) F[32] * P[14]) >> 2)
+		+ (((int64) F[33] * P[20]) >> 2)
+		+ (((int64) F[34] * P[26]) >> 2)
+		+ (((int64) F[35] * P[32]) >> 2));
+	T[33] = mat32_round((((int64) F[30] * P[3]) >> 2)
+		+ (((int64) F[31] * P[9]) >> 2)
+		+ (((int64) F[32] * P[15]) >> 2)
+		+ (((int64) F[33] * P[21]) >> 2)
+		+ (((int64) F[34] * P[27]) >> 2)
+		+ (((int64) F[35] * P[33]) >> 2));
+	T[34] = mat32_round((((int64) F[30] * P[4]) >> 2)
+		+ (((int64) F[31] * P[10]) >> 2)
+		+ (((int64) F[32] * P[16]) >> 2)
+		+ (((int64) F[33] * P[22]) >> 2)
+		+ (((int64) F[34] * P[28]) >> 2)
+		+ (((int64) F[35] * P[34]) >> 2));
+	T[35] = mat32_round((((int64) F[30] * P[5]) >> 2)
+		+ (((int64) F[31] * P[11]) >> 2)
+		+ (((int64) F[32] * P[17]) >> 2)
+		+ (((int64) F[33] * P[23]) >> 2)
+		+ (((int64) F[34] * P[29]) >> 2)
+		+ (((int64) F[35] * P[35]) >> 2));
+
+	v = mat32_round((((int64) T[0] * F[0]) >> 2)
+		+ (((int64) T[1] * F[1]) >> 2)
+		+ (((int64) T[2] * F[2]) >> 2)
+		+ (((int64) T[3] * F[3]) >> 2)
+		+ (((int64) T[4] * F[4]) >> 2)
+		+ (((int64) T[5] * F[5]) >> 2)
+		+ (int64) Q[0] * (1 << 29));
+	Pout[0] = v;
+	v = mat32_round((((int64) T[0] * F[6]) >> 2)
+		+ (((int64) T[1] * F[7]) >> 2)
+		+ (((int64) T[2] * F[8]) >> 2)
+		+ (((int64) T[3] * F[9]) >> 2)
+		+ (((int64) T[4] * F[10]) >> 2)
+		+ (((int64) T[5] * F[11]) >> 2)
+		+ (int64) Q[1] * (1 << 29));
+	Pout[1] = Pout[6] = v;
+	v = mat32_round((((int64) T[0] * F[12]) >> 2)
+		+ (((int64) T[1] * F[13]) >> 2)
+		+ (((int64) T[2] * F[14]) >> 2)
+		+ (((int64) T[3] * F[15]) >> 2)
+		+ (((int64) T[4] * F[16]) >> 2)
+		+ (((int64) T[5] * F[17]) >> 2)
+		+ (int64) Q[2] * (1 << 29));
+	Pout[2] = Pout[12] = v;
+	v = mat32_round((((int64) T[0] * F[18]) >> 2)
+		+ (((int64) T[1] * F[19]) >> 2)
+		+ (((int64) T[2] * F[20]) >> 2)
+		+ (((int64) T[3] * F[21]) >> 2)
+		+ (((int64) T[4] * F[22]) >> 2)
+		+ (((int64) T[5] * F[23]) >> 2)
+		+ (int64) Q[3] * (1 << 29));
+	Pout[3] = Pout[18] = v;
+	v = mat32_round((((int64) T[0] * F[24]) >> 2)
+		+ (((int64) T[1] * F[25]) >> 2)
+		+ (((int64) T[2] * F[26]) >> 2)
+		+ (((int64) T[3] * F[27]) >> 2)
+		+ (((int64) T[4] * F[28]) >> 2)
+		+ (((int64) T[5] * F[29]) >> 2)
+		+ (int64) Q[4] * (1 << 29));
+	Pout[4] = Pout[24] = v;
+	v = mat32_round((((int64) T[0] * F[30]) >> 2)
+		+ (((int64) T[1] * F[31]) >> 2)
+		+ (((int64) T[2] * F[32]) >> 2)
+		+ (((int64) T[3] * F[33]) >> 2)
+		+ (((int64) T[4] * F[34]) >> 2)
+		+ (((int64) T[5] * F[35]) >> 2)
+		+ (int64) Q[5] * (1 << 29));
+	Pout[5] = Pout[30] = v;
+	v = mat32_round((((int64) T[6] * F[6]) >> 2)
+		+ (((int64) T[7] * F[7]) >> 2)
+		+ (((int64) T[8] * F[8]) >> 2)
+		+ (((int64) T[9] * F[9]) >> 2)
+		+ (((int64) T[10] * F[10]) >> 2)
+		+ (((int64) T[11] * F[11]) >> 2)
+		+ (int64) Q[7] * (1 << 29));
+	Pout[7] = v;
+	v = mat32_round((((int64) T[6] * F[12]) >> 2)
+		+ (((int64) T[7] * F[13]) >> 2)
+		+ (((int64) T[8] * F[14]) >> 2)
+		+ (((int64) T[9] * F[15]) >> 2)
+		+ (((int64) T[10] * F[16]) >> 2)
+		+ (((int64) T[11] * F[17]) >> 2)
+		+ (int64) Q[8] * (1 << 29));
+	Pout[8] = Pout[13] = v;
+	v = mat32_round((((int64) T[6] * F[18]) >> 2)
+		+ (((int64) T[7] * F[19]) >> 2)
+		+ (((int64) T[8] * F[20]) >> 2)
+		+ (((int64) T[9] * F[21]) >> 2)
+		+ (((int64) T[10] * F[22]) >> 2)
+		+ (((int64) T[11] * F[23]) >> 2)
+		+ (int64) Q[9] * (1 << 29));
+	Pout[9] = Pout[19] = v;
+	v = mat32_round((((int64) T[6] * F[24]) >> 2)
+		+ (((int64) T[7] * F[25]) >> 2)
+		+ (((int64) T[8] * F[26]) >> 2)
+		+ (((int64) T[9] * F[27]) >> 2)
+		+ (((int64) T[10] * F[28]) >> 2)
+		+ (((int64) T[11] * F[29]) >> 2)
+		+ (int64) Q[10] * (1 << 29));
+	Pout[10] = Pout[25] = v;
+	v = mat32_round((((int64) T[6] * F[30]) >> 2)
+		+ (((int64) T[7] * F[31]) >> 2)
+		+ (((int64) T[8] * F[32]) >> 2)
+		+ (((int64) T[9] * F[33]) >> 2)
+		+ (((int64) T[10] * F[34]) >> 2)
+		+ (((int64) T[11] * F[35]) >> 2)
+		+ (int64) Q[11] * (1 << 29));
+	Pout[11] = Pout[31] = v;
+	v = mat32_round((((int64) T[12] * F[12]) >> 2)
+		+ (((int64) T[13] * F[13]) >> 2)
+		+ (((int64) T[14] * F[14]) >> 2)
+		+ (((int64) T[15] * F[15]) >> 2)
+		+ (((int64) T[16] * F[16]) >> 2)
+		+ (((int64) T[17] * F[17]) >> 2)
+		+ (int64) Q[14] * (1 << 29));
+	Pout[14] = v;
+	v = mat32_round((((int64) T[12] * F[18]) >> 2)
+		+ (((int64) T[13] * F[19]) >> 2)
+		+ (((int64) T[14] * F[20]) >> 2)
+		+ (((int64) T[15] * F[21]) >> 2)
+		+ (((int64) T[16] * F[22]) >> 2)
+		+ (((int64) T[17] * F[23]) >> 2)
+		+ (int64) Q[15] * (1 << 29));
+	Pout[15] = Pout[20] = v;
+	v = mat32_round((((int64) T[12] * F[24]) >> 2)
+		+ (((int64) T[13] * F[25]) >> 2)
+		+ (((int64) T[14] * F[26]) >> 2)
+		+ (((int64) T[15] * F[27]) >> 2)
+		+ (((int64) T[16] * F[28]) >> 2)
+		+ (((int64) T[17] * F[29]) >> 2)
+		+ (int64) Q[16] * (1 << 29));
+	Pout[16] = Pout[26] = v;
+	v = mat32_round((((int64) T[12] * F[30]) >> 2)
+		+ (((int64) T[13] * F[31]) >> 2)
+		+ (((int64) T[14] * F[32]) >> 2)
+		+ (((int64) T[15] * F[33]) >> 2)
+		+ (((int64) T[16] * F[34]) >> 2)
+		+ (((int64) T[17] * F[35]) >> 2)
+		+ (int64) Q[17] * (1 << 29));
+	Pout[17] = Pout[32] = v;
+	v = mat32_round((((int64) T[18] * F[18]) >> 2)
+		+ (((int64) T[19] * F[19]) >> 2)
+		+ (((int64) T[20] * F[20]) >> 2)
+		+ (((int64) T[21] * F[21]) >> 2)
+		+ (((int64) T[22] * F[22]) >> 2)
+		+ (((int64) T[23] * F[23]) >> 2)
+		+ (int64) Q[21] * (1 << 29));
+	Pout[21] = v;
+	v = mat32_round((((int64) T[18] * F[24]) >> 2)
+		+ (((int64) T[19] * F[25]) >> 2)
+		+ (((int64) T[20] * F[26]) >> 2)
+		+ (((int64) T[21] * F[27]) >> 2)
+		+ (((int64) T[22] * F[28]) >> 2)
+		+ (((int64) T[23] * F[29]) >> 2)
+		+ (int64) Q[22] * (1 << 29));
+	Pout[22] = Pout[27] = v;
+	v = mat32_round((((int64) T[18] * F[30]) >> 2)
+		+ (((int64) T[19] * F[31]) >> 2)
+		+ (((int64) T[20] * F[32]) >> 2)
+		+ (((int64) T[21] * F[33]) >> 2)
+		+ (((int64) T[22] * F[34]) >> 2)
+		+ (((int64) T[23] * F[35]) >> 2)
+		+ (int64) Q[23] * (1 << 29));
+	Pout[23] = Pout[33] = v;
+	v = mat32_round((((int64) T[24] * F[24]) >> 2)
+		+ (((int64) T[25] * F[25]) >> 2)
+		+ (((int64) T[26] * F[26]) >> 2)
+		+ (((int64) T[27] * F[27]) >> 2)
+		+ (((int64) T[28] * F[28]) >> 2)
+		+ (((int64) T[29] * F[29]) >> 2)
+		+ (int64) Q[28] * (1 << 29));
+	Pout[28] = v;
+	v = mat32_round((((int64) T[24] * F[30]) >> 2)
+		+ (((int64) T[25] * F[31]) >> 2)
+		+ (((int64) T[26] * F[32]) >> 2)
+		+ (((int64) T[27] * F[33]) >> 2)
+		+ (((int64) T[28] * F[34]) >> 2)
+		+ (((int64) T[29] * F[35]) >> 2)
+		+ (int64) Q[29] * (1 << 29));
+	Pout[29] = Pout[34] = v;
+	v = mat32_round((((int64) T[30] * F[30]) >> 2)
+		+ (((int64) T[31] * F[31]) >> 2)
+		+ (((int64) T[32] * F[32]) >> 2)
+		+ (((int64) T[33] * F[33]) >> 2)
+		+ (((int64) T[34] * F[34]) >> 2)
+		+ (((int64) T[35] * F[35]) >> 2)
+		+ (int64) Q[35] * (1 << 29));
+	Pout[35] = v;
+}
+
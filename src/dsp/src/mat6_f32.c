@@ -0,0 +1,214 @@
+/* generated by matgen.c */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+void mips_mat6_mul_f32(float *C, const float *A, const float *B)
+{
+	C[0] = A[0] * B[0] + A[1] * B[6] + A[2] * B[12] + A[3] * B[18] + A[4] * B[24] + A[5] * B[30];
+	C[1] = A[0] * B[1] + A[1] * B[7] + A[2] * B[13] + A[3] * B[19] + A[4] * B[25] + A[5] * B[31];
+	C[2] = A[0] * B[2] + A[1] * B[8] + A[2] * B[14] + A[3] * B[20] + A[4] * B[26] + A[5] * B[32];
+	C[3] = A[0] * B[3] + A[1] * B[9] + A[2] * B[15] + A[3] * B[21] + A[4] * B[27] + A[5] * B[33];
+	C[4] = A[0] * B[4] + A[1] * B[10] + A[2] * B[16] + A[3] * B[22] + A[4] * B[28] + A[5] * B[34];
+	C[5] = A[0] * B[5] + A[1] * B[11] + A[2] * B[17] + A[3] * B[23] + A[4] * B[29] + A[5] * B[35];
+	C[6] = A[6] * B[0] + A[7] * B[6] + A[8] * B[12] + A[9] * B[18] + A[10] * B[24] + A[11] * B[30];
+	C[7] = A[6] * B[1] + A[7] * B[7] + A[8] * B[13] + A[9] * B[19] + A[10] * B[25] + A[11] * B[31];
+	C[8] = A[6] * B[2] + A[7] * B[8] + A[8] * B[14] + A[9] * B[20] + A[10] * B[26] + A[11] * B[32];
+	C[9] = A[6] * B[3] + A[7] * B[9] + A[8] * B[15] + A[9] * B[21] + A[10] * B[27] + A[11] * B[33];
+	C[10] = A[6] * B[4] + A[7] * B[10] + A[8] * B[16] + A[9] * B[22] + A[10] * B[28] + A[11] * B[34];
+	C[11] = A[6] * B[5] + A[7] * B[11] + A[8] * B[17] + A[9] * B[23] + A[10] * B[29] + A[11] * B[35];
+	C[12] = A[12] * B[0] + A[13] * B[6] + A[14] * B[12] + A[15] * B[18] + A[16] * B[24] + A[17] * B[30];
+	C[13] = A[12] * B[1] + A[13] * B[7] + A[14] * B[13] + A[15] * B[19] + A[16] * B[25] + A[17] * B[31];
+	C[14] = A[12] * B[2] + A[13] * B[8] + A[14] * B[14] + A[15] * B[20] + A[16] * B[26] + A[17] * B[32];
+	C[15] = A[12] * B[3] + A[13] * B[9] + A[14] * B[15] + A[15] * B[21] + A[16] * B[27] + A[17] * B[33];
+	C[16] = A[12] * B[4] + A[13] * B[10] + A[14] * B[16] + A[15] * B[22] + A[16] * B[28] + A[17] * B[34];
+	C[17] = A[12] * B[5] + A[13] * B[11] + A[14] * B[17] + A[15] * B[23] + A[16] * B[29] + A[17] * B[35];
+	C[18] = A[18] * B[0] + A[19] * B[6] + A[20] * B[12] + A[21] * B[18] + A[22] * B[24] + A[23] * B[30];
+	C[19] = A[18] * B[1] + A[19] * B[7] + A[20] * B[13] + A[21] * B[19] + A[22] * B[25] + A[23] * B[31];
+	C[20] = A[18] * B[2] + A[19] * B[8] + A[20] * B[14] + A[21] * B[20] + A[22] * B[26] + A[23] * B[32];
+	C[21] = A[18] * B[3] + A[19] * B[9] + A[20] * B[15] + A[21] * B[21] + A[22] * B[27] + A[23] * B[33];
+	C[22] = A[18] * B[4] + A[19] * B[10] + A[20] * B[16] + A[21] * B[22] + A[22] * B[28] + A[23] * B[34];
+	C[23] = A[18] * B[5] + A[19] * B[11] + A[20] * B[17] + A[21] * B[23] + A[22] * B[29] + A[23] * B[35];
+	C[24] = A[24] * B[0] + A[25] * B[6] + A[26] * B[12] + A[27] * B[18] + A[28] * B[24] + A[29] * B[30];
+	C[25] = A[24] * B[1] + A[25] * B[7] + A[26] * B[13] + A[27] * B[19] + A[28] * B[25] + A[29] * B[31];
+	C[26] = A[24] * B[2] + A[25] * B[8] + A[26] * B[14] + A[27] * B[20] + A[28] * B[26] + A[29] * B[32];
+	C[27] = A[24] * B[3] + A[25] * B[9] + A[26] * B[15] + A[27] * B[21] + A[28] * B[27] + A[29] * B[33];
+	C[28] = A[24] * B[4] + A[25] * B[10] + A[26] * B[16] + A[27] * B[22] + A[28] * B[28] + A[29] * B[34];
+	C[29] = A[24] * B[5] + A[25] * B[11] + A[26] * B[17] + A[27] * B[23] + A[28] * B[29] + A[29] * B[35];
+	C[30] = A[30] * B[0] + A[31] * B[6] + A[32] * B[12] + A[33] * B[18] + A[34] * B[24] + A[35] * B[30];
+	C[31] = A[30] * B[1] + A[31] * B[7] + A[32] * B[13] + A[33] * B[19] + A[34] * B[25] + A[35] * B[31];
+	C[32] = A[30] * B[2] + A[31] * B[8] + A[32] * B[14] + A[33] * B[20] + A[34] * B[26] + A[35] * B[32];
+	C[33] = A[30] * B[3] + A[31] * B[9] + A[32] * B[15] + A[33] * B[21] + A[34] * B[27] + A[35] * B[33];
+	C[34] = A[30] * B[4] + A[31] * B[10] + A[32] * B[16] + A[33] * B[22] + A[34] * B[28] + A[35] * B[34];
+	C[35] = A[30] * B[5] + A[31] * B[11] + A[32] * B[17] + A[33] * B[23] + A[34] * B[29] + A[35] * B[35];
+}
+
+
+void mips_mat6_mul_t_f32(float *C, const float *A, const float *B)
+{
+	C[0] = A[0] * B[0] + A[1] * B[1] + A[2] * B[2] + A[3] * B[3] + A[4] * B[4] + A[5] * B[5];
+	C[1] = A[0] * B[6] + A[1] * B[7] + A[2] * B[8] + A[3] * B[9] + A[4] * B[10] + A[5] * B[11];
+	C[2] = A[0] * B[12] + A[1] * B[13] + A[2] * B[14] + A[3] * B[15] + A[4] * B[16] + A[5] * B[17];
+	C[3] = A[0] * B[18] + A[1] * B[19] + A[2] * B[20] + A[3] * B[21] + A[4] * B[22] + A[5] * B[23];
+	C[4] = A[0] * B[24] + A[1] * B[25] + A[2] * B[26] + A[3] * B[27] + A[4] * B[28] + A[5] * B[29];
+	C[5] = A[0] * B[30] + A[1] * B[31] + A[2] * B[32] + A[3] * B[33] + A[4] * B[34] + A[5] * B[35];
+	C[6] = A[6] * B[0] + A[7] * B[1] + A[8] * B[2] + A[9] * B[3] + A[10] * B[4] + A[11] * B[5];
+	C[7] = A[6] * B[6] + A[7] * B[7] + A[8] * B[8] + A[9] * B[9] + A[10] * B[10] + A[11] * B[11];
+	C[8] = A[6] * B[12] + A[7] * B[13] + A[8] * B[14] + A[9] * B[15] + A[10] * B[16] + A[11] * B[17];
+	C[9] = A[6] * B[18] + A[7] * B[19] + A[8] * B[20] + A[9] * B[21] + A[10] * B[22] + A[11] * B[23];
+	C[10] = A[6] * B[24] + A[7] * B[25] + A[8] * B[26] + A[9] * B[27] + A[10] * B[28] + A[11] * B[29];
+	C[11] = A[6] * B[30] + A[7] * B[31] + A[8] * B[32] + A[9] * B[33] + A[10] * B[34] + A[11] * B[35];
+	C[12] = A[12] * B[0] + A[13] * B[1] + A[14] * B[2] + A[15] * B[3] + A[16] * B[4] + A[17] * B[5];
+	C[13] = A[12] * B[6] + A[13] * B[7] + A[14] * B[8] + A[15] * B[9] + A[16] * B[10] + A[17] * B[11];
+	C[14] = A[12] * B[12] + A[13] * B[13] + A[14] * B[14] + A[15] * B[15] + A[16] * B[16] + A[17] * B[17];
+	C[15] = A[12] * B[18] + A[13] * B[19] + A[14] * B[20] + A[15] * B[21] + A[16] * B[22] + A[17] * B[23];
+	C[16] = A[12] * B[24] + A[13] * B[25] + A[14] * B[26] + A[15] * B[27] + A[16] * B[28] + A[17] * B[29];
+	C[17] = A[12] * B[30] + A[13] * B[31] + A[14] * B[32] + A[15] * B[33] + A[16] * B[34] + A[17] * B[35];
+	C[18] = A[18] * B[0] + A[19] * B[1] + A[20] * B[2] + A[21] * B[3] + A[22] * B[4] + A[23] * B[5];
+	C[19] = A[18] * B[6] + A[19] * B[7] + A[20] * B[8] + A[21] * B[9] + A[22] * B[10] + A[23] * B[11];
+	C[20] = A[18] * B[12] + A[19] * B[13] + A[20] * B[14] + A[21] * B[15] + A[22] * B[16] + A[23] * B[17];
+	C[21] = A[18] * B[18] + A[19] * B[19] + A[20] * B[20] + A[21] * B[21] + A[22] * B[22] + A[23] * B[23];
+	C[22] = A[18] * B[24] + A[19] * B[25] + A[20] * B[26] + A[21] * B[27] + A[22] * B[28] + A[23] * B[29];
+	C[23] = A[18] * B[30] + A[19] * B[31] + A[20] * B[32] + A[21] * B[33] + A[22] * B[34] + A[23] * B[35];
+	C[24] = A[24] * B[0] + A[25] * B[1] + A[26] * B[2] + A[27] * B[3] + A[28] * B[4] + A[29] * B[5];
+	C[25] = A[24] * B[6] + A[25] * B[7] + A[26] * B[8] + A[27] * B[9] + A[28] * B[10] + A[29] * B[11];
+	C[26] = A[24] * B[12] + A[25] * B[13] + A[26] * B[14] + A[27] * B[15] + A[28] * B[16] + A[29] * B[17];
+	C[27] = A[24] * B[18] + A[25] * B[19] + A[26] * B[20] + A[27] * B[21] + A[28] * B[22] + A[29] * B[23];
+	C[28] = A[24] * B[24] + A[25] * B[25] + A[26] * B[26] + A[27] * B[27] + A[28] * B[28] + A[29] * B[29];
+	C[29] = A[24] * B[30] + A[25] * B[31] + A[26] * B[32] + A[27] * B[33] + A[28] * B[34] + A[29] * B[35];
+	C[30] = A[30] * B[0] + A[31] * B[1] + A[32] * B[2] + A[33] * B[3] + A[34] * B[4] + A[35] * B[5];
+	C[31] = A[30] * B[6] + A[31] * B[7] + A[32] * B[8] + A[33] * B[9] + A[34] * B[10] + A[35] * B[11];
+	C[32] = A[30] * B[12] + A[31] * B[13] + A[32] * B[14] + A[33] * B[15] + A[34] * B[16] + A[35] * B[17];
+	C[33] = A[30] * B[18] + A[31] * B[19] + A[32] * B[20] + A[33] * B[21] + A[34] * B[22] + A[35] * B[23];
+	C[34] = A[30] * B[24] + A[31] * B[25] + A[32] * B[26] + A[33] * B[27] + A[34] * B[28] + A[35] * B[29];
+	C[35] = A[30] * B[30] + A[31] * B[31] + A[32] * B[32] + A[33] * B[33] + A[34] * B[34] + A[35] * B[35];
+}
+
+
+void mips_mat6_add_f32(float *C, const float *A, const float *B)
+{
+	C[0] = A[0] + B[0];
+	C[1] = A[1] + B[1];
+	C[2] = A[2] + B[2];
+	C[3] = A[3] + B[3];
+	C[4] = A[4] + B[4];
+	C[5] = A[5] + B[5];
+	C[6] = A[6] + B[6];
+	C[7] = A[7] + B[7];
+	C[8] = A[8] + B[8];
+	C[9] = A[9] + B[9];
+	C[10] = A[10] + B[10];
+	C[11] = A[11] + B[11];
+	C[12] = A[12] + B[12];
+	C[13] = A[13] + B[13];
+	C[14] = A[14] + B[14];
+	C[15] = A[15] + B[15];
+	C[16] = A[16] + B[16];
+	C[17] = A[17] + B[17];
+	C[18] = A[18] + B[18];
+	C[19] = A[19] + B[19];
+	C[20] = A[20] + B[20];
+	C[21] = A[21] + B[21];
+	C[22] = A[22] + B[22];
+	C[23] = A[23] + B[23];
+	C[24] = A[24] + B[24];
+	C[25] = A[25] + B[25];
+	C[26] = A[26] + B[26];
+	C[27] = A[27] + B[27];
+	C[28] = A[28] + B[28];
+	C[29] = A[29] + B[29];
+	C[30] = A[30] + B[30];
+	C[31] = A[31] + B[31];
+	C[32] = A[32] + B[32];
+	C[33] = A[33] + B[33];
+	C[34] = A[34] + B[34];
+	C[35] = A[35] + B[35];
+}
+
+
+void mips_mat6_fpft_f32(float *Pout, const float *F, const float *P, const float *Q)
+{
+	float T[36];
+	float v;
+
+	T[0] = F[0] * P[0] + F[1] * P[6] + F[2] * P[12] + F[3] * P[18] + F[4] * P[24] + F[5] * P[30];
+	T[1] = F[0] * P[1] + F[1] * P[7] + F[2] * P[13] + F[3] * P[19] + F[4] * P[25] + F[5] * P[31];
+	T[2] = F[0] * P[2] + F[1] * P[8] + F[2] * P[14] + F[3] * P[20] + F[4] * P[26] + F[5] * P[32];
+	T[3] = F[0] * P[3] + F[1] * P[9] + F[2] * P[15] + F[3] * P[21] + F[4] * P[27] + F[5] * P[33];
+	T[4] = F[0] * P[4] + F[1] * P[10] + F[2] * P[16] + F[3] * P[22] + F[4] * P[28] + F[5] * P[34];
+	T[5] = F[0] * P[5] + F[1] * P[11] + F[2] * P[17] + F[3] * P[23] + F[4] * P[29] + F[5] * P[35];
+	T[6] = F[6] * P[0] + F[7] * P[6] + F[8] * P[12] + F[9] * P[18] + F[10] * P[24] + F[11] * P[30];
+	T[7] = F[6] * P[1] + F[7] * P[7] + F[8] * P[13] + F[9] * P[19] + F[10] * P[25] + F[11] * P[31];
+	T[8] = F[6] * P[2] + F[7] * P[8] + F[8] * P[14] + F[9] * P[20] + F[10] * P[26] + F[11] * P[32];
+	T[9] = F[6] * P[3] + F[7] * P[9] + F[8] * P[15] + F[9] * P[21] + F[10] * P[27] + F[11] * P[33];
+	T[10] = F[6] * P[4] + F[7] * P[10] + F[8] * P[16] + F[9] * P[22] + F[10] * P[28] + F[11] * P[34];
+	T[11] = F[6] * P[5] + F[7] * P[11] + F[8] * P[17] + F[9] * P[23] + F[10] * P[29] + F[11] * P[35];
+	T[12] = F[12] * P[0] + F[13] * P[6] + F[14] * P[12] + F[15] * P[18] + F[16] * P[24] + F[17] * P[30];
+	T[13] = F[12] * P[1] + F[13] * P[7] + F[14] * P[13] + F[15] * P[19] + F[16] * P[25] + F[17] * P[31];
+	T[14] = F[12] * P[2] + F[13] * P[8] + F[14] * P[14] + F[15] * P[20] + F[16] * P[26] + F[17] * P[32];
+	T[15] = F[12] * P[3] + F[13] * P[9] + F[14] * P[15] + F[15] * P[21] + F[16] * P[27] + F[17] * P[33];
+	T[16] = F[12] * P[4] + F[13] * P[10] + F[14] * P[16] + F[15] * P[22] + F[16] * P[28] + F[17] * P[34];
+	T[17] = F[12] * P[5] + F[13] * P[11] + F[14] * P[17] + F[15] * P[23] + F[16] * P[29] + F[17] * P[35];
+	T[18] = F[18] * P[0] + F[19] * P[6] + F[20] * P[12] + F[21] * P[18] + F[22] * P[24] + F[23] * P[30];
+	T[19] = F[18] * P[1] + F[19] * P[7] + F[20] * P[13] + F[21] * P[19] + F[22] * P[25] + F[23] * P[31];
+	T[20] = F[18] * P[2] + F[19] * P[8] + F[20] * P[14] + F[21] * P[20] + F[22] * P[26] + F[23] * P[32];
+	T[21] = F[18] * P[3] + F[19] * P[9] + F[20] * P[15] + F[21] * P[21] + F[22] * P[27] + F[23] * P[33];
+	T[22] = F[18] * P[4] + F[19] * P[10] + F[20] * P[16] + F[21] * P[22] + F[22] * P[28] + F[23] * P[34];
+	T[23] = F[18] * P[5] + F[19] * P[11] + F[20] * P[17] + F[21] * P[23] + F[22] * P[29] + F[23] * P[35];
+	T[24] = F[24] * P[0] + F[25] * P[6] + F[26] * P[12] + F[27] * P[18] + F[28] * P[24] + F[29] * P[30];
+	T[25] = F[24] * P[1] + F[25] * P[7] + F[26] * P[13] + F[27] * P[19] + F[28] * P[25] + F[29] * P[31];
+	T[26] = F[24] * P[2] + F[25] * P[8] + F[26] * P[14] + F[27] * P[20] + F[28] * P[26] + F[29] * P[32];
+	T[27] = F[24] * P[3] + F[25] * P[9] + F[26] * P[15] + F[27] * P[21] + F[28] * P[27] + F[29] * P[33];
+	T[28] = F[24] * P[4] + F[25] * P[10] + F[26] * P[16] + F[27] * P[22] + F[28] * P[28] + F[29] * P[34];
+	T[29] = F[24] * P[5] + F[25] * P[11] + F[26] * P[17] + F[27] * P[23] + F[28] * P[29] + F[29] * P[35];
+	T[30] = F[30] * P[0] + F[31] * P[6] + F[32] * P[12] + F[33] * P[18] + F[34] * P[24] + F[35] * P[30];
+	T[31] = F[30] * P[1] + F[31] * P[7] + F[32] * P[13] + F[33] * P[19] + F[34] * P[25] + F[35] * P[31];
+	T[32] = F[30] * P[2] + F[31] * P[8] + F[32] * P[14] + F[33] * P[20] + F[34] * P[26] + F[35] * P[32];
+	T[33] = F[30] * P[3] + F[31] * P[9] + F[32] * P[15] + F[33] * P[21] + F[34] * P[27] + F[35] * P[33];
+	T[34] = F[30] * P[4] + F[31] * P[10] + F[32] * P[16] + F[33] * P[22] + F[34] * P[28] + F[35] * P[34];
+	T[35] = F[30] * P[5] + F[31] * P[11] + F[32] * P[17] + F[33] * P[23] + F[34] * P[29] + F[35] * P[35];
+
+	v = T[0] * F[0] + T[1] * F[1] + T[2] * F[2] + T[3] * F[3] + T[4] * F[4] + T[5] * F[5] + Q[0];
+	Pout[0] = v;
+	v = T[0] * F[6] + T[1] * F[7] + T[2] * F[8] + T[3] * F[9] + T[4] * F[10] + T[5] * F[11] + Q[1];
+	Pout[1] = Pout[6] = v;
+	v = T[0] * F[12] + T[1] * F[13] + T[2] * F[14] + T[3] * F[15] + T[4] * F[16] + T[5] * F[17] + Q[2];
+	Pout[2] = Pout[12] = v;
+	v = T[0] * F[18] + T[1] * F[19] + T[2] * F[20] + T[3] * F[21] + T[4] * F[22] + T[5] * F[23] + Q[3];
+	Pout[3] = Pout[18] = v;
+	v = T[0] * F[24] + T[1] * F[25] + T[2] * F[26] + T[3] * F[27] + T[4] * F[28] + T[5] * F[29] + Q[4];
+	Pout[4] = Pout[24] = v;
+	v = T[0] * F[30] + T[1] * F[31] + T[2] * F[32] + T[3] * F[33] + T[4] * F[34] + T[5] * F[35] + Q[5];
+	Pout[5] = Pout[30] = v;
+	v = T[6] * F[6] + T[7] * F[7] + T[8] * F[8] + T[9] * F[9] + T[10] * F[10] + T[11] * F[11] + Q[7];
+	Pout[7] = v;
+	v = T[6] * F[12] + T[7] * F[13] + T[8] * F[14] + T[9] * F[15] + T[10] * F[16] + T[11] * F[17] + Q[8];
+	Pout[8] = Pout[13] = v;
+	v = T[6] * F[18] + T[7] * F[19] + T[8] * F[20] + T[9] * F[21] + T[10] * F[22] + T[11] * F[23] + Q[9];
+	Pout[9] = Pout[19] = v;
+	v = T[6] * F[24] + T[7] * F[25] + T[8] * F[26] + T[9] * F[27] + T[10] * F[28] + T[11] * F[29] + Q[10];
+	Pout[10] = Pout[25] = v;
+	v = T[6] * F[30] + T[7] * F[31] + T[8] * F[32] + T[9] * F[33] + T[10] * F[34] + T[11] * F[35] + Q[11];
+	Pout[11] = Pout[31] = v;
+	v = T[12] * F[12] + T[13] * F[13] + T[14] * F[14] + T[15] * F[15] + T[16] * F[16] + T[17] * F[17] + Q[14];
+	Pout[14] = v;
+	v = T[12] * F[18] + T[13] * F[19] + T[14] * F[20] + T[15] * F[21] + T[16] * F[22] + T[17] * F[23] + Q[15];
+	Pout[15] = Pout[20] = v;
+	v = T[12] * F[24] + T[13] * F[25] + T[14] * F[26] + T[15] * F[27] + T[16] * F[28] + T[17] * F[29] + Q[16];
+	Pout[16] = Pout[26] = v;
+	v = T[12] * F[30] + T[13] * F[31] + T[14] * F[32] + T[15] * F[33] + T[16] * F[34] + T[17] * F[35] + Q[17];
+	Pout[17] = Pout[32] = v;
+	v = T[18] * F[18] + T[19] * F[19] + T[20] * F[20] + T[21] * F[21] + T[22] * F[22] + T[23] * F[23] + Q[21];
+	Pout[21] = v;
+	v = T[18] * F[24] + T[19] * F[25] + T[20] * F[26] + T[21] * F[27] + T[22] * F[28] + T[23] * F[29] + Q[22];
+	Pout[22] = Pout[27] = v;
+	v = T[18] * F[30] + T[19] * F[31] + T[20] * F[32] + T[21] * F[33] + T[22] * F[34] + T[23] * F[35] + Q[23];
+	Pout[23] = Pout[33] = v;
+	v = T[24] * F[24] + T[25] * F[25] + T[26] * F[26] + T[27] * F[27] + T[28] * F[28] + T[29] * F[29] + Q[28];
+	Pout[28] = v;
+	v = T[24] * F[30] + T[25] * F[31] + T[26] * F[32] + T[27] * F[33] + T[28] * F[34] + T[29] * F[35] + Q[29];
+	Pout[29] = Pout[34] = v;
+	v = T[30] * F[30] + T[31] * F[31] + T[32] * F[32] + T[33] * F[33] + T[34] * F[34] + T[35] * F[35] + Q[35];
+	Pout[35] = v;
+}
+
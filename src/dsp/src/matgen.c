@@ -0,0 +1,186 @@
+/*
+ * Small matrix generator, see fftc-README.txt for the approach.
+ *
+ * Writes fully unrolled N x N kernels for N = 3, 4 and 6, one file per
+ * size and type: mat<N>_f32.c (single precision) and mat<N>_32.c (Q31),
+ * declared in dsplib_dsp.h. Matrices are row-major float[N*N] or
+ * int32[N*N].
+ *
+ *   mips_mat<N>_mul:    C = A B
+ *   mips_mat<N>_mul_t:  C = A B^T
+ *   mips_mat<N>_add:    C = A + B
+ *   mips_mat<N>_fpft:   P' = F P F^T + Q, Q symmetric
+ *
+ * Every element is a single expression, so GCC keeps the sums in
+ * registers: madd.s chains with the FPU (PIC32MZ-EF). A Q31 product is
+ * up to 2^62 in Q62 and N of them can pass 2^63, so each is shifted
+ * right by QS bits first, QS = 1 for N = 3 and 2 for N = 4 and 6 (the
+ * fpft sums have one more term, Q); the int64 sum then holds anything
+ * up to the saturation limit.
+ *
+ *   gcc -o matgen matgen.c && ./matgen
+ */
+
+#include <stdio.h>
+#include <assert.h>
+
+
+/* element (i, j) of an n x n row-major matrix */
+#define E(i, j)  ((i) * n + (j))
+
+
+/* product shift for the Q31 sums of n + 1 terms */
+#define QS(n)  ((n) <= 3 ? 1 : 2)
+
+
+static void Sum(FILE *fp, int n, int f32, const char *a, int ai, int as,
+				const char *b, int bi, int bs)
+{
+  int k;
+
+  for (k = 0; k < n; k++)
+  {
+	if (f32)
+	  fprintf(fp, "%s%s[%d] * %s[%d]", k ? " + " : "",
+			  a, ai + k * as, b, bi + k * bs);
+	else
+	  fprintf(fp, "%s(((int64) %s[%d] * %s[%d]) >> %d)", k ? "\n\t\t+ " : "",
+			  a, ai + k * as, b, bi + k * bs, QS(n));
+  }
+}
+
+
+/* out = a b, or a b^T when bt */
+
+static void Product(FILE *fp, int n, int f32, const char *out, const char *a,
+					const char *b, int bt)
+{
+  int i, j;
+
+  for (i = 0; i < n; i++)
+  {
+	for (j = 0; j < n; j++)
+	{
+	  if (f32)
+	  {
+		fprintf(fp, "\t%s[%d] = ", out, E(i, j));
+		Sum(fp, n, 1, a, E(i, 0), 1, b, bt ? E(j, 0) : E(0, j), bt ? 1 : n);
+		fprintf(fp, ";\n");
+	  }
+	  else
+	  {
+		fprintf(fp, "\t%s[%d] = mat32_round(", out, E(i, j));
+		Sum(fp, n, 0, a, E(i, 0), 1, b, bt ? E(j, 0) : E(0, j), bt ? 1 : n);
+		fprintf(fp, ");\n");
+	  }
+	}
+  }
+}
+
+
+static void CalcMatrix(int n, int f32)
+{
+  const char *t = f32 ? "float" : "int32";
+  const char *s = f32 ? "_f32" : "32";
+  char filename[100];
+  int i, j;
+
+  sprintf(filename, "mat%d%s.c", n, f32 ? "_f32" : "_32");
+  FILE *fp = fopen(filename, "wt");
+  assert(fp != NULL);
+
+  fprintf(fp, "/* generated by matgen.c */\n\n");
+  fprintf(fp, "#include \"../../../include/dsplib_dsp.h\"\n\n");
+
+  if (!f32)
+  {
+	fprintf(fp, "\nstatic inline int32 mat32_sat(int64 v)\n{\n");
+	fprintf(fp, "\treturn (v > MAX32) ? MAX32 : (v < MIN32) ? MIN32 : (int32) v;\n");
+	fprintf(fp, "}\n\n");
+	fprintf(fp, "\n/* round a Q%d sum to Q31 and saturate */\n\n", 62 - QS(n));
+	fprintf(fp, "static inline int32 mat32_round(int64 v)\n{\n");
+	fprintf(fp, "\treturn mat32_sat((v + 0x%x) >> %d);\n", 0x40000000 >> QS(n), 31 - QS(n));
+	fprintf(fp, "}\n\n");
+  }
+
+  /* C = A B */
+
+  fprintf(fp, "\nvoid mips_mat%d_mul%s(%s *C, const %s *A, const %s *B)\n{\n",
+		  n, s, t, t, t);
+  Product(fp, n, f32, "C", "A", "B", 0);
+  fprintf(fp, "}\n\n");
+
+  /* C = A B^T */
+
+  fprintf(fp, "\nvoid mips_mat%d_mul_t%s(%s *C, const %s *A, const %s *B)\n{\n",
+		  n, s, t, t, t);
+  Product(fp, n, f32, "C", "A", "B", 1);
+  fprintf(fp, "}\n\n");
+
+  /* C = A + B */
+
+  fprintf(fp, "\nvoid mips_mat%d_add%s(%s *C, const %s *A, const %s *B)\n{\n",
+		  n, s, t, t, t);
+  for (i = 0; i < n * n; i++)
+  {
+	if (f32)
+	  fprintf(fp, "\tC[%d] = A[%d] + B[%d];\n", i, i, i);
+	else
+	  fprintf(fp, "\tC[%d] = mat32_sat((int64) A[%d] + B[%d]);\n", i, i, i);
+  }
+  fprintf(fp, "}\n\n");
+
+  /*
+   * P' = F P F^T + Q: T = F P first, then the upper triangle of T F^T + Q,
+   * mirrored into the lower one. P is only read while T is formed and Q
+   * only above the diagonal, so Pout may be P or Q.
+   */
+
+  fprintf(fp, "\nvoid mips_mat%d_fpft%s(%s *Pout, const %s *F, const %s *P, const %s *Q)\n{\n",
+		  n, s, t, t, t, t);
+  fprintf(fp, "\t%s T[%d];\n", t, n * n);
+  fprintf(fp, "\t%s v;\n\n", t);
+  Product(fp, n, f32, "T", "F", "P", 0);
+  fprintf(fp, "\n");
+  for (i = 0; i < n; i++)
+  {
+	for (j = i; j < n; j++)
+	{
+	  if (f32)
+	  {
+		fprintf(fp, "\tv = ");
+		Sum(fp, n, 1, "T", E(i, 0), 1, "F", E(j, 0), 1);
+		fprintf(fp, " + Q[%d];\n", E(i, j));
+	  }
+	  else
+	  {
+		fprintf(fp, "\tv = mat32_round(");
+		Sum(fp, n, 0, "T", E(i, 0), 1, "F", E(j, 0), 1);
+		fprintf(fp, "\n\t\t+ (int64) Q[%d] * (1 << %d));\n", E(i, j), 31 - QS(n));
+	  }
+
+	  if (i == j)
+		fprintf(fp, "\tPout[%d] = v;\n", E(i, i));
+	  else
+		fprintf(fp, "\tPout[%d] = Pout[%d] = v;\n", E(i, j), E(j, i));
+	}
+  }
+  fprintf(fp, "}\n\n");
+
+  fclose(fp);
+}
+
+
+int main()
+{
+  static const int sizes[] = { 3, 4, 6 };
+  int i;
+
+  for (i = 0; i < (int) (sizeof(sizes) / sizeof(sizes[0])); i++)
+  {
+	CalcMatrix(sizes[i], 1);
+	CalcMatrix(sizes[i], 0);
+  }
+
+  return 0;
+}
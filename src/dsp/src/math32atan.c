@@ -0,0 +1,14 @@
+#include "../../../include/dsplib_math.h"
+
+const int32 mips_math32_atan[32] =
+{
+	0x20000000, 0x12e4051e, 0x09fb385b, 0x051111d4,
+	0x028b0d43, 0x0145d7e1, 0x00a2f61e, 0x00517c55,
+	0x0028be53, 0x00145f2f, 0x000a2f98, 0x000517cc,
+	0x00028be6, 0x000145f3, 0x0000a2fa, 0x0000517d,
+	0x000028be, 0x0000145f, 0x00000a30, 0x00000518,
+	0x0000028c, 0x00000146, 0x000000a3, 0x00000051,
+	0x00000029, 0x00000014, 0x0000000a, 0x00000005,
+	0x00000003, 0x00000001, 0x00000001, 0x00000000,
+};
+
@@ -0,0 +1,76 @@
+#include "../../../include/dsplib_math.h"
+
+const uint32 mips_math32_log2_inv[129] =
+{
+	0x80000000, 0x7f01fc08, 0x7e07e07e, 0x7d119679,
+	0x7c1f07c2, 0x7b301ecc, 0x7a44c6b0, 0x795ceb24,
+	0x78787878, 0x77975b90, 0x76b981db, 0x75ded953,
+	0x75075075, 0x7432d63e, 0x73615a24, 0x7292cc15,
+	0x71c71c72, 0x70fe3c07, 0x70381c0e, 0x6f74ae26,
+	0x6eb3e453, 0x6df5b0f7, 0x6d3a06d4, 0x6c80d902,
+	0x6bca1af3, 0x6b15c06b, 0x6a63bd82, 0x69b4069b,
+	0x69069069, 0x685b4fe6, 0x67b23a54, 0x670b453c,
+	0x66666666, 0x65c393e0, 0x6522c3f3, 0x6483ed27,
+	0x63e7063e, 0x634c0635, 0x62b2e43e, 0x621b97c3,
+	0x61861862, 0x60f25deb, 0x60606060, 0x5fd017f4,
+	0x5f417d06, 0x5eb48824, 0x5e293206, 0x5d9f7391,
+	0x5d1745d1, 0x5c90a1fd, 0x5c0b8170, 0x5b87ddad,
+	0x5b05b05b, 0x5a84f345, 0x5a05a05a, 0x5987b1a9,
+	0x590b2164, 0x588fe9dc, 0x58160581, 0x579d6ee3,
+	0x572620ae, 0x56b015ac, 0x563b48c2, 0x55c7b4f1,
+	0x55555555, 0x54e42524, 0x54741fac, 0x54054054,
+	0x5397829d, 0x532ae21d, 0x52bf5a81, 0x5254e78f,
+	0x51eb851f, 0x51832f20, 0x511be196, 0x50b59897,
+	0x50505050, 0x4fec04ff, 0x4f88b2f4, 0x4f265692,
+	0x4ec4ec4f, 0x4e6470b0, 0x4e04e04e, 0x4da637cf,
+	0x4d4873ed, 0x4ceb916d, 0x4c8f8d29, 0x4c346405,
+	0x4bda12f7, 0x4b809701, 0x4b27ed36, 0x4ad012b4,
+	0x4a7904a8, 0x4a22c04a, 0x49cd42e2, 0x497889c2,
+	0x49249249, 0x48d159e2, 0x487ede05, 0x482d1c32,
+	0x47dc11f7, 0x478bbced, 0x473c1ab7, 0x46ed2901,
+	0x469ee584, 0x46514e02, 0x46046046, 0x45b81a25,
+	0x456c797e, 0x45217c38, 0x44d72045, 0x448d639d,
+	0x44444444, 0x43fbc044, 0x43b3d5b0, 0x436c82a2,
+	0x4325c53f, 0x42df9bb1, 0x429a042a, 0x4254fce4,
+	0x42108421, 0x41cc9829, 0x4189374c, 0x41465fdf,
+	0x41041041, 0x40c246d4, 0x40810204, 0x40404040,
+	0x40000000,
+};
+
+const uint32 mips_math32_log2[129] =
+{
+	0x00000000, 0x016fe50b, 0x02dcf2d1, 0x04473475,
+	0x05aeb4dd, 0x07137eae, 0x08759c50, 0x09d517ef,
+	0x0b31fb7d, 0x0c8c50b7, 0x0de42120, 0x0f397609,
+	0x108c588d, 0x11dcd197, 0x132ae9e2, 0x1476a9fa,
+	0x15c01a3a, 0x170742d5, 0x184c2bd0, 0x198edd07,
+	0x1acf5e2e, 0x1c0db6ce, 0x1d49ee4c, 0x1e840be7,
+	0x1fbc16b9, 0x20f215b7, 0x22260fb6, 0x23580b65,
+	0x24880f56, 0x25b621f9, 0x26e2499d, 0x280c8c76,
+	0x2934f098, 0x2a5b7bf9, 0x2b803474, 0x2ca31fc9,
+	0x2dc4439b, 0x2ee3a575, 0x30014ac6, 0x311d38e6,
+	0x32377512, 0x33500472, 0x3466ec15, 0x357c30f3,
+	0x368fd7ee, 0x37a1e5d4, 0x38b25f5a, 0x39c14924,
+	0x3acea7c0, 0x3bda7fa9, 0x3ce4d544, 0x3dedace6,
+	0x3ef50ad2, 0x3ffaf335, 0x40ff6a2e, 0x420273ca,
+	0x43041403, 0x44044ec5, 0x450327eb, 0x4600a33e,
+	0x46fcc47a, 0x47f78f4c, 0x48f10751, 0x49e93016,
+	0x4ae00d1d, 0x4bd5a1d8, 0x4cc9f1ab, 0x4dbcffee,
+	0x4eaecfeb, 0x4f9f64de, 0x508ec1fa, 0x517cea63,
+	0x5269e12f, 0x5355a96d, 0x5440461c, 0x5529ba33,
+	0x5612089a, 0x56f93433, 0x57df3fd0, 0x58c42e3d,
+	0x59a80239, 0x5a8abe79, 0x5b6c65aa, 0x5c4cfa6c,
+	0x5d2c7f59, 0x5e0af6ff, 0x5ee863e5, 0x5fc4c886,
+	0x60a02757, 0x617a82c3, 0x6253dd2c, 0x632c38ed,
+	0x64039858, 0x64d9fdb7, 0x65af6b4b, 0x6683e34f,
+	0x675767f5, 0x6829fb69, 0x68fb9fce, 0x69cc5741,
+	0x6a9c23d6, 0x6b6b079c, 0x6c39049b, 0x6d061cd3,
+	0x6dd2523d, 0x6e9da6ce, 0x6f681c73, 0x7031b512,
+	0x70fa728c, 0x71c256ba, 0x72896373, 0x734f9a83,
+	0x7414fdb5, 0x74d98eca, 0x759d4f81, 0x76604191,
+	0x772266ad, 0x77e3c082, 0x78a450b8, 0x796418f2,
+	0x7a231ace, 0x7ae157e3, 0x7b9ed1c7, 0x7c5b8a07,
+	0x7d17822f, 0x7dd2bbc4, 0x7e8d3846, 0x7f46f932,
+	0x80000000,
+};
+
@@ -0,0 +1,18 @@
+#include "../../../include/dsplib_math.h"
+
+const uint32 mips_math32_rsqrt[48] =
+{
+	0x7e0bb221, 0x7a64336b, 0x77099efb, 0x73f1f68d,
+	0x7114f644, 0x6e6bb6e9, 0x6bf06762, 0x699e16d0,
+	0x67708af9, 0x65641fae, 0x6375ad16, 0x61a27320,
+	0x5fe808fc, 0x5e444faf, 0x5cb56711, 0x5b39a4c7,
+	0x59cf8cbc, 0x5875cade, 0x572b2de0, 0x55eea2c4,
+	0x54bf311a, 0x539bf7cd, 0x52842a5f, 0x51770e8f,
+	0x5073fa50, 0x4f7a5202, 0x4e8986ea, 0x4da115da,
+	0x4cc08605, 0x4be767f5, 0x4b1554a6, 0x4a49ecb3,
+	0x4984d7a4, 0x48c5c34b, 0x480c6332, 0x4758701c,
+	0x46a9a794, 0x45ffcb80, 0x455aa1cb, 0x44b9f40b,
+	0x441d8f3b, 0x43854374, 0x42f0e3ae, 0x4260458e,
+	0x41d3412a, 0x4149b0e5, 0x40c3713b, 0x404060a1,
+};
+
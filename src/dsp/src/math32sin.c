@@ -0,0 +1,134 @@
+#include "../../../include/dsplib_math.h"
+
+const int32 mips_math32_sin[512] =
+{
+	0x00000000, 0x01921d20, 0x03242abf, 0x04b6195d,
+	0x0647d97c, 0x07d95b9e, 0x096a9049, 0x0afb6805,
+	0x0c8bd35e, 0x0e1bc2e4, 0x0fab272b, 0x1139f0cf,
+	0x12c8106f, 0x145576b1, 0x15e21445, 0x176dd9de,
+	0x18f8b83c, 0x1a82a026, 0x1c0b826a, 0x1d934fe5,
+	0x1f19f97b, 0x209f701c, 0x2223a4c5, 0x23a6887f,
+	0x25280c5e, 0x26a82186, 0x2826b928, 0x29a3c485,
+	0x2b1f34eb, 0x2c98fbba, 0x2e110a62, 0x2f875262,
+	0x30fbc54d, 0x326e54c7, 0x33def287, 0x354d9057,
+	0x36ba2014, 0x382493b0, 0x398cdd32, 0x3af2eeb7,
+	0x3c56ba70, 0x3db832a6, 0x3f1749b8, 0x4073f21d,
+	0x41ce1e65, 0x4325c135, 0x447acd50, 0x45cd358f,
+	0x471cece7, 0x4869e665, 0x49b41533, 0x4afb6c98,
+	0x4c3fdff4, 0x4d8162c4, 0x4ebfe8a5, 0x4ffb654d,
+	0x5133cc94, 0x5269126e, 0x539b2af0, 0x54ca0a4b,
+	0x55f5a4d2, 0x571deefa, 0x5842dd54, 0x59646498,
+	0x5a82799a, 0x5b9d1154, 0x5cb420e0, 0x5dc79d7c,
+	0x5ed77c8a, 0x5fe3b38d, 0x60ec3830, 0x61f1003f,
+	0x62f201ac, 0x63ef3290, 0x64e88926, 0x65ddfbd3,
+	0x66cf8120, 0x67bd0fbd, 0x68a69e81, 0x698c246c,
+	0x6a6d98a4, 0x6b4af279, 0x6c242960, 0x6cf934fc,
+	0x6dca0d14, 0x6e96a99d, 0x6f5f02b2, 0x7023109a,
+	0x70e2cbc6, 0x719e2cd2, 0x72552c85, 0x7307c3d0,
+	0x73b5ebd1, 0x745f9dd1, 0x7504d345, 0x75a585cf,
+	0x7641af3d, 0x76d94989, 0x776c4edb, 0x77fab989,
+	0x78848414, 0x7909a92d, 0x798a23b1, 0x7a05eead,
+	0x7a7d055b, 0x7aef6323, 0x7b5d039e, 0x7bc5e290,
+	0x7c29fbee, 0x7c894bde, 0x7ce3ceb2, 0x7d3980ec,
+	0x7d8a5f40, 0x7dd6668f, 0x7e1d93ea, 0x7e5fe493,
+	0x7e9d55fc, 0x7ed5e5c6, 0x7f0991c4, 0x7f3857f6,
+	0x7f62368f, 0x7f872bf3, 0x7fa736b4, 0x7fc25596,
+	0x7fd8878e, 0x7fe9cbc0, 0x7ff62182, 0x7ffd885a,
+	0x7fffffff, 0x7ffd885a, 0x7ff62182, 0x7fe9cbc0,
+	0x7fd8878e, 0x7fc25596, 0x7fa736b4, 0x7f872bf3,
+	0x7f62368f, 0x7f3857f6, 0x7f0991c4, 0x7ed5e5c6,
+	0x7e9d55fc, 0x7e5fe493, 0x7e1d93ea, 0x7dd6668f,
+	0x7d8a5f40, 0x7d3980ec, 0x7ce3ceb2, 0x7c894bde,
+	0x7c29fbee, 0x7bc5e290, 0x7b5d039e, 0x7aef6323,
+	0x7a7d055b, 0x7a05eead, 0x798a23b1, 0x7909a92d,
+	0x78848414, 0x77fab989, 0x776c4edb, 0x76d94989,
+	0x7641af3d, 0x75a585cf, 0x7504d345, 0x745f9dd1,
+	0x73b5ebd1, 0x7307c3d0, 0x72552c85, 0x719e2cd2,
+	0x70e2cbc6, 0x7023109a, 0x6f5f02b2, 0x6e96a99d,
+	0x6dca0d14, 0x6cf934fc, 0x6c242960, 0x6b4af279,
+	0x6a6d98a4, 0x698c246c, 0x68a69e81, 0x67bd0fbd,
+	0x66cf8120, 0x65ddfbd3, 0x64e88926, 0x63ef3290,
+	0x62f201ac, 0x61f1003f, 0x60ec3830, 0x5fe3b38d,
+	0x5ed77c8a, 0x5dc79d7c, 0x5cb420e0, 0x5b9d1154,
+	0x5a82799a, 0x59646498, 0x5842dd54, 0x571deefa,
+	0x55f5a4d2, 0x54ca0a4b, 0x539b2af0, 0x5269126e,
+	0x5133cc94, 0x4ffb654d, 0x4ebfe8a5, 0x4d8162c4,
+	0x4c3fdff4, 0x4afb6c98, 0x49b41533, 0x4869e665,
+	0x471cece7, 0x45cd358f, 0x447acd50, 0x4325c135,
+	0x41ce1e65, 0x4073f21d, 0x3f1749b8, 0x3db832a6,
+	0x3c56ba70, 0x3af2eeb7, 0x398cdd32, 0x382493b0,
+	0x36ba2014, 0x354d9057, 0x33def287, 0x326e54c7,
+	0x30fbc54d, 0x2f875262, 0x2e110a62, 0x2c98fbba,
+	0x2b1f34eb, 0x29a3c485, 0x2826b928, 0x26a82186,
+	0x25280c5e, 0x23a6887f, 0x2223a4c5, 0x209f701c,
+	0x1f19f97b, 0x1d934fe5, 0x1c0b826a, 0x1a82a026,
+	0x18f8b83c, 0x176dd9de, 0x15e21445, 0x145576b1,
+	0x12c8106f, 0x1139f0cf, 0x0fab272b, 0x0e1bc2e4,
+	0x0c8bd35e, 0x0afb6805, 0x096a9049, 0x07d95b9e,
+	0x0647d97c, 0x04b6195d, 0x03242abf, 0x01921d20,
+	0x00000000, 0xfe6de2e0, 0xfcdbd541, 0xfb49e6a3,
+	0xf9b82684, 0xf826a462, 0xf6956fb7, 0xf50497fb,
+	0xf3742ca2, 0xf1e43d1c, 0xf054d8d5, 0xeec60f31,
+	0xed37ef91, 0xebaa894f, 0xea1debbb, 0xe8922622,
+	0xe70747c4, 0xe57d5fda, 0xe3f47d96, 0xe26cb01b,
+	0xe0e60685, 0xdf608fe4, 0xdddc5b3b, 0xdc597781,
+	0xdad7f3a2, 0xd957de7a, 0xd7d946d8, 0xd65c3b7b,
+	0xd4e0cb15, 0xd3670446, 0xd1eef59e, 0xd078ad9e,
+	0xcf043ab3, 0xcd91ab39, 0xcc210d79, 0xcab26fa9,
+	0xc945dfec, 0xc7db6c50, 0xc67322ce, 0xc50d1149,
+	0xc3a94590, 0xc247cd5a, 0xc0e8b648, 0xbf8c0de3,
+	0xbe31e19b, 0xbcda3ecb, 0xbb8532b0, 0xba32ca71,
+	0xb8e31319, 0xb796199b, 0xb64beacd, 0xb5049368,
+	0xb3c0200c, 0xb27e9d3c, 0xb140175b, 0xb0049ab3,
+	0xaecc336c, 0xad96ed92, 0xac64d510, 0xab35f5b5,
+	0xaa0a5b2e, 0xa8e21106, 0xa7bd22ac, 0xa69b9b68,
+	0xa57d8666, 0xa462eeac, 0xa34bdf20, 0xa2386284,
+	0xa1288376, 0xa01c4c73, 0x9f13c7d0, 0x9e0effc1,
+	0x9d0dfe54, 0x9c10cd70, 0x9b1776da, 0x9a22042d,
+	0x99307ee0, 0x9842f043, 0x9759617f, 0x9673db94,
+	0x9592675c, 0x94b50d87, 0x93dbd6a0, 0x9306cb04,
+	0x9235f2ec, 0x91695663, 0x90a0fd4e, 0x8fdcef66,
+	0x8f1d343a, 0x8e61d32e, 0x8daad37b, 0x8cf83c30,
+	0x8c4a142f, 0x8ba0622f, 0x8afb2cbb, 0x8a5a7a31,
+	0x89be50c3, 0x8926b677, 0x8893b125, 0x88054677,
+	0x877b7bec, 0x86f656d3, 0x8675dc4f, 0x85fa1153,
+	0x8582faa5, 0x85109cdd, 0x84a2fc62, 0x843a1d70,
+	0x83d60412, 0x8376b422, 0x831c314e, 0x82c67f14,
+	0x8275a0c0, 0x82299971, 0x81e26c16, 0x81a01b6d,
+	0x8162aa04, 0x812a1a3a, 0x80f66e3c, 0x80c7a80a,
+	0x809dc971, 0x8078d40d, 0x8058c94c, 0x803daa6a,
+	0x80277872, 0x80163440, 0x8009de7e, 0x800277a6,
+	0x80000001, 0x800277a6, 0x8009de7e, 0x80163440,
+	0x80277872, 0x803daa6a, 0x8058c94c, 0x8078d40d,
+	0x809dc971, 0x80c7a80a, 0x80f66e3c, 0x812a1a3a,
+	0x8162aa04, 0x81a01b6d, 0x81e26c16, 0x82299971,
+	0x8275a0c0, 0x82c67f14, 0x831c314e, 0x8376b422,
+	0x83d60412, 0x843a1d70, 0x84a2fc62, 0x85109cdd,
+	0x8582faa5, 0x85fa1153, 0x8675dc4f, 0x86f656d3,
+	0x877b7bec, 0x88054677, 0x8893b125, 0x8926b677,
+	0x89be50c3, 0x8a5a7a31, 0x8afb2cbb, 0x8ba0622f,
+	0x8c4a142f, 0x8cf83c30, 0x8daad37b, 0x8e61d32e,
+	0x8f1d343a, 0x8fdcef66, 0x90a0fd4e, 0x91695663,
+	0x9235f2ec, 0x9306cb04, 0x93dbd6a0, 0x94b50d87,
+	0x9592675c, 0x9673db94, 0x9759617f, 0x9842f043,
+	0x99307ee0, 0x9a22042d, 0x9b1776da, 0x9c10cd70,
+	0x9d0dfe54, 0x9e0effc1, 0x9f13c7d0, 0xa01c4c73,
+	0xa1288376, 0xa2386284, 0xa34bdf20, 0xa462eeac,
+	0xa57d8666, 0xa69b9b68, 0xa7bd22ac, 0xa8e21106,
+	0xaa0a5b2e, 0xab35f5b5, 0xac64d510, 0xad96ed92,
+	0xaecc336c, 0xb0049ab3, 0xb140175b, 0xb27e9d3c,
+	0xb3c0200c, 0xb5049368, 0xb64beacd, 0xb796199b,
+	0xb8e31319, 0xba32ca71, 0xbb8532b0, 0xbcda3ecb,
+	0xbe31e19b, 0xbf8c0de3, 0xc0e8b648, 0xc247cd5a,
+	0xc3a94590, 0xc50d1149, 0xc67322ce, 0xc7db6c50,
+	0xc945dfec, 0xcab26fa9, 0xcc210d79, 0xcd91ab39,
+	0xcf043ab3, 0xd078ad9e, 0xd1eef59e, 0xd3670446,
+	0xd4e0cb15, 0xd65c3b7b, 0xd7d946d8, 0xd957de7a,
+	0xdad7f3a2, 0xdc597781, 0xdddc5b3b, 0xdf608fe4,
+	0xe0e60685, 0xe26cb01b, 0xe3f47d96, 0xe57d5fda,
+	0xe70747c4, 0xe8922622, 0xea1debbb, 0xebaa894f,
+	0xed37ef91, 0xeec60f31, 0xf054d8d5, 0xf1e43d1c,
+	0xf3742ca2, 0xf50497fb, 0xf6956fb7, 0xf826a462,
+	0xf9b82684, 0xfb49e6a3, 0xfcdbd541, 0xfe6de2e0,
+};
+
@@ -0,0 +1,95 @@
+/*
+ * Table generator for the fixed-point functions in dsplib_math.h, see
+ * fftc-README.txt for the approach. Writes one file per table:
+ *
+ *   math32sin.c    sin(2 pi i / 512), Q31, i = 0 .. 511
+ *   math32atan.c   atan(2^-i), i = 0 .. 31, binary angle (2^31 = pi)
+ *   math32rsqrt.c  1/sqrt(v) in the middle of [i/64, (i+1)/64), i = 16 .. 63, Q30
+ *   math32log2.c   1/t and log2(t) for t = 1 + i/128, i = 0 .. 128, Q31
+ *   math32exp2.c   2^(i/64), i = 0 .. 63, Q30
+ *
+ *   gcc -o mathcgen mathcgen.c -lm && ./mathcgen
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <assert.h>
+
+
+static FILE *Open(const char *name)
+{
+  char filename[100];
+
+  sprintf(filename, "%s.c", name);
+  FILE *fp = fopen(filename, "wt");
+  assert(fp != NULL);
+
+  fprintf(fp, "#include \"../../../include/dsplib_math.h\"\n\n");
+  return fp;
+}
+
+
+/* round v * 2^q, clamped to [lo, hi] */
+
+static double Fix(double v, int q, double lo, double hi)
+{
+  v = floor(ldexp(v, q) + 0.5);
+  return (v < lo) ? lo : (v > hi) ? hi : v;
+}
+
+
+static void Table(FILE *fp, const char *type, const char *name, const double *v, int n)
+{
+  int i;
+
+  fprintf(fp, "const %s %s[%d] =\n{", type, name, n);
+
+  for (i = 0; i < n; i++)
+	fprintf(fp, (i % 4) ? " 0x%08x," : "\n\t0x%08x,", (unsigned int) (long long) v[i]);
+
+  fprintf(fp, "\n};\n\n");
+}
+
+
+int main()
+{
+  double v[512], w[129];
+  FILE *fp;
+  int i;
+
+  fp = Open("math32sin");
+  for (i = 0; i < 512; i++)
+	v[i] = Fix(sin(2.0 * M_PI * i / 512), 31, -2147483647.0, 2147483647.0);
+  Table(fp, "int32", "mips_math32_sin", v, 512);
+  fclose(fp);
+
+  fp = Open("math32atan");
+  for (i = 0; i < 32; i++)
+	v[i] = Fix(atan(ldexp(1.0, -i)) / M_PI, 31, 0, 2147483647.0);
+  Table(fp, "int32", "mips_math32_atan", v, 32);
+  fclose(fp);
+
+  fp = Open("math32rsqrt");
+  for (i = 0; i < 48; i++)
+	v[i] = Fix(1.0 / sqrt((i + 16.5) / 64), 30, 0, 4294967295.0);
+  Table(fp, "uint32", "mips_math32_rsqrt", v, 48);
+  fclose(fp);
+
+  fp = Open("math32log2");
+  for (i = 0; i <= 128; i++)
+  {
+	v[i] = Fix(128.0 / (128 + i), 31, 0, 4294967295.0);
+	w[i] = Fix(log2((128.0 + i) / 128), 31, 0, 4294967295.0);
+  }
+  Table(fp, "uint32", "mips_math32_log2_inv", v, 129);
+  Table(fp, "uint32", "mips_math32_log2", w, 129);
+  fclose(fp);
+
+  fp = Open("math32exp2");
+  for (i = 0; i < 64; i++)
+	v[i] = Fix(exp2(i / 64.0), 30, 0, 2147483647.0);
+  Table(fp, "int32", "mips_math32_exp2", v, 64);
+  fclose(fp);
+
+  return 0;
+}
@@ -0,0 +1,258 @@
+/*
+ * Running median of an odd window of W samples, for despiking sensor
+ * streams ahead of mips_fir16.
+ *
+ * Windows of up to 9 samples are copied out of the ring and reduced by
+ * a median selection network, branch-free min/max pairs: 3, 7, 13 and
+ * 19 of them for W = 3, 5, 7 and 9, where a full sort per sample would
+ * need up to W (W - 1) / 2 compares.
+ *
+ * Larger windows keep the samples in two heaps that share the median
+ * as their root, a max-heap of the smaller half at negative positions
+ * and a min-heap of the larger half at positive ones. Children of
+ * position i are 2i and 2i + 1 (2i - 1 below the root), so the parent
+ * is i / 2 for either sign. The new sample replaces the oldest in its
+ * heap position and is sifted up or down, O(log W) compares.
+ *
+ * The window starts out filled with the init value, so the first W / 2
+ * outputs lean towards it.
+ *
+ * mem: mips_median_mem(W) int32 entries, the ring and for W > 9 the
+ *      heap positions and indices as int16
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+#define MEDIAN_NET_MAX		9
+
+#define median_min(a, b)	(((a) < (b)) ? (a) : (b))
+#define median_max(a, b)	(((a) > (b)) ? (a) : (b))
+#define median_sort(a, b)	{ int32 t_ = median_min(a, b); b = median_max(a, b); a = t_; }
+
+
+static int32 median_net(const int32 *data, int W)
+{
+	int32 p[MEDIAN_NET_MAX];
+	int i;
+
+	for (i = 0; i < W; i++)
+		p[i] = data[i];
+
+	switch (W)
+	{
+	case 3:
+		median_sort(p[0], p[1]); median_sort(p[1], p[2]); median_sort(p[0], p[1]);
+		return p[1];
+
+	case 5:
+		median_sort(p[0], p[1]); median_sort(p[3], p[4]); median_sort(p[0], p[3]);
+		median_sort(p[1], p[4]); median_sort(p[1], p[2]); median_sort(p[2], p[3]);
+		median_sort(p[1], p[2]);
+		return p[2];
+
+	case 7:
+		median_sort(p[0], p[5]); median_sort(p[0], p[3]); median_sort(p[1], p[6]);
+		median_sort(p[2], p[4]); median_sort(p[0], p[1]); median_sort(p[3], p[5]);
+		median_sort(p[2], p[6]); median_sort(p[2], p[3]); median_sort(p[3], p[6]);
+		median_sort(p[4], p[5]); median_sort(p[1], p[4]); median_sort(p[1], p[3]);
+		median_sort(p[3], p[4]);
+		return p[3];
+
+	case 9:
+		median_sort(p[1], p[2]); median_sort(p[4], p[5]); median_sort(p[7], p[8]);
+		median_sort(p[0], p[1]); median_sort(p[3], p[4]); median_sort(p[6], p[7]);
+		median_sort(p[1], p[2]); median_sort(p[4], p[5]); median_sort(p[7], p[8]);
+		median_sort(p[0], p[3]); median_sort(p[5], p[8]); median_sort(p[4], p[7]);
+		median_sort(p[3], p[6]); median_sort(p[1], p[4]); median_sort(p[2], p[5]);
+		median_sort(p[4], p[7]); median_sort(p[4], p[2]); median_sort(p[6], p[4]);
+		median_sort(p[4], p[2]);
+		return p[4];
+	}
+
+	return p[0];
+}
+
+
+/* heap[i] and heap[j] swapped if the value at i is less than at j */
+
+static inline int median_swap(median_filter *st, int i, int j)
+{
+	int16 *heap = st->heap;
+	int a = heap[i], b = heap[j];
+
+	if (st->data[a] >= st->data[b])
+		return 0;
+
+	heap[i] = (int16) b;
+	heap[j] = (int16) a;
+	st->pos[b] = (int16) i;
+	st->pos[a] = (int16) j;
+	return 1;
+}
+
+
+static void median_min_down(median_filter *st, int i)
+{
+	int n = st->W >> 1;
+
+	for (i *= 2; i <= n; i *= 2)
+	{
+		if (i < n && st->data[st->heap[i + 1]] < st->data[st->heap[i]])
+			i++;
+		if (!median_swap(st, i, i / 2))
+			break;
+	}
+}
+
+
+static void median_max_down(median_filter *st, int i)
+{
+	int n = st->W >> 1;
+
+	for (i *= 2; i >= -n; i *= 2)
+	{
+		if (i > -n && st->data[st->heap[i]] < st->data[st->heap[i - 1]])
+			i--;
+		if (!median_swap(st, i / 2, i))
+			break;
+	}
+}
+
+
+/* sift up towards the root, nonzero if the new value reached it */
+
+static int median_min_up(median_filter *st, int i)
+{
+	while (i > 0 && median_swap(st, i, i / 2))
+		i /= 2;
+
+	return i == 0;
+}
+
+
+static int median_max_up(median_filter *st, int i)
+{
+	while (i < 0 && median_swap(st, i / 2, i))
+		i /= 2;
+
+	return i == 0;
+}
+
+
+static int32 median_heap(median_filter *st, int32 v)
+{
+	int k = st->idx;
+	int p = st->pos[k];
+	int32 old = st->data[k];
+
+	st->data[k] = v;
+	if (++k == st->W)
+		k = 0;
+	st->idx = k;
+
+	/* a value that reaches the root may then belong to the other heap */
+
+	if (p > 0)
+	{
+		if (old < v)
+		{
+			median_min_down(st, p);
+			return st->data[st->heap[0]];
+		}
+		if (!median_min_up(st, p))
+			return st->data[st->heap[0]];
+	}
+	else if (p < 0)
+	{
+		if (v < old)
+		{
+			median_max_down(st, p);
+			return st->data[st->heap[0]];
+		}
+		if (!median_max_up(st, p))
+			return st->data[st->heap[0]];
+	}
+
+	if (median_max_up(st, -1))
+		median_max_down(st, -1);
+	else if (median_min_up(st, 1))
+		median_min_down(st, 1);
+
+	return st->data[st->heap[0]];
+}
+
+
+static inline int32 median_next(median_filter *st, int32 v)
+{
+	int k;
+
+	if (st->W > MEDIAN_NET_MAX)
+		return median_heap(st, v);
+
+	k = st->idx;
+	st->data[k] = v;
+	if (++k == st->W)
+		k = 0;
+	st->idx = k;
+
+	return median_net(st->data, st->W);
+}
+
+
+int mips_median_mem(int W)
+{
+	if (W < 1 || !(W & 1) || W > MAX16)
+		return 0;
+
+	return (W > MEDIAN_NET_MAX) ? 2 * W : W;
+}
+
+
+int mips_median_init(median_filter *st, int32 *mem, int W, int32 init)
+{
+	int i;
+
+	if (mips_median_mem(W) == 0)
+		return -1;
+
+	st->W = W;
+	st->idx = 0;
+	st->data = mem;
+	st->pos = (int16 *) (mem + W);
+	st->heap = st->pos + W + (W >> 1);
+
+	for (i = 0; i < W; i++)
+		mem[i] = init;
+
+	/* all values equal, so any placement is a valid pair of heaps */
+
+	if (W > MEDIAN_NET_MAX)
+	{
+		for (i = 0; i < W; i++)
+		{
+			st->pos[i] = (int16) (i - (W >> 1));
+			st->heap[i - (W >> 1)] = (int16) i;
+		}
+	}
+
+	return 0;
+}
+
+
+void mips_median16(int16 *outdata, int16 *indata, median_filter *st, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = (int16) median_next(st, indata[i]);
+}
+
+
+void mips_median32(int32 *outdata, int32 *indata, median_filter *st, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = median_next(st, indata[i]);
+}
@@ -0,0 +1,109 @@
+/*
+ * Moving minimum and maximum over the last W samples (min/max hold,
+ * envelopes, spike detection), by monotonic deques.
+ *
+ * Each deque keeps the samples that can still become the extreme of a
+ * later window, in time order with decreasing values, so its front is
+ * the maximum. A new sample first retires the front if it has left the
+ * window, then drops every smaller sample from the back and is appended.
+ * That is at most three compares per sample on average, whatever W is.
+ * The minimum is the maximum of ~x, which reverses the order of int32
+ * without overflow, so both use the same deque code.
+ *
+ * Until W samples have been seen the window is the samples so far.
+ *
+ * mem: mips_minmax_mem(W) int32 entries
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static inline int32 minmax_push(int32 *v, uint32 *t, int *head, int *n, int W,
+								int32 x, uint32 now)
+{
+	int h = *head, k = *n, b;
+
+	if (k && now - t[h] >= (uint32) W)
+	{
+		if (++h == W)
+			h = 0;
+		k--;
+	}
+
+	b = h + k - 1;
+	if (b >= W)
+		b -= W;
+
+	while (k && v[b] <= x)
+	{
+		if (--b < 0)
+			b = W - 1;
+		k--;
+	}
+
+	if (++b == W)
+		b = 0;
+	v[b] = x;
+	t[b] = now;
+
+	*head = h;
+	*n = k + 1;
+	return v[h];
+}
+
+
+int mips_minmax_mem(int W)
+{
+	return (W < 1) ? 0 : 4 * W;
+}
+
+
+int mips_minmax_init(minmax_filter *st, int32 *mem, int W)
+{
+	if (W < 1)
+		return -1;
+
+	st->W = W;
+	st->t = 0;
+	st->maxv = mem;
+	st->maxt = (uint32 *) (mem + W);
+	st->minv = mem + 2 * W;
+	st->mint = (uint32 *) (mem + 3 * W);
+	st->maxh = st->maxn = 0;
+	st->minh = st->minn = 0;
+	return 0;
+}
+
+
+void mips_minmax16(int16 *minout, int16 *maxout, int16 *indata, minmax_filter *st, int N)
+{
+	uint32 now = st->t;
+	int i;
+
+	for (i = 0; i < N; i++, now++)
+	{
+		maxout[i] = (int16) minmax_push(st->maxv, st->maxt, &st->maxh, &st->maxn,
+										st->W, indata[i], now);
+		minout[i] = (int16) ~minmax_push(st->minv, st->mint, &st->minh, &st->minn,
+										 st->W, ~(int32) indata[i], now);
+	}
+
+	st->t = now;
+}
+
+
+void mips_minmax32(int32 *minout, int32 *maxout, int32 *indata, minmax_filter *st, int N)
+{
+	uint32 now = st->t;
+	int i;
+
+	for (i = 0; i < N; i++, now++)
+	{
+		maxout[i] = minmax_push(st->maxv, st->maxt, &st->maxh, &st->maxn,
+								st->W, indata[i], now);
+		minout[i] = ~minmax_push(st->minv, st->mint, &st->minh, &st->minn,
+								 st->W, ~indata[i], now);
+	}
+
+	st->t = now;
+}
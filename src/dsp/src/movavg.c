@@ -0,0 +1,112 @@
+/*
+ * Recursive moving average of the last L samples,
+ *
+ *	sum += x[n] - x[n-L],	y[n] = sum / L
+ *
+ * one add, one subtract and a multiply per sample whatever L is. The
+ * division is a multiply by recip = 2^(31+k) / L, k = ceil(log2 L), so
+ * powers of two are exact and other lengths are within 1 LSB.
+ *
+ * The 16-bit sum wraps in 32 bits, which the subtraction of the oldest
+ * sample undoes exactly for L <= 65536. The 32-bit sum is 64 bits and
+ * is multiplied in two halves.
+ *
+ * The window starts out as L zeros.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static int movavg_setup(movavg_filter *st, void *delayline, int L)
+{
+	if (L < 1 || L > 65536)
+		return -1;
+
+	st->L = L;
+	st->idx = 0;
+	st->sum = 0;
+	st->delayline = delayline;
+
+	for (st->k = 0; (1 << st->k) < L; st->k++)
+		;
+
+	st->recip = (uint32) ((((uint64) 1 << (32 + st->k)) / L + 1) >> 1);
+	return 0;
+}
+
+
+int mips_movavg16_init(movavg_filter *st, int16 *delayline, int L)
+{
+	int i;
+
+	if (movavg_setup(st, delayline, L))
+		return -1;
+
+	for (i = 0; i < L; i++)
+		delayline[i] = 0;
+
+	return 0;
+}
+
+
+int mips_movavg32_init(movavg_filter *st, int32 *delayline, int L)
+{
+	int i;
+
+	if (movavg_setup(st, delayline, L))
+		return -1;
+
+	for (i = 0; i < L; i++)
+		delayline[i] = 0;
+
+	return 0;
+}
+
+
+void mips_movavg16(int16 *outdata, int16 *indata, movavg_filter *st, int N)
+{
+	int16 *d = (int16 *) st->delayline;
+	int64 rnd = (int64) 1 << (30 + st->k);
+	uint32 sum = (uint32) st->sum;
+	int i, idx = st->idx, sh = 31 + st->k;
+	int32 y;
+
+	for (i = 0; i < N; i++)
+	{
+		sum += (uint32) (indata[i] - d[idx]);
+		d[idx] = indata[i];
+		if (++idx == st->L)
+			idx = 0;
+
+		y = (int32) (((int64) (int32) sum * st->recip + rnd) >> sh);
+		outdata[i] = (int16) SAT16(y);
+	}
+
+	st->idx = idx;
+	st->sum = (int32) sum;
+}
+
+
+void mips_movavg32(int32 *outdata, int32 *indata, movavg_filter *st, int N)
+{
+	int32 *d = (int32 *) st->delayline;
+	int64 sum = st->sum, y;
+	int i, idx = st->idx;
+
+	for (i = 0; i < N; i++)
+	{
+		sum += (int64) indata[i] - d[idx];
+		d[idx] = indata[i];
+		if (++idx == st->L)
+			idx = 0;
+
+		/* sum * recip / 2^31 from the two halves of sum, then / 2^k */
+
+		y = 2 * (sum >> 32) * st->recip + (((uint64) (uint32) sum * st->recip) >> 31);
+		y = (st->k) ? (y + ((int64) 1 << (st->k - 1))) >> st->k : y;
+		outdata[i] = (y > MAX32) ? MAX32 : (y < MIN32) ? MIN32 : (int32) y;
+	}
+
+	st->idx = idx;
+	st->sum = sum;
+}
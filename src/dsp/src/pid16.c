@@ -0,0 +1,49 @@
+/*
+ * Bank of N PID controllers updated in one call, state and gains held
+ * as struct-of-arrays so each term is one pass of identical operations
+ * with no per-controller calls. For controller i with error e = e[i]:
+ *
+ *	integ = clamp(integ + sat(ki e 2^(1+shift)), umin 2^16, umax 2^16)
+ *	u     = clamp(round(sat(sat(kp e + kd (e - eprev)) 2^(1+shift)) + integ), umin, umax)
+ *
+ * e, u and the gains are Q15, the gains scaled by 2^shift; the integrator
+ * is Q31. Clamping the integrator to the output limits is the anti-windup.
+ * The sample time is folded into ki and kd. Every step saturates as the
+ * DSP ASE saturating MAC and shift do, so this and the DSPr2 version give
+ * the same results.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static inline int32 pid16_sat(int64 v)
+{
+	return (v > MAX32) ? MAX32 : (v < MIN32) ? MIN32 : (int32) v;
+}
+
+
+void mips_pid16(int16 *outdata, int16 *e, pid16_bank *pb, int N)
+{
+	int i, sh = 1 + pb->shift;
+	int32 ei, pd, ii, lo, hi, v;
+
+	for (i = 0; i < N; i++)
+	{
+		ei = e[i];
+		lo = (int32) pb->umin[i] * 65536;
+		hi = (int32) pb->umax[i] * 65536;
+
+		pd = pid16_sat((int64) pb->kp[i] * ei + (int64) pb->kd[i] * (ei - pb->eprev[i]));
+		pd = pid16_sat((int64) pd * ((int64) 1 << sh));
+		pb->eprev[i] = (int16) ei;
+
+		ii = pid16_sat((int64) (pb->ki[i] * ei) * ((int64) 1 << sh));
+		ii = pid16_sat((int64) pb->integ[i] + ii);
+		ii = (ii < lo) ? lo : (ii > hi) ? hi : ii;
+		pb->integ[i] = ii;
+
+		v = (int32) (((int64) pid16_sat((int64) pd + ii) + 0x8000) >> 16);
+		v = (v < pb->umin[i]) ? pb->umin[i] : (v > pb->umax[i]) ? pb->umax[i] : v;
+		outdata[i] = (int16) v;
+	}
+}
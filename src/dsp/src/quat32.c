@@ -0,0 +1,174 @@
+/*
+ * Q30 quaternion kernels for AHRS integration on cores without an FPU
+ * (PIC32MZ-DA). Q30 keeps 1.0 exact, so unit quaternions, rotated unit
+ * vectors and DCM entries all fit. Each function works on N quaternions
+ * with no data dependent branches; outdata may be the input.
+ *
+ *	mips_quat_mul32:        outdata[i] = a[i] * b[i] (Hamilton product)
+ *	mips_quat_normalize32:  outdata[i] = q[i] / |q[i]|, any q[i]; a zero
+ *	                        quaternion gives zero
+ *	mips_quat_rotate32:     outdata[i] = q[i] v[i] q[i]^-1 for unit q[i]
+ *	                        and |v[i]| < 2, v and outdata hold 3N values
+ *	mips_quat_to_dcm32:     outdata[9i .. 9i+8] = row-major rotation
+ *	                        matrix of unit q[i], the same rotation
+ *
+ * Results are rounded and saturated to Q30 range [-2, 2).
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static inline int32 quat32_round(int64 v, int s)
+{
+	v = (v + ((int64) 1 << (s - 1))) >> s;
+	return (v > MAX32) ? MAX32 : (v < MIN32) ? MIN32 : (int32) v;
+}
+
+
+/* 1/sqrt(X) at the middle of [1 + i/8, 1 + (i+1)/8), Q30 */
+
+static const uint32 quat32_rsqrt_tab[24] =
+{
+	0x3e16d092, 0x3abafd52, 0x37dd20ae, 0x3561335d,
+	0x33333333, 0x314468ba, 0x2f89bacc, 0x2dfa9cf2,
+	0x2c905a6f, 0x2b459b19, 0x2a160d52, 0x28fe28a0,
+	0x27fb00f0, 0x270a2574, 0x262987b2, 0x25576878,
+	0x24924925, 0x23d8e025, 0x232a0fda, 0x2284df58,
+	0x21e8748c, 0x21540f7b, 0x20c70664, 0x2040c289,
+};
+
+
+/*
+ * 1/sqrt(n2) for n2 > 0 in Q60, as a Q31 value shifted left by the
+ * returned exponent. n2 is shifted by an even amount so that its top
+ * word X is in [1, 4) in Q30, looked up in the table and refined by
+ * three Newton steps, y = y (3 - X y^2) / 2, each of which roughly
+ * squares the error.
+ */
+
+static inline uint32 quat32_rsqrt(uint64 n2, int *e)
+{
+	int s = __builtin_clzll(n2) & ~1;
+	uint32 x = (uint32) ((n2 << s) >> 32);
+	uint32 y = quat32_rsqrt_tab[(x >> 27) - 8];
+	uint32 t;
+	int i;
+
+	for (i = 0; i < 3; i++)
+	{
+		t = (uint32) (((uint64) y * y) >> 30);
+		t = (uint32) (((uint64) x * t) >> 30);
+		y = (uint32) (((uint64) y * (0xC0000000u - t)) >> 31);
+	}
+
+	/* n2 / 2^60 = X 2^(2 - s), so 1/sqrt(n2) = y / 2^30 2^(s/2 - 1) */
+
+	*e = s >> 1;
+	return y;
+}
+
+
+void mips_quat_mul32(quat32 *outdata, quat32 *a, quat32 *b, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+	{
+		int32 aw = a[i].w, ax = a[i].x, ay = a[i].y, az = a[i].z;
+		int32 bw = b[i].w, bx = b[i].x, by = b[i].y, bz = b[i].z;
+
+		outdata[i].w = quat32_round((int64) aw * bw - (int64) ax * bx
+									- (int64) ay * by - (int64) az * bz, 30);
+		outdata[i].x = quat32_round((int64) aw * bx + (int64) ax * bw
+									+ (int64) ay * bz - (int64) az * by, 30);
+		outdata[i].y = quat32_round((int64) aw * by - (int64) ax * bz
+									+ (int64) ay * bw + (int64) az * bx, 30);
+		outdata[i].z = quat32_round((int64) aw * bz + (int64) ax * by
+									- (int64) ay * bx + (int64) az * bw, 30);
+	}
+}
+
+
+void mips_quat_normalize32(quat32 *outdata, quat32 *q, int N)
+{
+	int i, e;
+
+	for (i = 0; i < N; i++)
+	{
+		int32 w = q[i].w, x = q[i].x, y = q[i].y, z = q[i].z;
+
+		/*
+		 * |q|^2 in Q60. Each square is at most 2^62, so only four
+		 * MIN32 components carry out of 64 bits; then n2 is taken in
+		 * Q58 and the scale halved. A zero quaternion looks up
+		 * 1/sqrt(1) and stays zero.
+		 */
+
+		uint64 n2 = (uint64) ((int64) w * w) + (uint64) ((int64) x * x)
+				  + (uint64) ((int64) y * y);
+		uint64 z2 = (uint64) ((int64) z * z);
+		int c = (n2 + z2) < z2;
+		uint32 r;
+		int64 s;
+
+		n2 = ((n2 + z2) >> (2 * c)) | ((uint64) c << 62);
+		r = quat32_rsqrt(n2 + (n2 == 0), &e);
+		s = (int64) r * ((int64) 1 << e);
+
+		outdata[i].w = quat32_round(w * s, 31 + c);
+		outdata[i].x = quat32_round(x * s, 31 + c);
+		outdata[i].y = quat32_round(y * s, 31 + c);
+		outdata[i].z = quat32_round(z * s, 31 + c);
+	}
+}
+
+
+void mips_quat_rotate32(int32 *outdata, quat32 *q, int32 *v, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+	{
+		int32 w = q[i].w, x = q[i].x, y = q[i].y, z = q[i].z;
+		int32 vx = v[3 * i], vy = v[3 * i + 1], vz = v[3 * i + 2];
+
+		/*
+		 * t = 2 u x v, v' = v + w t + u x t. t is kept in Q29: for
+		 * |v| < 2 it is below 4 and never saturates.
+		 */
+
+		int32 tx = quat32_round((int64) y * vz - (int64) z * vy, 30);
+		int32 ty = quat32_round((int64) z * vx - (int64) x * vz, 30);
+		int32 tz = quat32_round((int64) x * vy - (int64) y * vx, 30);
+
+		outdata[3 * i] = quat32_round((int64) vx * ((int64) 1 << 29) + (int64) w * tx
+									  + (int64) y * tz - (int64) z * ty, 29);
+		outdata[3 * i + 1] = quat32_round((int64) vy * ((int64) 1 << 29) + (int64) w * ty
+										  + (int64) z * tx - (int64) x * tz, 29);
+		outdata[3 * i + 2] = quat32_round((int64) vz * ((int64) 1 << 29) + (int64) w * tz
+										  + (int64) x * ty - (int64) y * tx, 29);
+	}
+}
+
+
+void mips_quat_to_dcm32(int32 *outdata, quat32 *q, int N)
+{
+	const int64 one = (int64) 1 << 59;
+	int i;
+
+	for (i = 0; i < N; i++)
+	{
+		int64 w = q[i].w, x = q[i].x, y = q[i].y, z = q[i].z;
+		int32 *R = outdata + 9 * i;
+
+		R[0] = quat32_round(one - y * y - z * z, 29);
+		R[1] = quat32_round(x * y - w * z, 29);
+		R[2] = quat32_round(x * z + w * y, 29);
+		R[3] = quat32_round(x * y + w * z, 29);
+		R[4] = quat32_round(one - x * x - z * z, 29);
+		R[5] = quat32_round(y * z - w * x, 29);
+		R[6] = quat32_round(x * z - w * y, 29);
+		R[7] = quat32_round(y * z + w * x, 29);
+		R[8] = quat32_round(one - x * x - y * y, 29);
+	}
+}
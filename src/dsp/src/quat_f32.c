@@ -0,0 +1,115 @@
+/*
+ * Single precision quaternion kernels for AHRS integration on cores
+ * with an FPU (PIC32MZ-EF), the float counterparts of quat32.c. Each
+ * function works on N quaternions with no data dependent branches;
+ * outdata may be the input.
+ *
+ * mips_quat_normalize_f32 needs no sqrt.s or divide: the inverse square
+ * root starts from the exponent halving bit trick and takes three Newton
+ * steps, y = y (3 - n2 y^2) / 2, to full single precision.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+#ifdef __mips_hard_float
+
+
+static inline float quatf_rsqrt(float n2)
+{
+	union
+	{
+		float f;
+		uint32 i;
+	} u;
+	float y;
+
+	u.f = n2;
+	u.i = 0x5F375A86 - (u.i >> 1);
+	y = u.f;
+
+	y = y * (1.5f - 0.5f * n2 * y * y);
+	y = y * (1.5f - 0.5f * n2 * y * y);
+	y = y * (1.5f - 0.5f * n2 * y * y);
+
+	return y;
+}
+
+
+void mips_quat_mul_f32(quatf *outdata, quatf *a, quatf *b, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+	{
+		float aw = a[i].w, ax = a[i].x, ay = a[i].y, az = a[i].z;
+		float bw = b[i].w, bx = b[i].x, by = b[i].y, bz = b[i].z;
+
+		outdata[i].w = aw * bw - ax * bx - ay * by - az * bz;
+		outdata[i].x = aw * bx + ax * bw + ay * bz - az * by;
+		outdata[i].y = aw * by - ax * bz + ay * bw + az * bx;
+		outdata[i].z = aw * bz + ax * by - ay * bx + az * bw;
+	}
+}
+
+
+void mips_quat_normalize_f32(quatf *outdata, quatf *q, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+	{
+		float w = q[i].w, x = q[i].x, y = q[i].y, z = q[i].z;
+		float r = quatf_rsqrt(w * w + x * x + y * y + z * z);
+
+		outdata[i].w = w * r;
+		outdata[i].x = x * r;
+		outdata[i].y = y * r;
+		outdata[i].z = z * r;
+	}
+}
+
+
+void mips_quat_rotate_f32(float *outdata, quatf *q, float *v, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+	{
+		float w = q[i].w, x = q[i].x, y = q[i].y, z = q[i].z;
+		float vx = v[3 * i], vy = v[3 * i + 1], vz = v[3 * i + 2];
+
+		/* t = 2 u x v, v' = v + w t + u x t */
+
+		float tx = 2.0f * (y * vz - z * vy);
+		float ty = 2.0f * (z * vx - x * vz);
+		float tz = 2.0f * (x * vy - y * vx);
+
+		outdata[3 * i] = vx + w * tx + y * tz - z * ty;
+		outdata[3 * i + 1] = vy + w * ty + z * tx - x * tz;
+		outdata[3 * i + 2] = vz + w * tz + x * ty - y * tx;
+	}
+}
+
+
+void mips_quat_to_dcm_f32(float *outdata, quatf *q, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+	{
+		float w = q[i].w, x = q[i].x, y = q[i].y, z = q[i].z;
+		float *R = outdata + 9 * i;
+
+		R[0] = 1.0f - 2.0f * (y * y + z * z);
+		R[1] = 2.0f * (x * y - w * z);
+		R[2] = 2.0f * (x * z + w * y);
+		R[3] = 2.0f * (x * y + w * z);
+		R[4] = 1.0f - 2.0f * (x * x + z * z);
+		R[5] = 2.0f * (y * z - w * x);
+		R[6] = 2.0f * (x * z - w * y);
+		R[7] = 2.0f * (y * z + w * x);
+		R[8] = 1.0f - 2.0f * (x * x + y * y);
+	}
+}
+
+#endif
@@ -0,0 +1,142 @@
+/*
+ * Arbitrary-ratio resampling, polyphase with a cubic Farrow stage, for
+ * aligning streams from different clocks.
+ *
+ * Output times advance by step = fs_in / fs_out input samples, Q32.32,
+ * which may be nudged between calls to track clock drift. An output
+ * that falls a fraction f past a sample takes phase q = f P of the bank
+ * from mips_resample16/32_init(), and the three phases around it: each
+ * is a mips_vec_dotp16/32 call over the last K samples, the same MACs
+ * as mips_fir16. A Catmull-Rom cubic through the four phase outputs
+ * then places the output at the remaining fraction mu = f P - q, so a
+ * small bank (P = 32) gives a continuously variable delay.
+ *
+ * The delay line is kept twice, as the coefficients of mips_fir16, so
+ * the last K samples are always contiguous. The output lags the input
+ * by K/2 samples.
+ *
+ * mips_vec_dotp16 saturates its result, but mips_vec_dotp32 wraps (its
+ * scale only applies after the 32-bit result is taken) and a full-scale
+ * DC input already reaches MAX32. The 32-bit bank is therefore stored
+ * in Q30, so the phase outputs are at half scale, and the cubic doubles
+ * them back.
+ *
+ * mips_resample16/32 take any N and return the number of outputs
+ * written, at most N fs_out / fs_in + 1.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+/*
+ * Catmull-Rom through y[-1] .. y[2] at mu in [0, 1), Q16 for 16-bit and
+ * Q24 for 32-bit data, in terms of twice its polynomial coefficients so
+ * that no division is needed.
+ */
+
+static inline int16 resample16_cubic(int32 ym, int32 y0, int32 y1, int32 y2, int32 mu)
+{
+	int32 c1 = y1 - ym;
+	int32 c2 = 2 * ym - 5 * y0 + 4 * y1 - y2;
+	int32 c3 = y2 - ym + 3 * (y0 - y1);
+	int32 t;
+
+	t = (int32) (((int64) c3 * mu) >> 16);
+	t = (int32) (((int64) (t + c2) * mu) >> 16);
+	t = (int32) (((int64) (t + c1) * mu + 0x10000) >> 17);
+
+	return (int16) SAT16(y0 + t);
+}
+
+
+/* as resample16_cubic, for phase outputs at half scale */
+
+static inline int32 resample32_cubic(int64 ym, int64 y0, int64 y1, int64 y2, int32 mu)
+{
+	int64 c1 = y1 - ym;
+	int64 c2 = 2 * ym - 5 * y0 + 4 * y1 - y2;
+	int64 c3 = y2 - ym + 3 * (y0 - y1);
+	int64 t;
+
+	t = (c3 * mu) >> 24;
+	t = ((t + c2) * mu) >> 24;
+	t = 2 * y0 + (((t + c1) * mu + 0x800000) >> 24);
+
+	return (t > MAX32) ? MAX32 : (t < MIN32) ? MIN32 : (int32) t;
+}
+
+
+int mips_resample16(int16 *outdata, int16 *indata, resample16 *st, int N)
+{
+	int16 *d = st->delayline, *w, *c;
+	uint64 pos = st->pos;
+	uint32 f;
+	int i, n = 0, idx = st->idx, K = st->K, sh = 32 - st->log2P;
+	int32 ym, y0, y1, y2;
+
+	for (i = 0; i < N; i++)
+	{
+		d[idx] = d[idx + K] = indata[i];
+		if (++idx == K)
+			idx = 0;
+		w = d + idx;
+
+		while (pos < ((uint64) 1 << 32))
+		{
+			f = (uint32) pos;
+			c = st->coeffs + (sh < 32 ? f >> sh : 0) * K;
+
+			ym = mips_vec_dotp16(w, c, K, 0);
+			y0 = mips_vec_dotp16(w, c + K, K, 0);
+			y1 = mips_vec_dotp16(w, c + 2 * K, K, 0);
+			y2 = mips_vec_dotp16(w, c + 3 * K, K, 0);
+
+			outdata[n++] = resample16_cubic(ym, y0, y1, y2, (f << st->log2P) >> 16);
+			pos += st->step;
+		}
+
+		pos -= (uint64) 1 << 32;
+	}
+
+	st->pos = pos;
+	st->idx = idx;
+	return n;
+}
+
+
+int mips_resample32(int32 *outdata, int32 *indata, resample32 *st, int N)
+{
+	int32 *d = st->delayline, *w, *c;
+	uint64 pos = st->pos;
+	uint32 f;
+	int i, n = 0, idx = st->idx, K = st->K, sh = 32 - st->log2P;
+	int32 ym, y0, y1, y2;
+
+	for (i = 0; i < N; i++)
+	{
+		d[idx] = d[idx + K] = indata[i];
+		if (++idx == K)
+			idx = 0;
+		w = d + idx;
+
+		while (pos < ((uint64) 1 << 32))
+		{
+			f = (uint32) pos;
+			c = st->coeffs + (sh < 32 ? f >> sh : 0) * K;
+
+			ym = mips_vec_dotp32(w, c, K, 0);
+			y0 = mips_vec_dotp32(w, c + K, K, 0);
+			y1 = mips_vec_dotp32(w, c + 2 * K, K, 0);
+			y2 = mips_vec_dotp32(w, c + 3 * K, K, 0);
+
+			outdata[n++] = resample32_cubic(ym, y0, y1, y2, (f << st->log2P) >> 8);
+			pos += st->step;
+		}
+
+		pos -= (uint64) 1 << 32;
+	}
+
+	st->pos = pos;
+	st->idx = idx;
+	return n;
+}
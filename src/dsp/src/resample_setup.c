@@ -0,0 +1,154 @@
+/*
+ * Setup for the arbitrary-ratio resamplers mips_resample16/32.
+ *
+ * The prototype lowpass is a Kaiser-windowed sinc over K samples,
+ *
+ *	s(t) = fc sinc(fc t) w(2t / K),	|t| < K/2
+ *
+ * with fc = min(1, fs_out / fs_in) so that decimation also filters out
+ * what would alias. Phase q of the bank, q = -1 .. P + 1, holds
+ *
+ *	coeffs[(q + 1) K + j] = s(K/2 - 1 - j + q/P),	j = 0 .. K-1
+ *
+ * so its dot product with the last K samples, oldest first, is the
+ * signal q/P of a sample after the (K/2)th newest sample. The extra
+ * phases either side let the cubic between phases use four neighbours
+ * for every q in 0 .. P-1. Each phase is scaled to a DC gain of 1, in
+ * Q15 for 16-bit data and Q30 for 32-bit data, which leaves the headroom
+ * mips_resample32 needs.
+ *
+ * coeffs:    (P + 3) K
+ * delayline: 2K
+ */
+
+#include <math.h>
+#include "../../../include/dsplib_dsp.h"
+
+
+#define RESAMPLE_BETA		8.0		/* Kaiser window, about 80 dB */
+
+
+static double resample_i0(double x)
+{
+	double s = 1.0, t = 1.0;
+	int k;
+
+	for (k = 1; k < 50; k++)
+	{
+		t *= (x / (2 * k)) * (x / (2 * k));
+		s += t;
+	}
+
+	return s;
+}
+
+
+static double resample_proto(double t, double fc, int K)
+{
+	double u = 2 * t / K, v;
+
+	if (u <= -1.0 || u >= 1.0)
+		return 0.0;
+
+	v = (t == 0.0) ? fc : sin(M_PI * fc * t) / (M_PI * t);
+
+	return v * resample_i0(RESAMPLE_BETA * sqrt(1.0 - u * u)) / resample_i0(RESAMPLE_BETA);
+}
+
+
+/* tap j of phase q */
+
+static double resample_tap(int j, int q, int P, int K, double fc)
+{
+	return resample_proto(K / 2 - 1 - j + (double) q / P, fc, K);
+}
+
+
+static double resample_gain(int q, int P, int K, double fc)
+{
+	double sum = 0.0;
+	int j;
+
+	for (j = 0; j < K; j++)
+		sum += resample_tap(j, q, P, K, fc);
+
+	return sum;
+}
+
+
+static int32 resample_q(double v, int bits, int32 max)
+{
+	v = floor(ldexp(v, bits) + 0.5);
+
+	return (v > max) ? max : (v < -max - 1.0) ? -max - 1 : (int32) v;
+}
+
+
+static int resample_setup(int K, int log2P, uint32 fs_in, uint32 fs_out,
+						  uint64 *step, double *fc)
+{
+	if (K < 4 || (K & 3) || log2P < 0 || log2P > 10 || fs_in == 0 || fs_out == 0)
+		return -1;
+
+	*step = ((uint64) fs_in << 32) / fs_out;
+	*fc = (fs_out < fs_in) ? (double) fs_out / fs_in : 1.0;
+	return 0;
+}
+
+
+int mips_resample16_init(resample16 *st, int16 *coeffs, int16 *delayline, int K,
+						 int log2P, uint32 fs_in, uint32 fs_out)
+{
+	double fc, g;
+	int P = 1 << log2P, q, j;
+
+	if (resample_setup(K, log2P, fs_in, fs_out, &st->step, &fc))
+		return -1;
+
+	for (q = -1; q <= P + 1; q++)
+	{
+		g = resample_gain(q, P, K, fc);
+		for (j = 0; j < K; j++)
+			coeffs[(q + 1) * K + j] = (int16) resample_q(resample_tap(j, q, P, K, fc) / g, 15, MAX16);
+	}
+
+	for (j = 0; j < 2 * K; j++)
+		delayline[j] = 0;
+
+	st->K = K;
+	st->log2P = log2P;
+	st->pos = 0;
+	st->idx = 0;
+	st->coeffs = coeffs;
+	st->delayline = delayline;
+	return 0;
+}
+
+
+int mips_resample32_init(resample32 *st, int32 *coeffs, int32 *delayline, int K,
+						 int log2P, uint32 fs_in, uint32 fs_out)
+{
+	double fc, g;
+	int P = 1 << log2P, q, j;
+
+	if (resample_setup(K, log2P, fs_in, fs_out, &st->step, &fc))
+		return -1;
+
+	for (q = -1; q <= P + 1; q++)
+	{
+		g = resample_gain(q, P, K, fc);
+		for (j = 0; j < K; j++)
+			coeffs[(q + 1) * K + j] = resample_q(resample_tap(j, q, P, K, fc) / g, 30, MAX32);
+	}
+
+	for (j = 0; j < 2 * K; j++)
+		delayline[j] = 0;
+
+	st->K = K;
+	st->log2P = log2P;
+	st->pos = 0;
+	st->idx = 0;
+	st->coeffs = coeffs;
+	st->delayline = delayline;
+	return 0;
+}
@@ -0,0 +1,56 @@
+/*
+ * Sliding DFT, Q31. See sdft_setup.c for the recursion and coefficients.
+ *
+ * X:         B bins, updated in place
+ * delayline: N+1 entries, zero initialised; delayline[0] holds the
+ *            position of the oldest sample
+ * M:         number of new samples in indata
+ *
+ * Each new sample enters as (x[n] - r^N * x[n-N]) / 2^scale; scale = log2N
+ * gives the same DFT/N scaling as mips_fft32.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static inline int32 sat32(int64 x)
+{
+	return (x > MAX32) ? MAX32 : ((x < MIN32) ? MIN32 : (int32) x);
+}
+
+
+void mips_sdft32(int32c *X, int32 *indata, int32c *coeffs, int32 *delayline,
+				 int B, int N, int M, int scale)
+{
+	int b, n, p;
+	int32 x, d, rN;
+	int64 re, im, rnd;
+	int32c rw, w;
+
+	rN = coeffs[2*B].re;
+	rnd = ((int64)1 << scale) >> 1;
+	p = delayline[0];
+
+	for (n = 0; n < M; n++)
+	{
+		x = indata[n];
+		d = sat32((x - (int64)mul32r(rN, delayline[1+p]) + rnd) >> scale);
+		delayline[1+p] = x;
+		if (++p == N)
+			p = 0;
+
+		for (b = 0; b < B; b++)
+		{
+			rw = coeffs[2*b];
+			w = coeffs[2*b+1];
+
+			re = (int64)rw.re * X[b].re - (int64)rw.im * X[b].im + (int64)w.re * d;
+			im = (int64)rw.re * X[b].im + (int64)rw.im * X[b].re + (int64)w.im * d;
+
+			X[b].re = sat32((re + 0x40000000) >> 31);
+			X[b].im = sat32((im + 0x40000000) >> 31);
+		}
+	}
+
+	delayline[0] = p;
+}
@@ -0,0 +1,82 @@
+/*
+ * Sliding DFT setup.
+ *
+ * Each new sample updates bin k of an N-sample window as
+ *
+ *	X = W * (r*X + x[n] - r^N * x[n-N]),	W = exp(j*2*pi*k/N)
+ *
+ * r < 1 damps the rounding error that would otherwise accumulate in the
+ * recursion. The window then sees older samples weighted by r^age; with
+ * r = 1 - 2^-15 the error stays bounded and the weighting is negligible
+ * for windows of a few hundred samples.
+ *
+ * 16-bit coefficients, 3*B + 1 entries, laid out for paired-halfword
+ * complex multiplies as in the DSPr2 FFT twiddles:
+ *
+ *	coeffs[3b]	(r*Wr, r*Wr)
+ *	coeffs[3b+1]	(-r*Wi, r*Wi)
+ *	coeffs[3b+2]	(Wr, Wi)
+ *	coeffs[3B]	(r^N, 0)
+ *
+ * 32-bit coefficients, 2*B + 1 entries:
+ *
+ *	coeffs[2b]	r*W
+ *	coeffs[2b+1]	W
+ *	coeffs[2B]	(r^N, 0)
+ */
+
+#include <math.h>
+#include "../../../include/dsplib_dsp.h"
+
+
+static int32 sdft_q(double v, double one, int32 max)
+{
+	v = floor(v * one + 0.5);
+
+	return (v > max) ? max : (int32) v;
+}
+
+
+void mips_sdft16_setup(int16c *coeffs, int *bins, int B, int N, int16 r)
+{
+	int b;
+	double a, fr;
+
+	fr = r / 32768.0;
+
+	for (b = 0; b < B; b++)
+	{
+		a = (2 * M_PI * bins[b]) / N;
+
+		coeffs[3*b].re = coeffs[3*b].im = sdft_q(fr * cos(a), 32768.0, MAX16);
+		coeffs[3*b+1].im = sdft_q(fr * sin(a), 32768.0, MAX16);
+		coeffs[3*b+1].re = -coeffs[3*b+1].im;
+		coeffs[3*b+2].re = sdft_q(cos(a), 32768.0, MAX16);
+		coeffs[3*b+2].im = sdft_q(sin(a), 32768.0, MAX16);
+	}
+
+	coeffs[3*B].re = sdft_q(pow(fr, N), 32768.0, MAX16);
+	coeffs[3*B].im = 0;
+}
+
+
+void mips_sdft32_setup(int32c *coeffs, int *bins, int B, int N, int32 r)
+{
+	int b;
+	double a, fr;
+
+	fr = r / 2147483648.0;
+
+	for (b = 0; b < B; b++)
+	{
+		a = (2 * M_PI * bins[b]) / N;
+
+		coeffs[2*b].re = sdft_q(fr * cos(a), 2147483648.0, MAX32);
+		coeffs[2*b].im = sdft_q(fr * sin(a), 2147483648.0, MAX32);
+		coeffs[2*b+1].re = sdft_q(cos(a), 2147483648.0, MAX32);
+		coeffs[2*b+1].im = sdft_q(sin(a), 2147483648.0, MAX32);
+	}
+
+	coeffs[2*B].re = sdft_q(pow(fr, N), 2147483648.0, MAX32);
+	coeffs[2*B].im = 0;
+}
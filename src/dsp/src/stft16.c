@@ -0,0 +1,128 @@
+/*
+ * Streaming 16-bit STFT.
+ *
+ * Samples are pushed into a 2N-entry ring by a single producer (typically
+ * an ISR) and frames are taken from it by a single consumer. A frame
+ * covers the N oldest unconsumed samples; taking it advances the read
+ * position by hop. The ring holds two frames' worth of samples, so the
+ * producer can keep filling the next hop while the current frame is
+ * windowed and transformed. wr and rd are free-running sample counts,
+ * each written by one side only, so no locking is needed.
+ *
+ * The window multiply is fused into the copy from the ring into the
+ * int16c FFT input, and the magnitude or power of bins 0 .. N/2 is
+ * written straight from the FFT output.
+ *
+ * ring: 2N int16
+ * buf:  3N int16c, FFT input, output and scratch
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+static int16 stft16_isqrt(uint32 x)
+{
+	uint32 r = 0, b = 0x40000000;
+
+	while (b > x)
+		b >>= 2;
+
+	while (b)
+	{
+		if (x >= r + b)
+		{
+			x -= r + b;
+			r = (r >> 1) + b;
+		}
+		else
+			r >>= 1;
+		b >>= 2;
+	}
+
+	/* round to nearest */
+
+	if (x > r)
+		r++;
+
+	return (r > MAX16) ? MAX16 : (int16) r;
+}
+
+
+void mips_stft16_init(stft16 *st, int16 *ring, int16c *buf, const int16 *window,
+					  int16c *twiddles, int log2N, int hop, int mode)
+{
+	st->log2N = log2N;
+	st->hop = hop;
+	st->mode = mode;
+	st->window = window;
+	st->twiddles = twiddles;
+	st->ring = ring;
+	st->buf = buf;
+	st->wr = 0;
+	st->rd = 0;
+}
+
+
+int mips_stft16_push(stft16 *st, int16 *indata, int n)
+{
+	uint32 wr = st->wr;
+	int N2 = 2 << st->log2N;
+	int space, i;
+
+	space = N2 - (int) (wr - st->rd);
+	if (n > space)
+		n = space;
+
+	for (i = 0; i < n; i++)
+		st->ring[(wr + i) & (N2 - 1)] = indata[i];
+
+	st->wr = wr + n;
+
+	return n;
+}
+
+
+int mips_stft16_frame(stft16 *st, int16 *outdata)
+{
+	int N = 1 << st->log2N;
+	int i, j, mask;
+	uint32 rd = st->rd;
+	int16c *din = st->buf;
+	int16c *dout = st->buf + N;
+	int32 re, im;
+	uint32 p;
+
+	if ((int) (st->wr - rd) < N)
+		return 0;
+
+	mask = 2 * N - 1;
+	j = rd & mask;
+
+	for (i = 0; i < N; i++)
+	{
+		din[i].re = mul16r(st->ring[j], st->window[i]);
+		din[i].im = 0;
+		j = (j + 1) & mask;
+	}
+
+	/* the samples are copied out, the producer may now overwrite them */
+
+	st->rd = rd + st->hop;
+
+	mips_fft16(dout, din, st->twiddles, st->buf + 2 * N, st->log2N);
+
+	for (i = 0; i <= N / 2; i++)
+	{
+		re = dout[i].re;
+		im = dout[i].im;
+
+		p = (uint32) (re * re) + (uint32) (im * im);
+
+		if (st->mode == STFT_POWER)
+			outdata[i] = SAT16P((p + 0x4000) >> 15);
+		else
+			outdata[i] = stft16_isqrt(p);
+	}
+
+	return 1;
+}
@@ -0,0 +1,82 @@
+/*
+ * Unsigned 8-bit vector operations for cores without the DSP ASE, one
+ * byte at a time. The DSPr2 versions in src/dspr2/vec8u.S give the same
+ * results four bytes at a time.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+void mips_vec_add8u(uint8 *outdata, uint8 *indata1, uint8 *indata2, int N)
+{
+	int i, v;
+
+	for (i = 0; i < N; i++)
+	{
+		v = indata1[i] + indata2[i];
+		outdata[i] = (uint8) ((v > 255) ? 255 : v);
+	}
+}
+
+
+void mips_vec_sub8u(uint8 *outdata, uint8 *indata1, uint8 *indata2, int N)
+{
+	int i, v;
+
+	for (i = 0; i < N; i++)
+	{
+		v = indata1[i] - indata2[i];
+		outdata[i] = (uint8) ((v < 0) ? 0 : v);
+	}
+}
+
+
+void mips_vec_avg8u(uint8 *outdata, uint8 *indata1, uint8 *indata2, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = (uint8) ((indata1[i] + indata2[i] + 1) >> 1);
+}
+
+
+void mips_vec_absdiff8u(uint8 *outdata, uint8 *indata1, uint8 *indata2, int N)
+{
+	int i, v;
+
+	for (i = 0; i < N; i++)
+	{
+		v = indata1[i] - indata2[i];
+		outdata[i] = (uint8) ((v < 0) ? -v : v);
+	}
+}
+
+
+void mips_vec_min8u(uint8 *outdata, uint8 *indata1, uint8 *indata2, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = (indata1[i] < indata2[i]) ? indata1[i] : indata2[i];
+}
+
+
+void mips_vec_max8u(uint8 *outdata, uint8 *indata1, uint8 *indata2, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = (indata1[i] > indata2[i]) ? indata1[i] : indata2[i];
+}
+
+
+uint32 mips_vec_sum8u(uint8 *indata, int N)
+{
+	uint32 sum = 0;
+	int i;
+
+	for (i = 0; i < N; i++)
+		sum += indata[i];
+
+	return sum;
+}
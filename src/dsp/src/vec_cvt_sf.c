@@ -0,0 +1,138 @@
+/*
+ * Q15/Q31 <-> single precision conversion for soft-float builds (e.g.
+ * PIC32MZ-DA). The IEEE bit patterns are built and taken apart with
+ * integer operations only, so there is no libgcc call per sample. The
+ * results are the same as those of the FPU versions in vec_q15_f32.S
+ * and vec_q31_f32.S: rounding to nearest even, saturation, and flush of
+ * float denormals to zero. Like them they round N down to a multiple of
+ * 4 and leave the tail alone.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+#ifndef __mips_hard_float
+
+
+/* v * 2^e as float bits; v != 0 */
+
+static inline uint32 cvt_to_f32(int32 v, int e)
+{
+	uint32 s = 0, m = (uint32) v, r;
+	int n;
+
+	if (v < 0)
+	{
+		s = 0x80000000;
+		m = -m;
+	}
+
+	n = 31 - __builtin_clz(m);		/* leading one at bit n */
+
+	if (n > 23)
+	{
+		r = m & ((1u << (n - 23)) - 1);
+		m >>= n - 23;
+
+		/* round to nearest even, a carry out of the mantissa bumps n */
+
+		if (r > (1u << (n - 24)) || (r == (1u << (n - 24)) && (m & 1)))
+			m++;
+		if (m >> 24)
+		{
+			m >>= 1;
+			n++;
+		}
+	}
+	else
+		m <<= 23 - n;
+
+	return s | ((uint32) (127 + n + e) << 23) | (m & 0x7FFFFF);
+}
+
+
+/* round(f * 2^e) saturated to [lo, hi] */
+
+static inline int32 cvt_from_f32(uint32 f, int e, int32 lo, int32 hi)
+{
+	int x = (f >> 23) & 0xFF;
+	uint32 m = (f & 0x7FFFFF) | 0x800000;
+	int sh;
+	int32 v;
+
+	if (x == 0)
+		return 0;
+
+	/* f = m * 2^(x - 150) */
+
+	sh = x - 150 + e;
+
+	if (sh >= 8)
+		return (f >> 31) ? lo : hi;
+
+	if (sh >= 0)
+		m <<= sh;
+	else if (sh < -24)
+		m = 0;
+	else
+	{
+		sh = -sh;
+		m = (m + (1u << (sh - 1)) - 1 + ((m >> sh) & 1)) >> sh;
+	}
+
+	if (f >> 31)
+		v = (m >= -(uint32) lo) ? lo : -(int32) m;
+	else
+		v = (m > (uint32) hi) ? hi : (int32) m;
+
+	return v;
+}
+
+
+void mips_vec_q15_to_f32(float *outdata, int16 *indata, int N, int scale)
+{
+	uint32 *out = (uint32 *) outdata;
+	int i;
+
+	N &= ~3;
+
+	for (i = 0; i < N; i++)
+		out[i] = indata[i] ? cvt_to_f32(indata[i], scale - 15) : 0;
+}
+
+
+void mips_vec_f32_to_q15(int16 *outdata, float *indata, int N, int scale)
+{
+	uint32 *in = (uint32 *) indata;
+	int i;
+
+	N &= ~3;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = (int16) cvt_from_f32(in[i], 15 - scale, MIN16, MAX16);
+}
+
+
+void mips_vec_q31_to_f32(float *outdata, int32 *indata, int N, int scale)
+{
+	uint32 *out = (uint32 *) outdata;
+	int i;
+
+	N &= ~3;
+
+	for (i = 0; i < N; i++)
+		out[i] = indata[i] ? cvt_to_f32(indata[i], scale - 31) : 0;
+}
+
+
+void mips_vec_f32_to_q31(int32 *outdata, float *indata, int N, int scale)
+{
+	uint32 *in = (uint32 *) indata;
+	int i;
+
+	N &= ~3;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = cvt_from_f32(in[i], 31 - scale, MIN32, MAX32);
+}
+
+#endif
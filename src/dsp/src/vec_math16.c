@@ -0,0 +1,68 @@
+/*
+ * Batch forms of the 16-bit functions in dsplib_math.h, any N >= 0.
+ */
+
+#include "../../../include/dsplib_math.h"
+
+
+void mips_vec_sin16(int16 *outdata, int16 *indata, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_sin16(indata[i]);
+}
+
+
+void mips_vec_cos16(int16 *outdata, int16 *indata, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_cos16(indata[i]);
+}
+
+
+void mips_vec_atan2_16(int16 *outdata, int16 *y, int16 *x, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_atan2_16(y[i], x[i]);
+}
+
+
+void mips_vec_sqrt16(int16 *outdata, int16 *indata, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_sqrt16(indata[i]);
+}
+
+
+void mips_vec_rsqrt16(int16 *outdata, int16 *indata, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_rsqrt16(indata[i]);
+}
+
+
+void mips_vec_log2_16(int16 *outdata, int16 *indata, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_log2_16(indata[i]);
+}
+
+
+void mips_vec_exp2_16(int16 *outdata, int16 *indata, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_exp2_16(indata[i]);
+}
@@ -0,0 +1,68 @@
+/*
+ * Batch forms of the 32-bit functions in dsplib_math.h, any N >= 0.
+ */
+
+#include "../../../include/dsplib_math.h"
+
+
+void mips_vec_sin32(int32 *outdata, int32 *indata, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_sin32(indata[i]);
+}
+
+
+void mips_vec_cos32(int32 *outdata, int32 *indata, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_cos32(indata[i]);
+}
+
+
+void mips_vec_atan2_32(int32 *outdata, int32 *y, int32 *x, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_atan2_32(y[i], x[i]);
+}
+
+
+void mips_vec_sqrt32(int32 *outdata, int32 *indata, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_sqrt32(indata[i]);
+}
+
+
+void mips_vec_rsqrt32(int32 *outdata, int32 *indata, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_rsqrt32(indata[i]);
+}
+
+
+void mips_vec_log2_32(int32 *outdata, int32 *indata, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_log2_32(indata[i]);
+}
+
+
+void mips_vec_exp2_32(int32 *outdata, int32 *indata, int N)
+{
+	int i;
+
+	for (i = 0; i < N; i++)
+		outdata[i] = mips_exp2_32(indata[i]);
+}
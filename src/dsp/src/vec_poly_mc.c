@@ -0,0 +1,66 @@
+/*
+ * Multi-channel Horner polynomial evaluation: N frames of C interleaved
+ * channels, each channel with its own K + 1 coefficients,
+ *
+ *	outdata[n*C + c] = poly(coeffs + c*(K + 1), indata[n*C + c])
+ *
+ * The Q31 steps are rounded and wrap as by mips_vec_poly32, so a
+ * channel gives the same result as the single polynomial kernels. Any
+ * N >= 0, C >= 1; outdata may be indata.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+void mips_vec_poly32_mc(int32 *outdata, int32 *indata, const int32 *coeffs, int K, int C, int N)
+{
+	const int32 *c;
+	int32 x, acc;
+	int i, ch, k;
+
+	for (i = 0; i < N; i++)
+	{
+		for (ch = 0, c = coeffs; ch < C; ch++, c += K + 1)
+		{
+			x = indata[ch];
+			acc = c[K];
+
+			for (k = K - 1; k >= 0; k--)
+				acc = (int32) (((int64) c[k] * 0x80000000 + (int64) acc * x + 0x40000000) >> 31);
+
+			outdata[ch] = acc;
+		}
+
+		indata += C;
+		outdata += C;
+	}
+}
+
+#ifdef __mips_hard_float
+
+
+void mips_vec_poly_f32_mc(float *outdata, float *indata, const float *coeffs, int K, int C, int N)
+{
+	const float *c;
+	float x, acc;
+	int i, ch, k;
+
+	for (i = 0; i < N; i++)
+	{
+		for (ch = 0, c = coeffs; ch < C; ch++, c += K + 1)
+		{
+			x = indata[ch];
+			acc = c[K];
+
+			for (k = K - 1; k >= 0; k--)
+				acc = c[k] + acc * x;
+
+			outdata[ch] = acc;
+		}
+
+		indata += C;
+		outdata += C;
+	}
+}
+
+#endif
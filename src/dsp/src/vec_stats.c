@@ -0,0 +1,51 @@
+/*
+ * One-pass sum, sum of squares, min and max, see mips_vec_stats16/32 in
+ * dsplib_dsp.h. The DSPr2 stats16 in src/dspr2/vec_stats16.S gives the
+ * same results from paired halfword dot products.
+ */
+
+#include "../../../include/dsplib_dsp.h"
+
+
+void mips_vec_stats16(vec_stats *st, int16 *indata, int N)
+{
+	int64 sum = 0, sumsq = 0;
+	int32 x, lo = MAX16, hi = MIN16;
+	int i;
+
+	for (i = 0; i < N; i++)
+	{
+		x = indata[i];
+		sum += x;
+		sumsq += x * x;
+		lo = (x < lo) ? x : lo;
+		hi = (x > hi) ? x : hi;
+	}
+
+	st->sum = sum;
+	st->sumsq = sumsq;
+	st->min = lo;
+	st->max = hi;
+}
+
+
+void mips_vec_stats32(vec_stats *st, int32 *indata, int N)
+{
+	int64 sum = 0, sumsq = 0;
+	int32 x, lo = MAX32, hi = MIN32;
+	int i;
+
+	for (i = 0; i < N; i++)
+	{
+		x = indata[i];
+		sum += x;
+		sumsq += ((int64) x * x) >> 31;
+		lo = (x < lo) ? x : lo;
+		hi = (x > hi) ? x : hi;
+	}
+
+	st->sum = sum;
+	st->sumsq = sumsq;
+	st->min = lo;
+	st->max = hi;
+}
@@ -0,0 +1,134 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16bharris1024[1024] =
+{
+	0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003,
+	0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0006,
+	0x0007, 0x0007, 0x0008, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c,
+	0x000d, 0x000d, 0x000e, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+	0x0016, 0x0017, 0x0018, 0x001a, 0x001b, 0x001d, 0x001e, 0x0020,
+	0x0022, 0x0024, 0x0026, 0x0028, 0x002a, 0x002c, 0x002e, 0x0030,
+	0x0033, 0x0035, 0x0038, 0x003a, 0x003d, 0x0040, 0x0042, 0x0045,
+	0x0048, 0x004c, 0x004f, 0x0052, 0x0055, 0x0059, 0x005d, 0x0060,
+	0x0064, 0x0068, 0x006c, 0x0070, 0x0075, 0x0079, 0x007e, 0x0083,
+	0x0087, 0x008c, 0x0091, 0x0097, 0x009c, 0x00a2, 0x00a7, 0x00ad,
+	0x00b3, 0x00b9, 0x00bf, 0x00c6, 0x00cd, 0x00d3, 0x00da, 0x00e1,
+	0x00e9, 0x00f0, 0x00f8, 0x0100, 0x0108, 0x0110, 0x0119, 0x0121,
+	0x012a, 0x0133, 0x013c, 0x0146, 0x0150, 0x015a, 0x0164, 0x016e,
+	0x0179, 0x0184, 0x018f, 0x019a, 0x01a6, 0x01b2, 0x01be, 0x01ca,
+	0x01d7, 0x01e4, 0x01f1, 0x01fe, 0x020c, 0x021a, 0x0228, 0x0237,
+	0x0246, 0x0255, 0x0265, 0x0274, 0x0285, 0x0295, 0x02a6, 0x02b7,
+	0x02c8, 0x02da, 0x02ec, 0x02ff, 0x0311, 0x0324, 0x0338, 0x034c,
+	0x0360, 0x0375, 0x038a, 0x039f, 0x03b5, 0x03cb, 0x03e1, 0x03f8,
+	0x040f, 0x0427, 0x043f, 0x0458, 0x0471, 0x048a, 0x04a4, 0x04be,
+	0x04d9, 0x04f4, 0x050f, 0x052b, 0x0548, 0x0565, 0x0582, 0x05a0,
+	0x05be, 0x05dd, 0x05fc, 0x061c, 0x063c, 0x065d, 0x067e, 0x069f,
+	0x06c2, 0x06e4, 0x0708, 0x072b, 0x0750, 0x0774, 0x079a, 0x07c0,
+	0x07e6, 0x080d, 0x0834, 0x085c, 0x0885, 0x08ae, 0x08d8, 0x0902,
+	0x092d, 0x0958, 0x0984, 0x09b1, 0x09de, 0x0a0c, 0x0a3a, 0x0a69,
+	0x0a99, 0x0ac9, 0x0af9, 0x0b2b, 0x0b5d, 0x0b8f, 0x0bc3, 0x0bf6,
+	0x0c2b, 0x0c60, 0x0c96, 0x0ccc, 0x0d03, 0x0d3b, 0x0d73, 0x0dac,
+	0x0de5, 0x0e20, 0x0e5b, 0x0e96, 0x0ed2, 0x0f0f, 0x0f4d, 0x0f8b,
+	0x0fca, 0x100a, 0x104a, 0x108b, 0x10cc, 0x110f, 0x1152, 0x1195,
+	0x11da, 0x121f, 0x1264, 0x12ab, 0x12f2, 0x133a, 0x1382, 0x13cb,
+	0x1415, 0x1460, 0x14ab, 0x14f7, 0x1544, 0x1591, 0x15df, 0x162e,
+	0x167e, 0x16ce, 0x171f, 0x1771, 0x17c3, 0x1816, 0x186a, 0x18be,
+	0x1913, 0x1969, 0x19c0, 0x1a17, 0x1a6f, 0x1ac8, 0x1b21, 0x1b7b,
+	0x1bd6, 0x1c32, 0x1c8e, 0x1ceb, 0x1d48, 0x1da6, 0x1e05, 0x1e65,
+	0x1ec5, 0x1f26, 0x1f88, 0x1fea, 0x204d, 0x20b1, 0x2115, 0x217a,
+	0x21e0, 0x2247, 0x22ae, 0x2315, 0x237e, 0x23e7, 0x2450, 0x24bb,
+	0x2525, 0x2591, 0x25fd, 0x266a, 0x26d7, 0x2746, 0x27b4, 0x2823,
+	0x2893, 0x2904, 0x2975, 0x29e7, 0x2a59, 0x2acc, 0x2b3f, 0x2bb3,
+	0x2c27, 0x2c9c, 0x2d12, 0x2d88, 0x2dff, 0x2e76, 0x2eee, 0x2f66,
+	0x2fdf, 0x3058, 0x30d2, 0x314c, 0x31c7, 0x3242, 0x32be, 0x333a,
+	0x33b7, 0x3434, 0x34b2, 0x3530, 0x35ae, 0x362d, 0x36ac, 0x372b,
+	0x37ab, 0x382c, 0x38ad, 0x392e, 0x39af, 0x3a31, 0x3ab3, 0x3b36,
+	0x3bb8, 0x3c3b, 0x3cbf, 0x3d43, 0x3dc7, 0x3e4b, 0x3ecf, 0x3f54,
+	0x3fd9, 0x405e, 0x40e4, 0x416a, 0x41ef, 0x4275, 0x42fc, 0x4382,
+	0x4409, 0x448f, 0x4516, 0x459d, 0x4624, 0x46ac, 0x4733, 0x47ba,
+	0x4842, 0x48c9, 0x4951, 0x49d9, 0x4a60, 0x4ae8, 0x4b6f, 0x4bf7,
+	0x4c7f, 0x4d06, 0x4d8e, 0x4e15, 0x4e9d, 0x4f24, 0x4fab, 0x5032,
+	0x50b9, 0x5140, 0x51c7, 0x524d, 0x52d4, 0x535a, 0x53e0, 0x5466,
+	0x54eb, 0x5571, 0x55f6, 0x567b, 0x56ff, 0x5784, 0x5808, 0x588b,
+	0x590f, 0x5992, 0x5a15, 0x5a97, 0x5b19, 0x5b9a, 0x5c1c, 0x5c9c,
+	0x5d1d, 0x5d9d, 0x5e1c, 0x5e9b, 0x5f1a, 0x5f98, 0x6015, 0x6092,
+	0x610f, 0x618b, 0x6206, 0x6281, 0x62fb, 0x6375, 0x63ee, 0x6466,
+	0x64de, 0x6555, 0x65cc, 0x6641, 0x66b7, 0x672b, 0x679f, 0x6812,
+	0x6884, 0x68f6, 0x6967, 0x69d7, 0x6a46, 0x6ab4, 0x6b22, 0x6b8f,
+	0x6bfb, 0x6c66, 0x6cd0, 0x6d3a, 0x6da3, 0x6e0a, 0x6e71, 0x6ed7,
+	0x6f3c, 0x6fa0, 0x7003, 0x7065, 0x70c7, 0x7127, 0x7186, 0x71e4,
+	0x7242, 0x729e, 0x72f9, 0x7353, 0x73ac, 0x7404, 0x745b, 0x74b1,
+	0x7506, 0x755a, 0x75ac, 0x75fe, 0x764e, 0x769d, 0x76eb, 0x7738,
+	0x7784, 0x77ce, 0x7818, 0x7860, 0x78a7, 0x78ed, 0x7931, 0x7975,
+	0x79b7, 0x79f8, 0x7a37, 0x7a76, 0x7ab3, 0x7aef, 0x7b29, 0x7b63,
+	0x7b9b, 0x7bd1, 0x7c07, 0x7c3b, 0x7c6e, 0x7c9f, 0x7ccf, 0x7cfe,
+	0x7d2c, 0x7d58, 0x7d83, 0x7dac, 0x7dd4, 0x7dfb, 0x7e20, 0x7e44,
+	0x7e67, 0x7e88, 0x7ea8, 0x7ec6, 0x7ee3, 0x7eff, 0x7f19, 0x7f32,
+	0x7f4a, 0x7f60, 0x7f74, 0x7f87, 0x7f99, 0x7faa, 0x7fb9, 0x7fc6,
+	0x7fd2, 0x7fdd, 0x7fe6, 0x7fee, 0x7ff5, 0x7ffa, 0x7ffd, 0x7fff,
+	0x7fff, 0x7fff, 0x7ffd, 0x7ffa, 0x7ff5, 0x7fee, 0x7fe6, 0x7fdd,
+	0x7fd2, 0x7fc6, 0x7fb9, 0x7faa, 0x7f99, 0x7f87, 0x7f74, 0x7f60,
+	0x7f4a, 0x7f32, 0x7f19, 0x7eff, 0x7ee3, 0x7ec6, 0x7ea8, 0x7e88,
+	0x7e67, 0x7e44, 0x7e20, 0x7dfb, 0x7dd4, 0x7dac, 0x7d83, 0x7d58,
+	0x7d2c, 0x7cfe, 0x7ccf, 0x7c9f, 0x7c6e, 0x7c3b, 0x7c07, 0x7bd1,
+	0x7b9b, 0x7b63, 0x7b29, 0x7aef, 0x7ab3, 0x7a76, 0x7a37, 0x79f8,
+	0x79b7, 0x7975, 0x7931, 0x78ed, 0x78a7, 0x7860, 0x7818, 0x77ce,
+	0x7784, 0x7738, 0x76eb, 0x769d, 0x764e, 0x75fe, 0x75ac, 0x755a,
+	0x7506, 0x74b1, 0x745b, 0x7404, 0x73ac, 0x7353, 0x72f9, 0x729e,
+	0x7242, 0x71e4, 0x7186, 0x7127, 0x70c7, 0x7065, 0x7003, 0x6fa0,
+	0x6f3c, 0x6ed7, 0x6e71, 0x6e0a, 0x6da3, 0x6d3a, 0x6cd0, 0x6c66,
+	0x6bfb, 0x6b8f, 0x6b22, 0x6ab4, 0x6a46, 0x69d7, 0x6967, 0x68f6,
+	0x6884, 0x6812, 0x679f, 0x672b, 0x66b7, 0x6641, 0x65cc, 0x6555,
+	0x64de, 0x6466, 0x63ee, 0x6375, 0x62fb, 0x6281, 0x6206, 0x618b,
+	0x610f, 0x6092, 0x6015, 0x5f98, 0x5f1a, 0x5e9b, 0x5e1c, 0x5d9d,
+	0x5d1d, 0x5c9c, 0x5c1c, 0x5b9a, 0x5b19, 0x5a97, 0x5a15, 0x5992,
+	0x590f, 0x588b, 0x5808, 0x5784, 0x56ff, 0x567b, 0x55f6, 0x5571,
+	0x54eb, 0x5466, 0x53e0, 0x535a, 0x52d4, 0x524d, 0x51c7, 0x5140,
+	0x50b9, 0x5032, 0x4fab, 0x4f24, 0x4e9d, 0x4e15, 0x4d8e, 0x4d06,
+	0x4c7f, 0x4bf7, 0x4b6f, 0x4ae8, 0x4a60, 0x49d9, 0x4951, 0x48c9,
+	0x4842, 0x47ba, 0x4733, 0x46ac, 0x4624, 0x459d, 0x4516, 0x448f,
+	0x4409, 0x4382, 0x42fc, 0x4275, 0x41ef, 0x416a, 0x40e4, 0x405e,
+	0x3fd9, 0x3f54, 0x3ecf, 0x3e4b, 0x3dc7, 0x3d43, 0x3cbf, 0x3c3b,
+	0x3bb8, 0x3b36, 0x3ab3, 0x3a31, 0x39af, 0x392e, 0x38ad, 0x382c,
+	0x37ab, 0x372b, 0x36ac, 0x362d, 0x35ae, 0x3530, 0x34b2, 0x3434,
+	0x33b7, 0x333a, 0x32be, 0x3242, 0x31c7, 0x314c, 0x30d2, 0x3058,
+	0x2fdf, 0x2f66, 0x2eee, 0x2e76, 0x2dff, 0x2d88, 0x2d12, 0x2c9c,
+	0x2c27, 0x2bb3, 0x2b3f, 0x2acc, 0x2a59, 0x29e7, 0x2975, 0x2904,
+	0x2893, 0x2823, 0x27b4, 0x2746, 0x26d7, 0x266a, 0x25fd, 0x2591,
+	0x2525, 0x24bb, 0x2450, 0x23e7, 0x237e, 0x2315, 0x22ae, 0x2247,
+	0x21e0, 0x217a, 0x2115, 0x20b1, 0x204d, 0x1fea, 0x1f88, 0x1f26,
+	0x1ec5, 0x1e65, 0x1e05, 0x1da6, 0x1d48, 0x1ceb, 0x1c8e, 0x1c32,
+	0x1bd6, 0x1b7b, 0x1b21, 0x1ac8, 0x1a6f, 0x1a17, 0x19c0, 0x1969,
+	0x1913, 0x18be, 0x186a, 0x1816, 0x17c3, 0x1771, 0x171f, 0x16ce,
+	0x167e, 0x162e, 0x15df, 0x1591, 0x1544, 0x14f7, 0x14ab, 0x1460,
+	0x1415, 0x13cb, 0x1382, 0x133a, 0x12f2, 0x12ab, 0x1264, 0x121f,
+	0x11da, 0x1195, 0x1152, 0x110f, 0x10cc, 0x108b, 0x104a, 0x100a,
+	0x0fca, 0x0f8b, 0x0f4d, 0x0f0f, 0x0ed2, 0x0e96, 0x0e5b, 0x0e20,
+	0x0de5, 0x0dac, 0x0d73, 0x0d3b, 0x0d03, 0x0ccc, 0x0c96, 0x0c60,
+	0x0c2b, 0x0bf6, 0x0bc3, 0x0b8f, 0x0b5d, 0x0b2b, 0x0af9, 0x0ac9,
+	0x0a99, 0x0a69, 0x0a3a, 0x0a0c, 0x09de, 0x09b1, 0x0984, 0x0958,
+	0x092d, 0x0902, 0x08d8, 0x08ae, 0x0885, 0x085c, 0x0834, 0x080d,
+	0x07e6, 0x07c0, 0x079a, 0x0774, 0x0750, 0x072b, 0x0708, 0x06e4,
+	0x06c2, 0x069f, 0x067e, 0x065d, 0x063c, 0x061c, 0x05fc, 0x05dd,
+	0x05be, 0x05a0, 0x0582, 0x0565, 0x0548, 0x052b, 0x050f, 0x04f4,
+	0x04d9, 0x04be, 0x04a4, 0x048a, 0x0471, 0x0458, 0x043f, 0x0427,
+	0x040f, 0x03f8, 0x03e1, 0x03cb, 0x03b5, 0x039f, 0x038a, 0x0375,
+	0x0360, 0x034c, 0x0338, 0x0324, 0x0311, 0x02ff, 0x02ec, 0x02da,
+	0x02c8, 0x02b7, 0x02a6, 0x0295, 0x0285, 0x0274, 0x0265, 0x0255,
+	0x0246, 0x0237, 0x0228, 0x021a, 0x020c, 0x01fe, 0x01f1, 0x01e4,
+	0x01d7, 0x01ca, 0x01be, 0x01b2, 0x01a6, 0x019a, 0x018f, 0x0184,
+	0x0179, 0x016e, 0x0164, 0x015a, 0x0150, 0x0146, 0x013c, 0x0133,
+	0x012a, 0x0121, 0x0119, 0x0110, 0x0108, 0x0100, 0x00f8, 0x00f0,
+	0x00e9, 0x00e1, 0x00da, 0x00d3, 0x00cd, 0x00c6, 0x00bf, 0x00b9,
+	0x00b3, 0x00ad, 0x00a7, 0x00a2, 0x009c, 0x0097, 0x0091, 0x008c,
+	0x0087, 0x0083, 0x007e, 0x0079, 0x0075, 0x0070, 0x006c, 0x0068,
+	0x0064, 0x0060, 0x005d, 0x0059, 0x0055, 0x0052, 0x004f, 0x004c,
+	0x0048, 0x0045, 0x0042, 0x0040, 0x003d, 0x003a, 0x0038, 0x0035,
+	0x0033, 0x0030, 0x002e, 0x002c, 0x002a, 0x0028, 0x0026, 0x0024,
+	0x0022, 0x0020, 0x001e, 0x001d, 0x001b, 0x001a, 0x0018, 0x0017,
+	0x0016, 0x0014, 0x0013, 0x0012, 0x0011, 0x0010, 0x000e, 0x000d,
+	0x000d, 0x000c, 0x000b, 0x000a, 0x0009, 0x0008, 0x0008, 0x0007,
+	0x0007, 0x0006, 0x0005, 0x0005, 0x0005, 0x0004, 0x0004, 0x0003,
+	0x0003, 0x0003, 0x0003, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+};
+
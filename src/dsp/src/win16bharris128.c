@@ -0,0 +1,22 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16bharris128[128] =
+{
+	0x0002, 0x0003, 0x0007, 0x000d, 0x0016, 0x0022, 0x0033, 0x0048,
+	0x0064, 0x0087, 0x00b3, 0x00e9, 0x012a, 0x0179, 0x01d7, 0x0246,
+	0x02c8, 0x0360, 0x040f, 0x04d9, 0x05be, 0x06c2, 0x07e6, 0x092d,
+	0x0a99, 0x0c2b, 0x0de5, 0x0fca, 0x11da, 0x1415, 0x167e, 0x1913,
+	0x1bd6, 0x1ec5, 0x21e0, 0x2525, 0x2893, 0x2c27, 0x2fdf, 0x33b7,
+	0x37ab, 0x3bb8, 0x3fd9, 0x4409, 0x4842, 0x4c7f, 0x50b9, 0x54eb,
+	0x590f, 0x5d1d, 0x610f, 0x64de, 0x6884, 0x6bfb, 0x6f3c, 0x7242,
+	0x7506, 0x7784, 0x79b7, 0x7b9b, 0x7d2c, 0x7e67, 0x7f4a, 0x7fd2,
+	0x7fff, 0x7fd2, 0x7f4a, 0x7e67, 0x7d2c, 0x7b9b, 0x79b7, 0x7784,
+	0x7506, 0x7242, 0x6f3c, 0x6bfb, 0x6884, 0x64de, 0x610f, 0x5d1d,
+	0x590f, 0x54eb, 0x50b9, 0x4c7f, 0x4842, 0x4409, 0x3fd9, 0x3bb8,
+	0x37ab, 0x33b7, 0x2fdf, 0x2c27, 0x2893, 0x2525, 0x21e0, 0x1ec5,
+	0x1bd6, 0x1913, 0x167e, 0x1415, 0x11da, 0x0fca, 0x0de5, 0x0c2b,
+	0x0a99, 0x092d, 0x07e6, 0x06c2, 0x05be, 0x04d9, 0x040f, 0x0360,
+	0x02c8, 0x0246, 0x01d7, 0x0179, 0x012a, 0x00e9, 0x00b3, 0x0087,
+	0x0064, 0x0048, 0x0033, 0x0022, 0x0016, 0x000d, 0x0007, 0x0003,
+};
+
@@ -0,0 +1,38 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16bharris256[256] =
+{
+	0x0002, 0x0002, 0x0003, 0x0005, 0x0007, 0x0009, 0x000d, 0x0011,
+	0x0016, 0x001b, 0x0022, 0x002a, 0x0033, 0x003d, 0x0048, 0x0055,
+	0x0064, 0x0075, 0x0087, 0x009c, 0x00b3, 0x00cd, 0x00e9, 0x0108,
+	0x012a, 0x0150, 0x0179, 0x01a6, 0x01d7, 0x020c, 0x0246, 0x0285,
+	0x02c8, 0x0311, 0x0360, 0x03b5, 0x040f, 0x0471, 0x04d9, 0x0548,
+	0x05be, 0x063c, 0x06c2, 0x0750, 0x07e6, 0x0885, 0x092d, 0x09de,
+	0x0a99, 0x0b5d, 0x0c2b, 0x0d03, 0x0de5, 0x0ed2, 0x0fca, 0x10cc,
+	0x11da, 0x12f2, 0x1415, 0x1544, 0x167e, 0x17c3, 0x1913, 0x1a6f,
+	0x1bd6, 0x1d48, 0x1ec5, 0x204d, 0x21e0, 0x237e, 0x2525, 0x26d7,
+	0x2893, 0x2a59, 0x2c27, 0x2dff, 0x2fdf, 0x31c7, 0x33b7, 0x35ae,
+	0x37ab, 0x39af, 0x3bb8, 0x3dc7, 0x3fd9, 0x41ef, 0x4409, 0x4624,
+	0x4842, 0x4a60, 0x4c7f, 0x4e9d, 0x50b9, 0x52d4, 0x54eb, 0x56ff,
+	0x590f, 0x5b19, 0x5d1d, 0x5f1a, 0x610f, 0x62fb, 0x64de, 0x66b7,
+	0x6884, 0x6a46, 0x6bfb, 0x6da3, 0x6f3c, 0x70c7, 0x7242, 0x73ac,
+	0x7506, 0x764e, 0x7784, 0x78a7, 0x79b7, 0x7ab3, 0x7b9b, 0x7c6e,
+	0x7d2c, 0x7dd4, 0x7e67, 0x7ee3, 0x7f4a, 0x7f99, 0x7fd2, 0x7ff5,
+	0x7fff, 0x7ff5, 0x7fd2, 0x7f99, 0x7f4a, 0x7ee3, 0x7e67, 0x7dd4,
+	0x7d2c, 0x7c6e, 0x7b9b, 0x7ab3, 0x79b7, 0x78a7, 0x7784, 0x764e,
+	0x7506, 0x73ac, 0x7242, 0x70c7, 0x6f3c, 0x6da3, 0x6bfb, 0x6a46,
+	0x6884, 0x66b7, 0x64de, 0x62fb, 0x610f, 0x5f1a, 0x5d1d, 0x5b19,
+	0x590f, 0x56ff, 0x54eb, 0x52d4, 0x50b9, 0x4e9d, 0x4c7f, 0x4a60,
+	0x4842, 0x4624, 0x4409, 0x41ef, 0x3fd9, 0x3dc7, 0x3bb8, 0x39af,
+	0x37ab, 0x35ae, 0x33b7, 0x31c7, 0x2fdf, 0x2dff, 0x2c27, 0x2a59,
+	0x2893, 0x26d7, 0x2525, 0x237e, 0x21e0, 0x204d, 0x1ec5, 0x1d48,
+	0x1bd6, 0x1a6f, 0x1913, 0x17c3, 0x167e, 0x1544, 0x1415, 0x12f2,
+	0x11da, 0x10cc, 0x0fca, 0x0ed2, 0x0de5, 0x0d03, 0x0c2b, 0x0b5d,
+	0x0a99, 0x09de, 0x092d, 0x0885, 0x07e6, 0x0750, 0x06c2, 0x063c,
+	0x05be, 0x0548, 0x04d9, 0x0471, 0x040f, 0x03b5, 0x0360, 0x0311,
+	0x02c8, 0x0285, 0x0246, 0x020c, 0x01d7, 0x01a6, 0x0179, 0x0150,
+	0x012a, 0x0108, 0x00e9, 0x00cd, 0x00b3, 0x009c, 0x0087, 0x0075,
+	0x0064, 0x0055, 0x0048, 0x003d, 0x0033, 0x002a, 0x0022, 0x001b,
+	0x0016, 0x0011, 0x000d, 0x0009, 0x0007, 0x0005, 0x0003, 0x0002,
+};
+
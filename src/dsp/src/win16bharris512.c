@@ -0,0 +1,70 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16bharris512[512] =
+{
+	0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0005, 0x0005,
+	0x0007, 0x0008, 0x0009, 0x000b, 0x000d, 0x000e, 0x0011, 0x0013,
+	0x0016, 0x0018, 0x001b, 0x001e, 0x0022, 0x0026, 0x002a, 0x002e,
+	0x0033, 0x0038, 0x003d, 0x0042, 0x0048, 0x004f, 0x0055, 0x005d,
+	0x0064, 0x006c, 0x0075, 0x007e, 0x0087, 0x0091, 0x009c, 0x00a7,
+	0x00b3, 0x00bf, 0x00cd, 0x00da, 0x00e9, 0x00f8, 0x0108, 0x0119,
+	0x012a, 0x013c, 0x0150, 0x0164, 0x0179, 0x018f, 0x01a6, 0x01be,
+	0x01d7, 0x01f1, 0x020c, 0x0228, 0x0246, 0x0265, 0x0285, 0x02a6,
+	0x02c8, 0x02ec, 0x0311, 0x0338, 0x0360, 0x038a, 0x03b5, 0x03e1,
+	0x040f, 0x043f, 0x0471, 0x04a4, 0x04d9, 0x050f, 0x0548, 0x0582,
+	0x05be, 0x05fc, 0x063c, 0x067e, 0x06c2, 0x0708, 0x0750, 0x079a,
+	0x07e6, 0x0834, 0x0885, 0x08d8, 0x092d, 0x0984, 0x09de, 0x0a3a,
+	0x0a99, 0x0af9, 0x0b5d, 0x0bc3, 0x0c2b, 0x0c96, 0x0d03, 0x0d73,
+	0x0de5, 0x0e5b, 0x0ed2, 0x0f4d, 0x0fca, 0x104a, 0x10cc, 0x1152,
+	0x11da, 0x1264, 0x12f2, 0x1382, 0x1415, 0x14ab, 0x1544, 0x15df,
+	0x167e, 0x171f, 0x17c3, 0x186a, 0x1913, 0x19c0, 0x1a6f, 0x1b21,
+	0x1bd6, 0x1c8e, 0x1d48, 0x1e05, 0x1ec5, 0x1f88, 0x204d, 0x2115,
+	0x21e0, 0x22ae, 0x237e, 0x2450, 0x2525, 0x25fd, 0x26d7, 0x27b4,
+	0x2893, 0x2975, 0x2a59, 0x2b3f, 0x2c27, 0x2d12, 0x2dff, 0x2eee,
+	0x2fdf, 0x30d2, 0x31c7, 0x32be, 0x33b7, 0x34b2, 0x35ae, 0x36ac,
+	0x37ab, 0x38ad, 0x39af, 0x3ab3, 0x3bb8, 0x3cbf, 0x3dc7, 0x3ecf,
+	0x3fd9, 0x40e4, 0x41ef, 0x42fc, 0x4409, 0x4516, 0x4624, 0x4733,
+	0x4842, 0x4951, 0x4a60, 0x4b6f, 0x4c7f, 0x4d8e, 0x4e9d, 0x4fab,
+	0x50b9, 0x51c7, 0x52d4, 0x53e0, 0x54eb, 0x55f6, 0x56ff, 0x5808,
+	0x590f, 0x5a15, 0x5b19, 0x5c1c, 0x5d1d, 0x5e1c, 0x5f1a, 0x6015,
+	0x610f, 0x6206, 0x62fb, 0x63ee, 0x64de, 0x65cc, 0x66b7, 0x679f,
+	0x6884, 0x6967, 0x6a46, 0x6b22, 0x6bfb, 0x6cd0, 0x6da3, 0x6e71,
+	0x6f3c, 0x7003, 0x70c7, 0x7186, 0x7242, 0x72f9, 0x73ac, 0x745b,
+	0x7506, 0x75ac, 0x764e, 0x76eb, 0x7784, 0x7818, 0x78a7, 0x7931,
+	0x79b7, 0x7a37, 0x7ab3, 0x7b29, 0x7b9b, 0x7c07, 0x7c6e, 0x7ccf,
+	0x7d2c, 0x7d83, 0x7dd4, 0x7e20, 0x7e67, 0x7ea8, 0x7ee3, 0x7f19,
+	0x7f4a, 0x7f74, 0x7f99, 0x7fb9, 0x7fd2, 0x7fe6, 0x7ff5, 0x7ffd,
+	0x7fff, 0x7ffd, 0x7ff5, 0x7fe6, 0x7fd2, 0x7fb9, 0x7f99, 0x7f74,
+	0x7f4a, 0x7f19, 0x7ee3, 0x7ea8, 0x7e67, 0x7e20, 0x7dd4, 0x7d83,
+	0x7d2c, 0x7ccf, 0x7c6e, 0x7c07, 0x7b9b, 0x7b29, 0x7ab3, 0x7a37,
+	0x79b7, 0x7931, 0x78a7, 0x7818, 0x7784, 0x76eb, 0x764e, 0x75ac,
+	0x7506, 0x745b, 0x73ac, 0x72f9, 0x7242, 0x7186, 0x70c7, 0x7003,
+	0x6f3c, 0x6e71, 0x6da3, 0x6cd0, 0x6bfb, 0x6b22, 0x6a46, 0x6967,
+	0x6884, 0x679f, 0x66b7, 0x65cc, 0x64de, 0x63ee, 0x62fb, 0x6206,
+	0x610f, 0x6015, 0x5f1a, 0x5e1c, 0x5d1d, 0x5c1c, 0x5b19, 0x5a15,
+	0x590f, 0x5808, 0x56ff, 0x55f6, 0x54eb, 0x53e0, 0x52d4, 0x51c7,
+	0x50b9, 0x4fab, 0x4e9d, 0x4d8e, 0x4c7f, 0x4b6f, 0x4a60, 0x4951,
+	0x4842, 0x4733, 0x4624, 0x4516, 0x4409, 0x42fc, 0x41ef, 0x40e4,
+	0x3fd9, 0x3ecf, 0x3dc7, 0x3cbf, 0x3bb8, 0x3ab3, 0x39af, 0x38ad,
+	0x37ab, 0x36ac, 0x35ae, 0x34b2, 0x33b7, 0x32be, 0x31c7, 0x30d2,
+	0x2fdf, 0x2eee, 0x2dff, 0x2d12, 0x2c27, 0x2b3f, 0x2a59, 0x2975,
+	0x2893, 0x27b4, 0x26d7, 0x25fd, 0x2525, 0x2450, 0x237e, 0x22ae,
+	0x21e0, 0x2115, 0x204d, 0x1f88, 0x1ec5, 0x1e05, 0x1d48, 0x1c8e,
+	0x1bd6, 0x1b21, 0x1a6f, 0x19c0, 0x1913, 0x186a, 0x17c3, 0x171f,
+	0x167e, 0x15df, 0x1544, 0x14ab, 0x1415, 0x1382, 0x12f2, 0x1264,
+	0x11da, 0x1152, 0x10cc, 0x104a, 0x0fca, 0x0f4d, 0x0ed2, 0x0e5b,
+	0x0de5, 0x0d73, 0x0d03, 0x0c96, 0x0c2b, 0x0bc3, 0x0b5d, 0x0af9,
+	0x0a99, 0x0a3a, 0x09de, 0x0984, 0x092d, 0x08d8, 0x0885, 0x0834,
+	0x07e6, 0x079a, 0x0750, 0x0708, 0x06c2, 0x067e, 0x063c, 0x05fc,
+	0x05be, 0x0582, 0x0548, 0x050f, 0x04d9, 0x04a4, 0x0471, 0x043f,
+	0x040f, 0x03e1, 0x03b5, 0x038a, 0x0360, 0x0338, 0x0311, 0x02ec,
+	0x02c8, 0x02a6, 0x0285, 0x0265, 0x0246, 0x0228, 0x020c, 0x01f1,
+	0x01d7, 0x01be, 0x01a6, 0x018f, 0x0179, 0x0164, 0x0150, 0x013c,
+	0x012a, 0x0119, 0x0108, 0x00f8, 0x00e9, 0x00da, 0x00cd, 0x00bf,
+	0x00b3, 0x00a7, 0x009c, 0x0091, 0x0087, 0x007e, 0x0075, 0x006c,
+	0x0064, 0x005d, 0x0055, 0x004f, 0x0048, 0x0042, 0x003d, 0x0038,
+	0x0033, 0x002e, 0x002a, 0x0026, 0x0022, 0x001e, 0x001b, 0x0018,
+	0x0016, 0x0013, 0x0011, 0x000e, 0x000d, 0x000b, 0x0009, 0x0008,
+	0x0007, 0x0005, 0x0005, 0x0004, 0x0003, 0x0003, 0x0002, 0x0002,
+};
+
@@ -0,0 +1,14 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16bharris64[64] =
+{
+	0x0002, 0x0007, 0x0016, 0x0033, 0x0064, 0x00b3, 0x012a, 0x01d7,
+	0x02c8, 0x040f, 0x05be, 0x07e6, 0x0a99, 0x0de5, 0x11da, 0x167e,
+	0x1bd6, 0x21e0, 0x2893, 0x2fdf, 0x37ab, 0x3fd9, 0x4842, 0x50b9,
+	0x590f, 0x610f, 0x6884, 0x6f3c, 0x7506, 0x79b7, 0x7d2c, 0x7f4a,
+	0x7fff, 0x7f4a, 0x7d2c, 0x79b7, 0x7506, 0x6f3c, 0x6884, 0x610f,
+	0x590f, 0x50b9, 0x4842, 0x3fd9, 0x37ab, 0x2fdf, 0x2893, 0x21e0,
+	0x1bd6, 0x167e, 0x11da, 0x0de5, 0x0a99, 0x07e6, 0x05be, 0x040f,
+	0x02c8, 0x01d7, 0x012a, 0x00b3, 0x0064, 0x0033, 0x0016, 0x0007,
+};
+
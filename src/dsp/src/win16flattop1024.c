@@ -0,0 +1,134 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16flattop1024[1024] =
+{
+	0xfff2, 0xfff2, 0xfff2, 0xfff2, 0xfff2, 0xfff1, 0xfff1, 0xfff1,
+	0xfff0, 0xfff0, 0xffef, 0xffee, 0xffee, 0xffed, 0xffec, 0xffeb,
+	0xffea, 0xffe9, 0xffe8, 0xffe7, 0xffe5, 0xffe4, 0xffe2, 0xffe1,
+	0xffdf, 0xffde, 0xffdc, 0xffda, 0xffd8, 0xffd6, 0xffd4, 0xffd2,
+	0xffd0, 0xffce, 0xffcb, 0xffc9, 0xffc6, 0xffc3, 0xffc1, 0xffbe,
+	0xffbb, 0xffb8, 0xffb5, 0xffb1, 0xffae, 0xffab, 0xffa7, 0xffa3,
+	0xffa0, 0xff9c, 0xff98, 0xff94, 0xff8f, 0xff8b, 0xff87, 0xff82,
+	0xff7d, 0xff79, 0xff74, 0xff6f, 0xff69, 0xff64, 0xff5f, 0xff59,
+	0xff53, 0xff4e, 0xff48, 0xff41, 0xff3b, 0xff35, 0xff2e, 0xff27,
+	0xff20, 0xff19, 0xff12, 0xff0b, 0xff03, 0xfefc, 0xfef4, 0xfeec,
+	0xfee4, 0xfedc, 0xfed3, 0xfecb, 0xfec2, 0xfeb9, 0xfeb0, 0xfea6,
+	0xfe9d, 0xfe93, 0xfe89, 0xfe7f, 0xfe75, 0xfe6b, 0xfe60, 0xfe56,
+	0xfe4b, 0xfe40, 0xfe35, 0xfe29, 0xfe1e, 0xfe12, 0xfe06, 0xfdfa,
+	0xfded, 0xfde1, 0xfdd4, 0xfdc7, 0xfdba, 0xfdad, 0xfd9f, 0xfd92,
+	0xfd84, 0xfd76, 0xfd68, 0xfd5a, 0xfd4b, 0xfd3c, 0xfd2d, 0xfd1e,
+	0xfd0f, 0xfd00, 0xfcf0, 0xfce1, 0xfcd1, 0xfcc1, 0xfcb0, 0xfca0,
+	0xfc8f, 0xfc7f, 0xfc6e, 0xfc5d, 0xfc4c, 0xfc3a, 0xfc29, 0xfc18,
+	0xfc06, 0xfbf4, 0xfbe2, 0xfbd0, 0xfbbe, 0xfbab, 0xfb99, 0xfb86,
+	0xfb74, 0xfb61, 0xfb4e, 0xfb3b, 0xfb28, 0xfb15, 0xfb02, 0xfaef,
+	0xfadb, 0xfac8, 0xfab5, 0xfaa1, 0xfa8e, 0xfa7a, 0xfa67, 0xfa53,
+	0xfa40, 0xfa2c, 0xfa19, 0xfa05, 0xf9f1, 0xf9de, 0xf9ca, 0xf9b7,
+	0xf9a4, 0xf990, 0xf97d, 0xf96a, 0xf957, 0xf944, 0xf931, 0xf91e,
+	0xf90b, 0xf8f9, 0xf8e6, 0xf8d4, 0xf8c2, 0xf8b0, 0xf89e, 0xf88d,
+	0xf87c, 0xf86a, 0xf85a, 0xf849, 0xf838, 0xf828, 0xf818, 0xf809,
+	0xf7fa, 0xf7eb, 0xf7dc, 0xf7ce, 0xf7c0, 0xf7b2, 0xf7a5, 0xf798,
+	0xf78b, 0xf77f, 0xf773, 0xf768, 0xf75d, 0xf753, 0xf749, 0xf740,
+	0xf737, 0xf72f, 0xf727, 0xf720, 0xf719, 0xf713, 0xf70d, 0xf708,
+	0xf704, 0xf700, 0xf6fd, 0xf6fb, 0xf6f9, 0xf6f8, 0xf6f8, 0xf6f8,
+	0xf6f9, 0xf6fb, 0xf6fe, 0xf701, 0xf706, 0xf70b, 0xf711, 0xf717,
+	0xf71f, 0xf727, 0xf731, 0xf73b, 0xf746, 0xf752, 0xf75f, 0xf76d,
+	0xf77c, 0xf78c, 0xf79e, 0xf7b0, 0xf7c3, 0xf7d7, 0xf7ec, 0xf802,
+	0xf81a, 0xf832, 0xf84c, 0xf867, 0xf883, 0xf8a0, 0xf8be, 0xf8de,
+	0xf8fe, 0xf920, 0xf944, 0xf968, 0xf98e, 0xf9b5, 0xf9dd, 0xfa07,
+	0xfa32, 0xfa5e, 0xfa8c, 0xfabb, 0xfaeb, 0xfb1d, 0xfb50, 0xfb85,
+	0xfbbb, 0xfbf2, 0xfc2b, 0xfc65, 0xfca1, 0xfcdf, 0xfd1d, 0xfd5e,
+	0xfd9f, 0xfde3, 0xfe28, 0xfe6e, 0xfeb6, 0xfeff, 0xff4a, 0xff97,
+	0xffe5, 0x0035, 0x0086, 0x00d9, 0x012e, 0x0184, 0x01dc, 0x0235,
+	0x0290, 0x02ed, 0x034b, 0x03ab, 0x040c, 0x0470, 0x04d4, 0x053b,
+	0x05a3, 0x060d, 0x0678, 0x06e5, 0x0754, 0x07c4, 0x0837, 0x08aa,
+	0x0920, 0x0997, 0x0a0f, 0x0a8a, 0x0b06, 0x0b83, 0x0c03, 0x0c83,
+	0x0d06, 0x0d8a, 0x0e10, 0x0e97, 0x0f20, 0x0fab, 0x1037, 0x10c5,
+	0x1154, 0x11e5, 0x1278, 0x130c, 0x13a2, 0x1439, 0x14d2, 0x156c,
+	0x1607, 0x16a5, 0x1743, 0x17e4, 0x1885, 0x1928, 0x19cd, 0x1a73,
+	0x1b1a, 0x1bc3, 0x1c6d, 0x1d18, 0x1dc5, 0x1e73, 0x1f22, 0x1fd3,
+	0x2085, 0x2138, 0x21ed, 0x22a2, 0x2359, 0x2411, 0x24ca, 0x2584,
+	0x263f, 0x26fc, 0x27b9, 0x2878, 0x2937, 0x29f8, 0x2ab9, 0x2b7c,
+	0x2c3f, 0x2d03, 0x2dc8, 0x2e8e, 0x2f55, 0x301c, 0x30e4, 0x31ad,
+	0x3277, 0x3341, 0x340c, 0x34d8, 0x35a4, 0x3670, 0x373e, 0x380b,
+	0x38d9, 0x39a8, 0x3a77, 0x3b46, 0x3c16, 0x3ce6, 0x3db6, 0x3e87,
+	0x3f57, 0x4028, 0x40f9, 0x41ca, 0x429c, 0x436d, 0x443e, 0x450f,
+	0x45e0, 0x46b2, 0x4782, 0x4853, 0x4924, 0x49f4, 0x4ac4, 0x4b94,
+	0x4c63, 0x4d32, 0x4e01, 0x4ecf, 0x4f9c, 0x5069, 0x5136, 0x5202,
+	0x52cd, 0x5398, 0x5462, 0x552b, 0x55f3, 0x56bb, 0x5781, 0x5847,
+	0x590c, 0x59d0, 0x5a93, 0x5b55, 0x5c15, 0x5cd5, 0x5d94, 0x5e51,
+	0x5f0d, 0x5fc8, 0x6082, 0x613a, 0x61f1, 0x62a6, 0x635a, 0x640d,
+	0x64be, 0x656e, 0x661c, 0x66c8, 0x6773, 0x681c, 0x68c4, 0x6969,
+	0x6a0d, 0x6ab0, 0x6b50, 0x6bee, 0x6c8b, 0x6d26, 0x6dbe, 0x6e55,
+	0x6eea, 0x6f7c, 0x700d, 0x709b, 0x7128, 0x71b2, 0x723a, 0x72c0,
+	0x7343, 0x73c4, 0x7443, 0x74c0, 0x753a, 0x75b2, 0x7628, 0x769b,
+	0x770b, 0x777a, 0x77e5, 0x784e, 0x78b5, 0x7919, 0x797b, 0x79da,
+	0x7a36, 0x7a90, 0x7ae7, 0x7b3b, 0x7b8c, 0x7bdb, 0x7c28, 0x7c71,
+	0x7cb8, 0x7cfc, 0x7d3d, 0x7d7b, 0x7db7, 0x7def, 0x7e25, 0x7e58,
+	0x7e88, 0x7eb6, 0x7ee0, 0x7f08, 0x7f2c, 0x7f4e, 0x7f6d, 0x7f89,
+	0x7fa2, 0x7fb8, 0x7fcb, 0x7fdb, 0x7fe8, 0x7ff3, 0x7ffa, 0x7fff,
+	0x7fff, 0x7fff, 0x7ffa, 0x7ff3, 0x7fe8, 0x7fdb, 0x7fcb, 0x7fb8,
+	0x7fa2, 0x7f89, 0x7f6d, 0x7f4e, 0x7f2c, 0x7f08, 0x7ee0, 0x7eb6,
+	0x7e88, 0x7e58, 0x7e25, 0x7def, 0x7db7, 0x7d7b, 0x7d3d, 0x7cfc,
+	0x7cb8, 0x7c71, 0x7c28, 0x7bdb, 0x7b8c, 0x7b3b, 0x7ae7, 0x7a90,
+	0x7a36, 0x79da, 0x797b, 0x7919, 0x78b5, 0x784e, 0x77e5, 0x777a,
+	0x770b, 0x769b, 0x7628, 0x75b2, 0x753a, 0x74c0, 0x7443, 0x73c4,
+	0x7343, 0x72c0, 0x723a, 0x71b2, 0x7128, 0x709b, 0x700d, 0x6f7c,
+	0x6eea, 0x6e55, 0x6dbe, 0x6d26, 0x6c8b, 0x6bee, 0x6b50, 0x6ab0,
+	0x6a0d, 0x6969, 0x68c4, 0x681c, 0x6773, 0x66c8, 0x661c, 0x656e,
+	0x64be, 0x640d, 0x635a, 0x62a6, 0x61f1, 0x613a, 0x6082, 0x5fc8,
+	0x5f0d, 0x5e51, 0x5d94, 0x5cd5, 0x5c15, 0x5b55, 0x5a93, 0x59d0,
+	0x590c, 0x5847, 0x5781, 0x56bb, 0x55f3, 0x552b, 0x5462, 0x5398,
+	0x52cd, 0x5202, 0x5136, 0x5069, 0x4f9c, 0x4ecf, 0x4e01, 0x4d32,
+	0x4c63, 0x4b94, 0x4ac4, 0x49f4, 0x4924, 0x4853, 0x4782, 0x46b2,
+	0x45e0, 0x450f, 0x443e, 0x436d, 0x429c, 0x41ca, 0x40f9, 0x4028,
+	0x3f57, 0x3e87, 0x3db6, 0x3ce6, 0x3c16, 0x3b46, 0x3a77, 0x39a8,
+	0x38d9, 0x380b, 0x373e, 0x3670, 0x35a4, 0x34d8, 0x340c, 0x3341,
+	0x3277, 0x31ad, 0x30e4, 0x301c, 0x2f55, 0x2e8e, 0x2dc8, 0x2d03,
+	0x2c3f, 0x2b7c, 0x2ab9, 0x29f8, 0x2937, 0x2878, 0x27b9, 0x26fc,
+	0x263f, 0x2584, 0x24ca, 0x2411, 0x2359, 0x22a2, 0x21ed, 0x2138,
+	0x2085, 0x1fd3, 0x1f22, 0x1e73, 0x1dc5, 0x1d18, 0x1c6d, 0x1bc3,
+	0x1b1a, 0x1a73, 0x19cd, 0x1928, 0x1885, 0x17e4, 0x1743, 0x16a5,
+	0x1607, 0x156c, 0x14d2, 0x1439, 0x13a2, 0x130c, 0x1278, 0x11e5,
+	0x1154, 0x10c5, 0x1037, 0x0fab, 0x0f20, 0x0e97, 0x0e10, 0x0d8a,
+	0x0d06, 0x0c83, 0x0c03, 0x0b83, 0x0b06, 0x0a8a, 0x0a0f, 0x0997,
+	0x0920, 0x08aa, 0x0837, 0x07c4, 0x0754, 0x06e5, 0x0678, 0x060d,
+	0x05a3, 0x053b, 0x04d4, 0x0470, 0x040c, 0x03ab, 0x034b, 0x02ed,
+	0x0290, 0x0235, 0x01dc, 0x0184, 0x012e, 0x00d9, 0x0086, 0x0035,
+	0xffe5, 0xff97, 0xff4a, 0xfeff, 0xfeb6, 0xfe6e, 0xfe28, 0xfde3,
+	0xfd9f, 0xfd5e, 0xfd1d, 0xfcdf, 0xfca1, 0xfc65, 0xfc2b, 0xfbf2,
+	0xfbbb, 0xfb85, 0xfb50, 0xfb1d, 0xfaeb, 0xfabb, 0xfa8c, 0xfa5e,
+	0xfa32, 0xfa07, 0xf9dd, 0xf9b5, 0xf98e, 0xf968, 0xf944, 0xf920,
+	0xf8fe, 0xf8de, 0xf8be, 0xf8a0, 0xf883, 0xf867, 0xf84c, 0xf832,
+	0xf81a, 0xf802, 0xf7ec, 0xf7d7, 0xf7c3, 0xf7b0, 0xf79e, 0xf78c,
+	0xf77c, 0xf76d, 0xf75f, 0xf752, 0xf746, 0xf73b, 0xf731, 0xf727,
+	0xf71f, 0xf717, 0xf711, 0xf70b, 0xf706, 0xf701, 0xf6fe, 0xf6fb,
+	0xf6f9, 0xf6f8, 0xf6f8, 0xf6f8, 0xf6f9, 0xf6fb, 0xf6fd, 0xf700,
+	0xf704, 0xf708, 0xf70d, 0xf713, 0xf719, 0xf720, 0xf727, 0xf72f,
+	0xf737, 0xf740, 0xf749, 0xf753, 0xf75d, 0xf768, 0xf773, 0xf77f,
+	0xf78b, 0xf798, 0xf7a5, 0xf7b2, 0xf7c0, 0xf7ce, 0xf7dc, 0xf7eb,
+	0xf7fa, 0xf809, 0xf818, 0xf828, 0xf838, 0xf849, 0xf85a, 0xf86a,
+	0xf87c, 0xf88d, 0xf89e, 0xf8b0, 0xf8c2, 0xf8d4, 0xf8e6, 0xf8f9,
+	0xf90b, 0xf91e, 0xf931, 0xf944, 0xf957, 0xf96a, 0xf97d, 0xf990,
+	0xf9a4, 0xf9b7, 0xf9ca, 0xf9de, 0xf9f1, 0xfa05, 0xfa19, 0xfa2c,
+	0xfa40, 0xfa53, 0xfa67, 0xfa7a, 0xfa8e, 0xfaa1, 0xfab5, 0xfac8,
+	0xfadb, 0xfaef, 0xfb02, 0xfb15, 0xfb28, 0xfb3b, 0xfb4e, 0xfb61,
+	0xfb74, 0xfb86, 0xfb99, 0xfbab, 0xfbbe, 0xfbd0, 0xfbe2, 0xfbf4,
+	0xfc06, 0xfc18, 0xfc29, 0xfc3a, 0xfc4c, 0xfc5d, 0xfc6e, 0xfc7f,
+	0xfc8f, 0xfca0, 0xfcb0, 0xfcc1, 0xfcd1, 0xfce1, 0xfcf0, 0xfd00,
+	0xfd0f, 0xfd1e, 0xfd2d, 0xfd3c, 0xfd4b, 0xfd5a, 0xfd68, 0xfd76,
+	0xfd84, 0xfd92, 0xfd9f, 0xfdad, 0xfdba, 0xfdc7, 0xfdd4, 0xfde1,
+	0xfded, 0xfdfa, 0xfe06, 0xfe12, 0xfe1e, 0xfe29, 0xfe35, 0xfe40,
+	0xfe4b, 0xfe56, 0xfe60, 0xfe6b, 0xfe75, 0xfe7f, 0xfe89, 0xfe93,
+	0xfe9d, 0xfea6, 0xfeb0, 0xfeb9, 0xfec2, 0xfecb, 0xfed3, 0xfedc,
+	0xfee4, 0xfeec, 0xfef4, 0xfefc, 0xff03, 0xff0b, 0xff12, 0xff19,
+	0xff20, 0xff27, 0xff2e, 0xff35, 0xff3b, 0xff41, 0xff48, 0xff4e,
+	0xff53, 0xff59, 0xff5f, 0xff64, 0xff69, 0xff6f, 0xff74, 0xff79,
+	0xff7d, 0xff82, 0xff87, 0xff8b, 0xff8f, 0xff94, 0xff98, 0xff9c,
+	0xffa0, 0xffa3, 0xffa7, 0xffab, 0xffae, 0xffb1, 0xffb5, 0xffb8,
+	0xffbb, 0xffbe, 0xffc1, 0xffc3, 0xffc6, 0xffc9, 0xffcb, 0xffce,
+	0xffd0, 0xffd2, 0xffd4, 0xffd6, 0xffd8, 0xffda, 0xffdc, 0xffde,
+	0xffdf, 0xffe1, 0xffe2, 0xffe4, 0xffe5, 0xffe7, 0xffe8, 0xffe9,
+	0xffea, 0xffeb, 0xffec, 0xffed, 0xffee, 0xffee, 0xffef, 0xfff0,
+	0xfff0, 0xfff1, 0xfff1, 0xfff1, 0xfff2, 0xfff2, 0xfff2, 0xfff2,
+};
+
@@ -0,0 +1,22 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16flattop128[128] =
+{
+	0xfff2, 0xfff0, 0xffea, 0xffdf, 0xffd0, 0xffbb, 0xffa0, 0xff7d,
+	0xff53, 0xff20, 0xfee4, 0xfe9d, 0xfe4b, 0xfded, 0xfd84, 0xfd0f,
+	0xfc8f, 0xfc06, 0xfb74, 0xfadb, 0xfa40, 0xf9a4, 0xf90b, 0xf87c,
+	0xf7fa, 0xf78b, 0xf737, 0xf704, 0xf6f9, 0xf71f, 0xf77c, 0xf81a,
+	0xf8fe, 0xfa32, 0xfbbb, 0xfd9f, 0xffe5, 0x0290, 0x05a3, 0x0920,
+	0x0d06, 0x1154, 0x1607, 0x1b1a, 0x2085, 0x263f, 0x2c3f, 0x3277,
+	0x38d9, 0x3f57, 0x45e0, 0x4c63, 0x52cd, 0x590c, 0x5f0d, 0x64be,
+	0x6a0d, 0x6eea, 0x7343, 0x770b, 0x7a36, 0x7cb8, 0x7e88, 0x7fa2,
+	0x7fff, 0x7fa2, 0x7e88, 0x7cb8, 0x7a36, 0x770b, 0x7343, 0x6eea,
+	0x6a0d, 0x64be, 0x5f0d, 0x590c, 0x52cd, 0x4c63, 0x45e0, 0x3f57,
+	0x38d9, 0x3277, 0x2c3f, 0x263f, 0x2085, 0x1b1a, 0x1607, 0x1154,
+	0x0d06, 0x0920, 0x05a3, 0x0290, 0xffe5, 0xfd9f, 0xfbbb, 0xfa32,
+	0xf8fe, 0xf81a, 0xf77c, 0xf71f, 0xf6f9, 0xf704, 0xf737, 0xf78b,
+	0xf7fa, 0xf87c, 0xf90b, 0xf9a4, 0xfa40, 0xfadb, 0xfb74, 0xfc06,
+	0xfc8f, 0xfd0f, 0xfd84, 0xfded, 0xfe4b, 0xfe9d, 0xfee4, 0xff20,
+	0xff53, 0xff7d, 0xffa0, 0xffbb, 0xffd0, 0xffdf, 0xffea, 0xfff0,
+};
+
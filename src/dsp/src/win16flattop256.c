@@ -0,0 +1,38 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16flattop256[256] =
+{
+	0xfff2, 0xfff2, 0xfff0, 0xffee, 0xffea, 0xffe5, 0xffdf, 0xffd8,
+	0xffd0, 0xffc6, 0xffbb, 0xffae, 0xffa0, 0xff8f, 0xff7d, 0xff69,
+	0xff53, 0xff3b, 0xff20, 0xff03, 0xfee4, 0xfec2, 0xfe9d, 0xfe75,
+	0xfe4b, 0xfe1e, 0xfded, 0xfdba, 0xfd84, 0xfd4b, 0xfd0f, 0xfcd1,
+	0xfc8f, 0xfc4c, 0xfc06, 0xfbbe, 0xfb74, 0xfb28, 0xfadb, 0xfa8e,
+	0xfa40, 0xf9f1, 0xf9a4, 0xf957, 0xf90b, 0xf8c2, 0xf87c, 0xf838,
+	0xf7fa, 0xf7c0, 0xf78b, 0xf75d, 0xf737, 0xf719, 0xf704, 0xf6f9,
+	0xf6f9, 0xf706, 0xf71f, 0xf746, 0xf77c, 0xf7c3, 0xf81a, 0xf883,
+	0xf8fe, 0xf98e, 0xfa32, 0xfaeb, 0xfbbb, 0xfca1, 0xfd9f, 0xfeb6,
+	0xffe5, 0x012e, 0x0290, 0x040c, 0x05a3, 0x0754, 0x0920, 0x0b06,
+	0x0d06, 0x0f20, 0x1154, 0x13a2, 0x1607, 0x1885, 0x1b1a, 0x1dc5,
+	0x2085, 0x2359, 0x263f, 0x2937, 0x2c3f, 0x2f55, 0x3277, 0x35a4,
+	0x38d9, 0x3c16, 0x3f57, 0x429c, 0x45e0, 0x4924, 0x4c63, 0x4f9c,
+	0x52cd, 0x55f3, 0x590c, 0x5c15, 0x5f0d, 0x61f1, 0x64be, 0x6773,
+	0x6a0d, 0x6c8b, 0x6eea, 0x7128, 0x7343, 0x753a, 0x770b, 0x78b5,
+	0x7a36, 0x7b8c, 0x7cb8, 0x7db7, 0x7e88, 0x7f2c, 0x7fa2, 0x7fe8,
+	0x7fff, 0x7fe8, 0x7fa2, 0x7f2c, 0x7e88, 0x7db7, 0x7cb8, 0x7b8c,
+	0x7a36, 0x78b5, 0x770b, 0x753a, 0x7343, 0x7128, 0x6eea, 0x6c8b,
+	0x6a0d, 0x6773, 0x64be, 0x61f1, 0x5f0d, 0x5c15, 0x590c, 0x55f3,
+	0x52cd, 0x4f9c, 0x4c63, 0x4924, 0x45e0, 0x429c, 0x3f57, 0x3c16,
+	0x38d9, 0x35a4, 0x3277, 0x2f55, 0x2c3f, 0x2937, 0x263f, 0x2359,
+	0x2085, 0x1dc5, 0x1b1a, 0x1885, 0x1607, 0x13a2, 0x1154, 0x0f20,
+	0x0d06, 0x0b06, 0x0920, 0x0754, 0x05a3, 0x040c, 0x0290, 0x012e,
+	0xffe5, 0xfeb6, 0xfd9f, 0xfca1, 0xfbbb, 0xfaeb, 0xfa32, 0xf98e,
+	0xf8fe, 0xf883, 0xf81a, 0xf7c3, 0xf77c, 0xf746, 0xf71f, 0xf706,
+	0xf6f9, 0xf6f9, 0xf704, 0xf719, 0xf737, 0xf75d, 0xf78b, 0xf7c0,
+	0xf7fa, 0xf838, 0xf87c, 0xf8c2, 0xf90b, 0xf957, 0xf9a4, 0xf9f1,
+	0xfa40, 0xfa8e, 0xfadb, 0xfb28, 0xfb74, 0xfbbe, 0xfc06, 0xfc4c,
+	0xfc8f, 0xfcd1, 0xfd0f, 0xfd4b, 0xfd84, 0xfdba, 0xfded, 0xfe1e,
+	0xfe4b, 0xfe75, 0xfe9d, 0xfec2, 0xfee4, 0xff03, 0xff20, 0xff3b,
+	0xff53, 0xff69, 0xff7d, 0xff8f, 0xffa0, 0xffae, 0xffbb, 0xffc6,
+	0xffd0, 0xffd8, 0xffdf, 0xffe5, 0xffea, 0xffee, 0xfff0, 0xfff2,
+};
+
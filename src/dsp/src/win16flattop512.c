@@ -0,0 +1,70 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16flattop512[512] =
+{
+	0xfff2, 0xfff2, 0xfff2, 0xfff1, 0xfff0, 0xffef, 0xffee, 0xffec,
+	0xffea, 0xffe8, 0xffe5, 0xffe2, 0xffdf, 0xffdc, 0xffd8, 0xffd4,
+	0xffd0, 0xffcb, 0xffc6, 0xffc1, 0xffbb, 0xffb5, 0xffae, 0xffa7,
+	0xffa0, 0xff98, 0xff8f, 0xff87, 0xff7d, 0xff74, 0xff69, 0xff5f,
+	0xff53, 0xff48, 0xff3b, 0xff2e, 0xff20, 0xff12, 0xff03, 0xfef4,
+	0xfee4, 0xfed3, 0xfec2, 0xfeb0, 0xfe9d, 0xfe89, 0xfe75, 0xfe60,
+	0xfe4b, 0xfe35, 0xfe1e, 0xfe06, 0xfded, 0xfdd4, 0xfdba, 0xfd9f,
+	0xfd84, 0xfd68, 0xfd4b, 0xfd2d, 0xfd0f, 0xfcf0, 0xfcd1, 0xfcb0,
+	0xfc8f, 0xfc6e, 0xfc4c, 0xfc29, 0xfc06, 0xfbe2, 0xfbbe, 0xfb99,
+	0xfb74, 0xfb4e, 0xfb28, 0xfb02, 0xfadb, 0xfab5, 0xfa8e, 0xfa67,
+	0xfa40, 0xfa19, 0xf9f1, 0xf9ca, 0xf9a4, 0xf97d, 0xf957, 0xf931,
+	0xf90b, 0xf8e6, 0xf8c2, 0xf89e, 0xf87c, 0xf85a, 0xf838, 0xf818,
+	0xf7fa, 0xf7dc, 0xf7c0, 0xf7a5, 0xf78b, 0xf773, 0xf75d, 0xf749,
+	0xf737, 0xf727, 0xf719, 0xf70d, 0xf704, 0xf6fd, 0xf6f9, 0xf6f8,
+	0xf6f9, 0xf6fe, 0xf706, 0xf711, 0xf71f, 0xf731, 0xf746, 0xf75f,
+	0xf77c, 0xf79e, 0xf7c3, 0xf7ec, 0xf81a, 0xf84c, 0xf883, 0xf8be,
+	0xf8fe, 0xf944, 0xf98e, 0xf9dd, 0xfa32, 0xfa8c, 0xfaeb, 0xfb50,
+	0xfbbb, 0xfc2b, 0xfca1, 0xfd1d, 0xfd9f, 0xfe28, 0xfeb6, 0xff4a,
+	0xffe5, 0x0086, 0x012e, 0x01dc, 0x0290, 0x034b, 0x040c, 0x04d4,
+	0x05a3, 0x0678, 0x0754, 0x0837, 0x0920, 0x0a0f, 0x0b06, 0x0c03,
+	0x0d06, 0x0e10, 0x0f20, 0x1037, 0x1154, 0x1278, 0x13a2, 0x14d2,
+	0x1607, 0x1743, 0x1885, 0x19cd, 0x1b1a, 0x1c6d, 0x1dc5, 0x1f22,
+	0x2085, 0x21ed, 0x2359, 0x24ca, 0x263f, 0x27b9, 0x2937, 0x2ab9,
+	0x2c3f, 0x2dc8, 0x2f55, 0x30e4, 0x3277, 0x340c, 0x35a4, 0x373e,
+	0x38d9, 0x3a77, 0x3c16, 0x3db6, 0x3f57, 0x40f9, 0x429c, 0x443e,
+	0x45e0, 0x4782, 0x4924, 0x4ac4, 0x4c63, 0x4e01, 0x4f9c, 0x5136,
+	0x52cd, 0x5462, 0x55f3, 0x5781, 0x590c, 0x5a93, 0x5c15, 0x5d94,
+	0x5f0d, 0x6082, 0x61f1, 0x635a, 0x64be, 0x661c, 0x6773, 0x68c4,
+	0x6a0d, 0x6b50, 0x6c8b, 0x6dbe, 0x6eea, 0x700d, 0x7128, 0x723a,
+	0x7343, 0x7443, 0x753a, 0x7628, 0x770b, 0x77e5, 0x78b5, 0x797b,
+	0x7a36, 0x7ae7, 0x7b8c, 0x7c28, 0x7cb8, 0x7d3d, 0x7db7, 0x7e25,
+	0x7e88, 0x7ee0, 0x7f2c, 0x7f6d, 0x7fa2, 0x7fcb, 0x7fe8, 0x7ffa,
+	0x7fff, 0x7ffa, 0x7fe8, 0x7fcb, 0x7fa2, 0x7f6d, 0x7f2c, 0x7ee0,
+	0x7e88, 0x7e25, 0x7db7, 0x7d3d, 0x7cb8, 0x7c28, 0x7b8c, 0x7ae7,
+	0x7a36, 0x797b, 0x78b5, 0x77e5, 0x770b, 0x7628, 0x753a, 0x7443,
+	0x7343, 0x723a, 0x7128, 0x700d, 0x6eea, 0x6dbe, 0x6c8b, 0x6b50,
+	0x6a0d, 0x68c4, 0x6773, 0x661c, 0x64be, 0x635a, 0x61f1, 0x6082,
+	0x5f0d, 0x5d94, 0x5c15, 0x5a93, 0x590c, 0x5781, 0x55f3, 0x5462,
+	0x52cd, 0x5136, 0x4f9c, 0x4e01, 0x4c63, 0x4ac4, 0x4924, 0x4782,
+	0x45e0, 0x443e, 0x429c, 0x40f9, 0x3f57, 0x3db6, 0x3c16, 0x3a77,
+	0x38d9, 0x373e, 0x35a4, 0x340c, 0x3277, 0x30e4, 0x2f55, 0x2dc8,
+	0x2c3f, 0x2ab9, 0x2937, 0x27b9, 0x263f, 0x24ca, 0x2359, 0x21ed,
+	0x2085, 0x1f22, 0x1dc5, 0x1c6d, 0x1b1a, 0x19cd, 0x1885, 0x1743,
+	0x1607, 0x14d2, 0x13a2, 0x1278, 0x1154, 0x1037, 0x0f20, 0x0e10,
+	0x0d06, 0x0c03, 0x0b06, 0x0a0f, 0x0920, 0x0837, 0x0754, 0x0678,
+	0x05a3, 0x04d4, 0x040c, 0x034b, 0x0290, 0x01dc, 0x012e, 0x0086,
+	0xffe5, 0xff4a, 0xfeb6, 0xfe28, 0xfd9f, 0xfd1d, 0xfca1, 0xfc2b,
+	0xfbbb, 0xfb50, 0xfaeb, 0xfa8c, 0xfa32, 0xf9dd, 0xf98e, 0xf944,
+	0xf8fe, 0xf8be, 0xf883, 0xf84c, 0xf81a, 0xf7ec, 0xf7c3, 0xf79e,
+	0xf77c, 0xf75f, 0xf746, 0xf731, 0xf71f, 0xf711, 0xf706, 0xf6fe,
+	0xf6f9, 0xf6f8, 0xf6f9, 0xf6fd, 0xf704, 0xf70d, 0xf719, 0xf727,
+	0xf737, 0xf749, 0xf75d, 0xf773, 0xf78b, 0xf7a5, 0xf7c0, 0xf7dc,
+	0xf7fa, 0xf818, 0xf838, 0xf85a, 0xf87c, 0xf89e, 0xf8c2, 0xf8e6,
+	0xf90b, 0xf931, 0xf957, 0xf97d, 0xf9a4, 0xf9ca, 0xf9f1, 0xfa19,
+	0xfa40, 0xfa67, 0xfa8e, 0xfab5, 0xfadb, 0xfb02, 0xfb28, 0xfb4e,
+	0xfb74, 0xfb99, 0xfbbe, 0xfbe2, 0xfc06, 0xfc29, 0xfc4c, 0xfc6e,
+	0xfc8f, 0xfcb0, 0xfcd1, 0xfcf0, 0xfd0f, 0xfd2d, 0xfd4b, 0xfd68,
+	0xfd84, 0xfd9f, 0xfdba, 0xfdd4, 0xfded, 0xfe06, 0xfe1e, 0xfe35,
+	0xfe4b, 0xfe60, 0xfe75, 0xfe89, 0xfe9d, 0xfeb0, 0xfec2, 0xfed3,
+	0xfee4, 0xfef4, 0xff03, 0xff12, 0xff20, 0xff2e, 0xff3b, 0xff48,
+	0xff53, 0xff5f, 0xff69, 0xff74, 0xff7d, 0xff87, 0xff8f, 0xff98,
+	0xffa0, 0xffa7, 0xffae, 0xffb5, 0xffbb, 0xffc1, 0xffc6, 0xffcb,
+	0xffd0, 0xffd4, 0xffd8, 0xffdc, 0xffdf, 0xffe2, 0xffe5, 0xffe8,
+	0xffea, 0xffec, 0xffee, 0xffef, 0xfff0, 0xfff1, 0xfff2, 0xfff2,
+};
+
@@ -0,0 +1,14 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16flattop64[64] =
+{
+	0xfff2, 0xffea, 0xffd0, 0xffa0, 0xff53, 0xfee4, 0xfe4b, 0xfd84,
+	0xfc8f, 0xfb74, 0xfa40, 0xf90b, 0xf7fa, 0xf737, 0xf6f9, 0xf77c,
+	0xf8fe, 0xfbbb, 0xffe5, 0x05a3, 0x0d06, 0x1607, 0x2085, 0x2c3f,
+	0x38d9, 0x45e0, 0x52cd, 0x5f0d, 0x6a0d, 0x7343, 0x7a36, 0x7e88,
+	0x7fff, 0x7e88, 0x7a36, 0x7343, 0x6a0d, 0x5f0d, 0x52cd, 0x45e0,
+	0x38d9, 0x2c3f, 0x2085, 0x1607, 0x0d06, 0x05a3, 0xffe5, 0xfbbb,
+	0xf8fe, 0xf77c, 0xf6f9, 0xf737, 0xf7fa, 0xf90b, 0xfa40, 0xfb74,
+	0xfc8f, 0xfd84, 0xfe4b, 0xfee4, 0xff53, 0xffa0, 0xffd0, 0xffea,
+};
+
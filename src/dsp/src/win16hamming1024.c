@@ -0,0 +1,134 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16hamming1024[1024] =
+{
+	0x0a3d, 0x0a3e, 0x0a3f, 0x0a40, 0x0a42, 0x0a45, 0x0a48, 0x0a4b,
+	0x0a50, 0x0a54, 0x0a5a, 0x0a60, 0x0a66, 0x0a6d, 0x0a75, 0x0a7d,
+	0x0a86, 0x0a8f, 0x0a99, 0x0aa4, 0x0aaf, 0x0aba, 0x0ac7, 0x0ad3,
+	0x0ae1, 0x0aee, 0x0afd, 0x0b0c, 0x0b1b, 0x0b2b, 0x0b3c, 0x0b4d,
+	0x0b5f, 0x0b71, 0x0b84, 0x0b98, 0x0bac, 0x0bc0, 0x0bd5, 0x0beb,
+	0x0c01, 0x0c18, 0x0c2f, 0x0c47, 0x0c5f, 0x0c78, 0x0c92, 0x0cac,
+	0x0cc6, 0x0ce2, 0x0cfd, 0x0d19, 0x0d36, 0x0d53, 0x0d71, 0x0d90,
+	0x0daf, 0x0dce, 0x0dee, 0x0e0e, 0x0e2f, 0x0e51, 0x0e73, 0x0e96,
+	0x0eb9, 0x0edc, 0x0f01, 0x0f25, 0x0f4b, 0x0f70, 0x0f97, 0x0fbd,
+	0x0fe5, 0x100c, 0x1035, 0x105e, 0x1087, 0x10b1, 0x10db, 0x1106,
+	0x1131, 0x115d, 0x1189, 0x11b6, 0x11e4, 0x1211, 0x1240, 0x126f,
+	0x129e, 0x12ce, 0x12fe, 0x132f, 0x1360, 0x1392, 0x13c4, 0x13f7,
+	0x142a, 0x145d, 0x1491, 0x14c6, 0x14fb, 0x1531, 0x1566, 0x159d,
+	0x15d4, 0x160b, 0x1643, 0x167b, 0x16b4, 0x16ed, 0x1726, 0x1760,
+	0x179b, 0x17d6, 0x1811, 0x184d, 0x1889, 0x18c6, 0x1903, 0x1940,
+	0x197e, 0x19bc, 0x19fb, 0x1a3a, 0x1a7a, 0x1aba, 0x1afa, 0x1b3b,
+	0x1b7c, 0x1bbe, 0x1c00, 0x1c42, 0x1c85, 0x1cc8, 0x1d0c, 0x1d50,
+	0x1d94, 0x1dd9, 0x1e1e, 0x1e63, 0x1ea9, 0x1eef, 0x1f36, 0x1f7d,
+	0x1fc4, 0x200c, 0x2054, 0x209c, 0x20e5, 0x212e, 0x2178, 0x21c1,
+	0x220c, 0x2256, 0x22a1, 0x22ec, 0x2337, 0x2383, 0x23cf, 0x241c,
+	0x2468, 0x24b6, 0x2503, 0x2551, 0x259f, 0x25ed, 0x263b, 0x268a,
+	0x26da, 0x2729, 0x2779, 0x27c9, 0x2819, 0x286a, 0x28bb, 0x290c,
+	0x295d, 0x29af, 0x2a01, 0x2a53, 0x2aa6, 0x2af8, 0x2b4b, 0x2b9f,
+	0x2bf2, 0x2c46, 0x2c9a, 0x2cee, 0x2d42, 0x2d97, 0x2dec, 0x2e41,
+	0x2e96, 0x2eec, 0x2f42, 0x2f98, 0x2fee, 0x3044, 0x309b, 0x30f2,
+	0x3149, 0x31a0, 0x31f7, 0x324f, 0x32a7, 0x32fe, 0x3356, 0x33af,
+	0x3407, 0x3460, 0x34b9, 0x3511, 0x356a, 0x35c4, 0x361d, 0x3677,
+	0x36d0, 0x372a, 0x3784, 0x37de, 0x3838, 0x3892, 0x38ed, 0x3947,
+	0x39a2, 0x39fd, 0x3a58, 0x3ab3, 0x3b0e, 0x3b69, 0x3bc4, 0x3c20,
+	0x3c7b, 0x3cd7, 0x3d32, 0x3d8e, 0x3dea, 0x3e45, 0x3ea1, 0x3efd,
+	0x3f59, 0x3fb5, 0x4011, 0x406e, 0x40ca, 0x4126, 0x4182, 0x41df,
+	0x423b, 0x4297, 0x42f4, 0x4350, 0x43ad, 0x4409, 0x4466, 0x44c2,
+	0x451f, 0x457b, 0x45d8, 0x4634, 0x4691, 0x46ed, 0x474a, 0x47a6,
+	0x4802, 0x485f, 0x48bb, 0x4917, 0x4974, 0x49d0, 0x4a2c, 0x4a88,
+	0x4ae4, 0x4b40, 0x4b9c, 0x4bf8, 0x4c54, 0x4cb0, 0x4d0b, 0x4d67,
+	0x4dc2, 0x4e1e, 0x4e79, 0x4ed5, 0x4f30, 0x4f8b, 0x4fe6, 0x5041,
+	0x509b, 0x50f6, 0x5151, 0x51ab, 0x5205, 0x525f, 0x52ba, 0x5313,
+	0x536d, 0x53c7, 0x5420, 0x547a, 0x54d3, 0x552c, 0x5585, 0x55de,
+	0x5636, 0x568f, 0x56e7, 0x573f, 0x5797, 0x57ef, 0x5846, 0x589e,
+	0x58f5, 0x594c, 0x59a3, 0x59f9, 0x5a50, 0x5aa6, 0x5afc, 0x5b51,
+	0x5ba7, 0x5bfc, 0x5c51, 0x5ca6, 0x5cfb, 0x5d4f, 0x5da4, 0x5df8,
+	0x5e4b, 0x5e9f, 0x5ef2, 0x5f45, 0x5f98, 0x5fea, 0x603d, 0x608f,
+	0x60e0, 0x6132, 0x6183, 0x61d4, 0x6224, 0x6275, 0x62c5, 0x6314,
+	0x6364, 0x63b3, 0x6402, 0x6451, 0x649f, 0x64ed, 0x653b, 0x6588,
+	0x65d5, 0x6622, 0x666e, 0x66ba, 0x6706, 0x6751, 0x679d, 0x67e7,
+	0x6832, 0x687c, 0x68c6, 0x690f, 0x6958, 0x69a1, 0x69e9, 0x6a31,
+	0x6a79, 0x6ac0, 0x6b07, 0x6b4e, 0x6b94, 0x6bda, 0x6c1f, 0x6c65,
+	0x6ca9, 0x6cee, 0x6d32, 0x6d75, 0x6db8, 0x6dfb, 0x6e3e, 0x6e80,
+	0x6ec1, 0x6f02, 0x6f43, 0x6f84, 0x6fc3, 0x7003, 0x7042, 0x7081,
+	0x70bf, 0x70fd, 0x713b, 0x7178, 0x71b4, 0x71f1, 0x722c, 0x7268,
+	0x72a3, 0x72dd, 0x7317, 0x7351, 0x738a, 0x73c2, 0x73fb, 0x7432,
+	0x746a, 0x74a1, 0x74d7, 0x750d, 0x7542, 0x7577, 0x75ac, 0x75e0,
+	0x7614, 0x7647, 0x767a, 0x76ac, 0x76dd, 0x770f, 0x773f, 0x7770,
+	0x77a0, 0x77cf, 0x77fe, 0x782c, 0x785a, 0x7887, 0x78b4, 0x78e0,
+	0x790c, 0x7938, 0x7962, 0x798d, 0x79b7, 0x79e0, 0x7a09, 0x7a31,
+	0x7a59, 0x7a80, 0x7aa7, 0x7acd, 0x7af3, 0x7b18, 0x7b3d, 0x7b61,
+	0x7b85, 0x7ba8, 0x7bca, 0x7bec, 0x7c0e, 0x7c2f, 0x7c4f, 0x7c6f,
+	0x7c8f, 0x7cae, 0x7ccc, 0x7cea, 0x7d07, 0x7d24, 0x7d40, 0x7d5c,
+	0x7d77, 0x7d92, 0x7dac, 0x7dc5, 0x7dde, 0x7df6, 0x7e0e, 0x7e26,
+	0x7e3c, 0x7e52, 0x7e68, 0x7e7d, 0x7e92, 0x7ea6, 0x7eb9, 0x7ecc,
+	0x7ede, 0x7ef0, 0x7f01, 0x7f12, 0x7f22, 0x7f32, 0x7f41, 0x7f4f,
+	0x7f5d, 0x7f6a, 0x7f77, 0x7f83, 0x7f8f, 0x7f9a, 0x7fa4, 0x7fae,
+	0x7fb7, 0x7fc0, 0x7fc8, 0x7fd0, 0x7fd7, 0x7fde, 0x7fe4, 0x7fe9,
+	0x7fee, 0x7ff2, 0x7ff6, 0x7ff9, 0x7ffb, 0x7ffd, 0x7fff, 0x7fff,
+	0x7fff, 0x7fff, 0x7fff, 0x7ffd, 0x7ffb, 0x7ff9, 0x7ff6, 0x7ff2,
+	0x7fee, 0x7fe9, 0x7fe4, 0x7fde, 0x7fd7, 0x7fd0, 0x7fc8, 0x7fc0,
+	0x7fb7, 0x7fae, 0x7fa4, 0x7f9a, 0x7f8f, 0x7f83, 0x7f77, 0x7f6a,
+	0x7f5d, 0x7f4f, 0x7f41, 0x7f32, 0x7f22, 0x7f12, 0x7f01, 0x7ef0,
+	0x7ede, 0x7ecc, 0x7eb9, 0x7ea6, 0x7e92, 0x7e7d, 0x7e68, 0x7e52,
+	0x7e3c, 0x7e26, 0x7e0e, 0x7df6, 0x7dde, 0x7dc5, 0x7dac, 0x7d92,
+	0x7d77, 0x7d5c, 0x7d40, 0x7d24, 0x7d07, 0x7cea, 0x7ccc, 0x7cae,
+	0x7c8f, 0x7c6f, 0x7c4f, 0x7c2f, 0x7c0e, 0x7bec, 0x7bca, 0x7ba8,
+	0x7b85, 0x7b61, 0x7b3d, 0x7b18, 0x7af3, 0x7acd, 0x7aa7, 0x7a80,
+	0x7a59, 0x7a31, 0x7a09, 0x79e0, 0x79b7, 0x798d, 0x7962, 0x7938,
+	0x790c, 0x78e0, 0x78b4, 0x7887, 0x785a, 0x782c, 0x77fe, 0x77cf,
+	0x77a0, 0x7770, 0x773f, 0x770f, 0x76dd, 0x76ac, 0x767a, 0x7647,
+	0x7614, 0x75e0, 0x75ac, 0x7577, 0x7542, 0x750d, 0x74d7, 0x74a1,
+	0x746a, 0x7432, 0x73fb, 0x73c2, 0x738a, 0x7351, 0x7317, 0x72dd,
+	0x72a3, 0x7268, 0x722c, 0x71f1, 0x71b4, 0x7178, 0x713b, 0x70fd,
+	0x70bf, 0x7081, 0x7042, 0x7003, 0x6fc3, 0x6f84, 0x6f43, 0x6f02,
+	0x6ec1, 0x6e80, 0x6e3e, 0x6dfb, 0x6db8, 0x6d75, 0x6d32, 0x6cee,
+	0x6ca9, 0x6c65, 0x6c1f, 0x6bda, 0x6b94, 0x6b4e, 0x6b07, 0x6ac0,
+	0x6a79, 0x6a31, 0x69e9, 0x69a1, 0x6958, 0x690f, 0x68c6, 0x687c,
+	0x6832, 0x67e7, 0x679d, 0x6751, 0x6706, 0x66ba, 0x666e, 0x6622,
+	0x65d5, 0x6588, 0x653b, 0x64ed, 0x649f, 0x6451, 0x6402, 0x63b3,
+	0x6364, 0x6314, 0x62c5, 0x6275, 0x6224, 0x61d4, 0x6183, 0x6132,
+	0x60e0, 0x608f, 0x603d, 0x5fea, 0x5f98, 0x5f45, 0x5ef2, 0x5e9f,
+	0x5e4b, 0x5df8, 0x5da4, 0x5d4f, 0x5cfb, 0x5ca6, 0x5c51, 0x5bfc,
+	0x5ba7, 0x5b51, 0x5afc, 0x5aa6, 0x5a50, 0x59f9, 0x59a3, 0x594c,
+	0x58f5, 0x589e, 0x5846, 0x57ef, 0x5797, 0x573f, 0x56e7, 0x568f,
+	0x5636, 0x55de, 0x5585, 0x552c, 0x54d3, 0x547a, 0x5420, 0x53c7,
+	0x536d, 0x5313, 0x52ba, 0x525f, 0x5205, 0x51ab, 0x5151, 0x50f6,
+	0x509b, 0x5041, 0x4fe6, 0x4f8b, 0x4f30, 0x4ed5, 0x4e79, 0x4e1e,
+	0x4dc2, 0x4d67, 0x4d0b, 0x4cb0, 0x4c54, 0x4bf8, 0x4b9c, 0x4b40,
+	0x4ae4, 0x4a88, 0x4a2c, 0x49d0, 0x4974, 0x4917, 0x48bb, 0x485f,
+	0x4802, 0x47a6, 0x474a, 0x46ed, 0x4691, 0x4634, 0x45d8, 0x457b,
+	0x451f, 0x44c2, 0x4466, 0x4409, 0x43ad, 0x4350, 0x42f4, 0x4297,
+	0x423b, 0x41df, 0x4182, 0x4126, 0x40ca, 0x406e, 0x4011, 0x3fb5,
+	0x3f59, 0x3efd, 0x3ea1, 0x3e45, 0x3dea, 0x3d8e, 0x3d32, 0x3cd7,
+	0x3c7b, 0x3c20, 0x3bc4, 0x3b69, 0x3b0e, 0x3ab3, 0x3a58, 0x39fd,
+	0x39a2, 0x3947, 0x38ed, 0x3892, 0x3838, 0x37de, 0x3784, 0x372a,
+	0x36d0, 0x3677, 0x361d, 0x35c4, 0x356a, 0x3511, 0x34b9, 0x3460,
+	0x3407, 0x33af, 0x3356, 0x32fe, 0x32a7, 0x324f, 0x31f7, 0x31a0,
+	0x3149, 0x30f2, 0x309b, 0x3044, 0x2fee, 0x2f98, 0x2f42, 0x2eec,
+	0x2e96, 0x2e41, 0x2dec, 0x2d97, 0x2d42, 0x2cee, 0x2c9a, 0x2c46,
+	0x2bf2, 0x2b9f, 0x2b4b, 0x2af8, 0x2aa6, 0x2a53, 0x2a01, 0x29af,
+	0x295d, 0x290c, 0x28bb, 0x286a, 0x2819, 0x27c9, 0x2779, 0x2729,
+	0x26da, 0x268a, 0x263b, 0x25ed, 0x259f, 0x2551, 0x2503, 0x24b6,
+	0x2468, 0x241c, 0x23cf, 0x2383, 0x2337, 0x22ec, 0x22a1, 0x2256,
+	0x220c, 0x21c1, 0x2178, 0x212e, 0x20e5, 0x209c, 0x2054, 0x200c,
+	0x1fc4, 0x1f7d, 0x1f36, 0x1eef, 0x1ea9, 0x1e63, 0x1e1e, 0x1dd9,
+	0x1d94, 0x1d50, 0x1d0c, 0x1cc8, 0x1c85, 0x1c42, 0x1c00, 0x1bbe,
+	0x1b7c, 0x1b3b, 0x1afa, 0x1aba, 0x1a7a, 0x1a3a, 0x19fb, 0x19bc,
+	0x197e, 0x1940, 0x1903, 0x18c6, 0x1889, 0x184d, 0x1811, 0x17d6,
+	0x179b, 0x1760, 0x1726, 0x16ed, 0x16b4, 0x167b, 0x1643, 0x160b,
+	0x15d4, 0x159d, 0x1566, 0x1531, 0x14fb, 0x14c6, 0x1491, 0x145d,
+	0x142a, 0x13f7, 0x13c4, 0x1392, 0x1360, 0x132f, 0x12fe, 0x12ce,
+	0x129e, 0x126f, 0x1240, 0x1211, 0x11e4, 0x11b6, 0x1189, 0x115d,
+	0x1131, 0x1106, 0x10db, 0x10b1, 0x1087, 0x105e, 0x1035, 0x100c,
+	0x0fe5, 0x0fbd, 0x0f97, 0x0f70, 0x0f4b, 0x0f25, 0x0f01, 0x0edc,
+	0x0eb9, 0x0e96, 0x0e73, 0x0e51, 0x0e2f, 0x0e0e, 0x0dee, 0x0dce,
+	0x0daf, 0x0d90, 0x0d71, 0x0d53, 0x0d36, 0x0d19, 0x0cfd, 0x0ce2,
+	0x0cc6, 0x0cac, 0x0c92, 0x0c78, 0x0c5f, 0x0c47, 0x0c2f, 0x0c18,
+	0x0c01, 0x0beb, 0x0bd5, 0x0bc0, 0x0bac, 0x0b98, 0x0b84, 0x0b71,
+	0x0b5f, 0x0b4d, 0x0b3c, 0x0b2b, 0x0b1b, 0x0b0c, 0x0afd, 0x0aee,
+	0x0ae1, 0x0ad3, 0x0ac7, 0x0aba, 0x0aaf, 0x0aa4, 0x0a99, 0x0a8f,
+	0x0a86, 0x0a7d, 0x0a75, 0x0a6d, 0x0a66, 0x0a60, 0x0a5a, 0x0a54,
+	0x0a50, 0x0a4b, 0x0a48, 0x0a45, 0x0a42, 0x0a40, 0x0a3f, 0x0a3e,
+};
+
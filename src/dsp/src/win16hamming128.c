@@ -0,0 +1,22 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16hamming128[128] =
+{
+	0x0a3d, 0x0a50, 0x0a86, 0x0ae1, 0x0b5f, 0x0c01, 0x0cc6, 0x0daf,
+	0x0eb9, 0x0fe5, 0x1131, 0x129e, 0x142a, 0x15d4, 0x179b, 0x197e,
+	0x1b7c, 0x1d94, 0x1fc4, 0x220c, 0x2468, 0x26da, 0x295d, 0x2bf2,
+	0x2e96, 0x3149, 0x3407, 0x36d0, 0x39a2, 0x3c7b, 0x3f59, 0x423b,
+	0x451f, 0x4802, 0x4ae4, 0x4dc2, 0x509b, 0x536d, 0x5636, 0x58f5,
+	0x5ba7, 0x5e4b, 0x60e0, 0x6364, 0x65d5, 0x6832, 0x6a79, 0x6ca9,
+	0x6ec1, 0x70bf, 0x72a3, 0x746a, 0x7614, 0x77a0, 0x790c, 0x7a59,
+	0x7b85, 0x7c8f, 0x7d77, 0x7e3c, 0x7ede, 0x7f5d, 0x7fb7, 0x7fee,
+	0x7fff, 0x7fee, 0x7fb7, 0x7f5d, 0x7ede, 0x7e3c, 0x7d77, 0x7c8f,
+	0x7b85, 0x7a59, 0x790c, 0x77a0, 0x7614, 0x746a, 0x72a3, 0x70bf,
+	0x6ec1, 0x6ca9, 0x6a79, 0x6832, 0x65d5, 0x6364, 0x60e0, 0x5e4b,
+	0x5ba7, 0x58f5, 0x5636, 0x536d, 0x509b, 0x4dc2, 0x4ae4, 0x4802,
+	0x451f, 0x423b, 0x3f59, 0x3c7b, 0x39a2, 0x36d0, 0x3407, 0x3149,
+	0x2e96, 0x2bf2, 0x295d, 0x26da, 0x2468, 0x220c, 0x1fc4, 0x1d94,
+	0x1b7c, 0x197e, 0x179b, 0x15d4, 0x142a, 0x129e, 0x1131, 0x0fe5,
+	0x0eb9, 0x0daf, 0x0cc6, 0x0c01, 0x0b5f, 0x0ae1, 0x0a86, 0x0a50,
+};
+
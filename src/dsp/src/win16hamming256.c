@@ -0,0 +1,38 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16hamming256[256] =
+{
+	0x0a3d, 0x0a42, 0x0a50, 0x0a66, 0x0a86, 0x0aaf, 0x0ae1, 0x0b1b,
+	0x0b5f, 0x0bac, 0x0c01, 0x0c5f, 0x0cc6, 0x0d36, 0x0daf, 0x0e2f,
+	0x0eb9, 0x0f4b, 0x0fe5, 0x1087, 0x1131, 0x11e4, 0x129e, 0x1360,
+	0x142a, 0x14fb, 0x15d4, 0x16b4, 0x179b, 0x1889, 0x197e, 0x1a7a,
+	0x1b7c, 0x1c85, 0x1d94, 0x1ea9, 0x1fc4, 0x20e5, 0x220c, 0x2337,
+	0x2468, 0x259f, 0x26da, 0x2819, 0x295d, 0x2aa6, 0x2bf2, 0x2d42,
+	0x2e96, 0x2fee, 0x3149, 0x32a7, 0x3407, 0x356a, 0x36d0, 0x3838,
+	0x39a2, 0x3b0e, 0x3c7b, 0x3dea, 0x3f59, 0x40ca, 0x423b, 0x43ad,
+	0x451f, 0x4691, 0x4802, 0x4974, 0x4ae4, 0x4c54, 0x4dc2, 0x4f30,
+	0x509b, 0x5205, 0x536d, 0x54d3, 0x5636, 0x5797, 0x58f5, 0x5a50,
+	0x5ba7, 0x5cfb, 0x5e4b, 0x5f98, 0x60e0, 0x6224, 0x6364, 0x649f,
+	0x65d5, 0x6706, 0x6832, 0x6958, 0x6a79, 0x6b94, 0x6ca9, 0x6db8,
+	0x6ec1, 0x6fc3, 0x70bf, 0x71b4, 0x72a3, 0x738a, 0x746a, 0x7542,
+	0x7614, 0x76dd, 0x77a0, 0x785a, 0x790c, 0x79b7, 0x7a59, 0x7af3,
+	0x7b85, 0x7c0e, 0x7c8f, 0x7d07, 0x7d77, 0x7dde, 0x7e3c, 0x7e92,
+	0x7ede, 0x7f22, 0x7f5d, 0x7f8f, 0x7fb7, 0x7fd7, 0x7fee, 0x7ffb,
+	0x7fff, 0x7ffb, 0x7fee, 0x7fd7, 0x7fb7, 0x7f8f, 0x7f5d, 0x7f22,
+	0x7ede, 0x7e92, 0x7e3c, 0x7dde, 0x7d77, 0x7d07, 0x7c8f, 0x7c0e,
+	0x7b85, 0x7af3, 0x7a59, 0x79b7, 0x790c, 0x785a, 0x77a0, 0x76dd,
+	0x7614, 0x7542, 0x746a, 0x738a, 0x72a3, 0x71b4, 0x70bf, 0x6fc3,
+	0x6ec1, 0x6db8, 0x6ca9, 0x6b94, 0x6a79, 0x6958, 0x6832, 0x6706,
+	0x65d5, 0x649f, 0x6364, 0x6224, 0x60e0, 0x5f98, 0x5e4b, 0x5cfb,
+	0x5ba7, 0x5a50, 0x58f5, 0x5797, 0x5636, 0x54d3, 0x536d, 0x5205,
+	0x509b, 0x4f30, 0x4dc2, 0x4c54, 0x4ae4, 0x4974, 0x4802, 0x4691,
+	0x451f, 0x43ad, 0x423b, 0x40ca, 0x3f59, 0x3dea, 0x3c7b, 0x3b0e,
+	0x39a2, 0x3838, 0x36d0, 0x356a, 0x3407, 0x32a7, 0x3149, 0x2fee,
+	0x2e96, 0x2d42, 0x2bf2, 0x2aa6, 0x295d, 0x2819, 0x26da, 0x259f,
+	0x2468, 0x2337, 0x220c, 0x20e5, 0x1fc4, 0x1ea9, 0x1d94, 0x1c85,
+	0x1b7c, 0x1a7a, 0x197e, 0x1889, 0x179b, 0x16b4, 0x15d4, 0x14fb,
+	0x142a, 0x1360, 0x129e, 0x11e4, 0x1131, 0x1087, 0x0fe5, 0x0f4b,
+	0x0eb9, 0x0e2f, 0x0daf, 0x0d36, 0x0cc6, 0x0c5f, 0x0c01, 0x0bac,
+	0x0b5f, 0x0b1b, 0x0ae1, 0x0aaf, 0x0a86, 0x0a66, 0x0a50, 0x0a42,
+};
+
@@ -0,0 +1,70 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16hamming512[512] =
+{
+	0x0a3d, 0x0a3f, 0x0a42, 0x0a48, 0x0a50, 0x0a5a, 0x0a66, 0x0a75,
+	0x0a86, 0x0a99, 0x0aaf, 0x0ac7, 0x0ae1, 0x0afd, 0x0b1b, 0x0b3c,
+	0x0b5f, 0x0b84, 0x0bac, 0x0bd5, 0x0c01, 0x0c2f, 0x0c5f, 0x0c92,
+	0x0cc6, 0x0cfd, 0x0d36, 0x0d71, 0x0daf, 0x0dee, 0x0e2f, 0x0e73,
+	0x0eb9, 0x0f01, 0x0f4b, 0x0f97, 0x0fe5, 0x1035, 0x1087, 0x10db,
+	0x1131, 0x1189, 0x11e4, 0x1240, 0x129e, 0x12fe, 0x1360, 0x13c4,
+	0x142a, 0x1491, 0x14fb, 0x1566, 0x15d4, 0x1643, 0x16b4, 0x1726,
+	0x179b, 0x1811, 0x1889, 0x1903, 0x197e, 0x19fb, 0x1a7a, 0x1afa,
+	0x1b7c, 0x1c00, 0x1c85, 0x1d0c, 0x1d94, 0x1e1e, 0x1ea9, 0x1f36,
+	0x1fc4, 0x2054, 0x20e5, 0x2178, 0x220c, 0x22a1, 0x2337, 0x23cf,
+	0x2468, 0x2503, 0x259f, 0x263b, 0x26da, 0x2779, 0x2819, 0x28bb,
+	0x295d, 0x2a01, 0x2aa6, 0x2b4b, 0x2bf2, 0x2c9a, 0x2d42, 0x2dec,
+	0x2e96, 0x2f42, 0x2fee, 0x309b, 0x3149, 0x31f7, 0x32a7, 0x3356,
+	0x3407, 0x34b9, 0x356a, 0x361d, 0x36d0, 0x3784, 0x3838, 0x38ed,
+	0x39a2, 0x3a58, 0x3b0e, 0x3bc4, 0x3c7b, 0x3d32, 0x3dea, 0x3ea1,
+	0x3f59, 0x4011, 0x40ca, 0x4182, 0x423b, 0x42f4, 0x43ad, 0x4466,
+	0x451f, 0x45d8, 0x4691, 0x474a, 0x4802, 0x48bb, 0x4974, 0x4a2c,
+	0x4ae4, 0x4b9c, 0x4c54, 0x4d0b, 0x4dc2, 0x4e79, 0x4f30, 0x4fe6,
+	0x509b, 0x5151, 0x5205, 0x52ba, 0x536d, 0x5420, 0x54d3, 0x5585,
+	0x5636, 0x56e7, 0x5797, 0x5846, 0x58f5, 0x59a3, 0x5a50, 0x5afc,
+	0x5ba7, 0x5c51, 0x5cfb, 0x5da4, 0x5e4b, 0x5ef2, 0x5f98, 0x603d,
+	0x60e0, 0x6183, 0x6224, 0x62c5, 0x6364, 0x6402, 0x649f, 0x653b,
+	0x65d5, 0x666e, 0x6706, 0x679d, 0x6832, 0x68c6, 0x6958, 0x69e9,
+	0x6a79, 0x6b07, 0x6b94, 0x6c1f, 0x6ca9, 0x6d32, 0x6db8, 0x6e3e,
+	0x6ec1, 0x6f43, 0x6fc3, 0x7042, 0x70bf, 0x713b, 0x71b4, 0x722c,
+	0x72a3, 0x7317, 0x738a, 0x73fb, 0x746a, 0x74d7, 0x7542, 0x75ac,
+	0x7614, 0x767a, 0x76dd, 0x773f, 0x77a0, 0x77fe, 0x785a, 0x78b4,
+	0x790c, 0x7962, 0x79b7, 0x7a09, 0x7a59, 0x7aa7, 0x7af3, 0x7b3d,
+	0x7b85, 0x7bca, 0x7c0e, 0x7c4f, 0x7c8f, 0x7ccc, 0x7d07, 0x7d40,
+	0x7d77, 0x7dac, 0x7dde, 0x7e0e, 0x7e3c, 0x7e68, 0x7e92, 0x7eb9,
+	0x7ede, 0x7f01, 0x7f22, 0x7f41, 0x7f5d, 0x7f77, 0x7f8f, 0x7fa4,
+	0x7fb7, 0x7fc8, 0x7fd7, 0x7fe4, 0x7fee, 0x7ff6, 0x7ffb, 0x7fff,
+	0x7fff, 0x7fff, 0x7ffb, 0x7ff6, 0x7fee, 0x7fe4, 0x7fd7, 0x7fc8,
+	0x7fb7, 0x7fa4, 0x7f8f, 0x7f77, 0x7f5d, 0x7f41, 0x7f22, 0x7f01,
+	0x7ede, 0x7eb9, 0x7e92, 0x7e68, 0x7e3c, 0x7e0e, 0x7dde, 0x7dac,
+	0x7d77, 0x7d40, 0x7d07, 0x7ccc, 0x7c8f, 0x7c4f, 0x7c0e, 0x7bca,
+	0x7b85, 0x7b3d, 0x7af3, 0x7aa7, 0x7a59, 0x7a09, 0x79b7, 0x7962,
+	0x790c, 0x78b4, 0x785a, 0x77fe, 0x77a0, 0x773f, 0x76dd, 0x767a,
+	0x7614, 0x75ac, 0x7542, 0x74d7, 0x746a, 0x73fb, 0x738a, 0x7317,
+	0x72a3, 0x722c, 0x71b4, 0x713b, 0x70bf, 0x7042, 0x6fc3, 0x6f43,
+	0x6ec1, 0x6e3e, 0x6db8, 0x6d32, 0x6ca9, 0x6c1f, 0x6b94, 0x6b07,
+	0x6a79, 0x69e9, 0x6958, 0x68c6, 0x6832, 0x679d, 0x6706, 0x666e,
+	0x65d5, 0x653b, 0x649f, 0x6402, 0x6364, 0x62c5, 0x6224, 0x6183,
+	0x60e0, 0x603d, 0x5f98, 0x5ef2, 0x5e4b, 0x5da4, 0x5cfb, 0x5c51,
+	0x5ba7, 0x5afc, 0x5a50, 0x59a3, 0x58f5, 0x5846, 0x5797, 0x56e7,
+	0x5636, 0x5585, 0x54d3, 0x5420, 0x536d, 0x52ba, 0x5205, 0x5151,
+	0x509b, 0x4fe6, 0x4f30, 0x4e79, 0x4dc2, 0x4d0b, 0x4c54, 0x4b9c,
+	0x4ae4, 0x4a2c, 0x4974, 0x48bb, 0x4802, 0x474a, 0x4691, 0x45d8,
+	0x451f, 0x4466, 0x43ad, 0x42f4, 0x423b, 0x4182, 0x40ca, 0x4011,
+	0x3f59, 0x3ea1, 0x3dea, 0x3d32, 0x3c7b, 0x3bc4, 0x3b0e, 0x3a58,
+	0x39a2, 0x38ed, 0x3838, 0x3784, 0x36d0, 0x361d, 0x356a, 0x34b9,
+	0x3407, 0x3356, 0x32a7, 0x31f7, 0x3149, 0x309b, 0x2fee, 0x2f42,
+	0x2e96, 0x2dec, 0x2d42, 0x2c9a, 0x2bf2, 0x2b4b, 0x2aa6, 0x2a01,
+	0x295d, 0x28bb, 0x2819, 0x2779, 0x26da, 0x263b, 0x259f, 0x2503,
+	0x2468, 0x23cf, 0x2337, 0x22a1, 0x220c, 0x2178, 0x20e5, 0x2054,
+	0x1fc4, 0x1f36, 0x1ea9, 0x1e1e, 0x1d94, 0x1d0c, 0x1c85, 0x1c00,
+	0x1b7c, 0x1afa, 0x1a7a, 0x19fb, 0x197e, 0x1903, 0x1889, 0x1811,
+	0x179b, 0x1726, 0x16b4, 0x1643, 0x15d4, 0x1566, 0x14fb, 0x1491,
+	0x142a, 0x13c4, 0x1360, 0x12fe, 0x129e, 0x1240, 0x11e4, 0x1189,
+	0x1131, 0x10db, 0x1087, 0x1035, 0x0fe5, 0x0f97, 0x0f4b, 0x0f01,
+	0x0eb9, 0x0e73, 0x0e2f, 0x0dee, 0x0daf, 0x0d71, 0x0d36, 0x0cfd,
+	0x0cc6, 0x0c92, 0x0c5f, 0x0c2f, 0x0c01, 0x0bd5, 0x0bac, 0x0b84,
+	0x0b5f, 0x0b3c, 0x0b1b, 0x0afd, 0x0ae1, 0x0ac7, 0x0aaf, 0x0a99,
+	0x0a86, 0x0a75, 0x0a66, 0x0a5a, 0x0a50, 0x0a48, 0x0a42, 0x0a3f,
+};
+
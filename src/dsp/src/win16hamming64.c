@@ -0,0 +1,14 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16hamming64[64] =
+{
+	0x0a3d, 0x0a86, 0x0b5f, 0x0cc6, 0x0eb9, 0x1131, 0x142a, 0x179b,
+	0x1b7c, 0x1fc4, 0x2468, 0x295d, 0x2e96, 0x3407, 0x39a2, 0x3f59,
+	0x451f, 0x4ae4, 0x509b, 0x5636, 0x5ba7, 0x60e0, 0x65d5, 0x6a79,
+	0x6ec1, 0x72a3, 0x7614, 0x790c, 0x7b85, 0x7d77, 0x7ede, 0x7fb7,
+	0x7fff, 0x7fb7, 0x7ede, 0x7d77, 0x7b85, 0x790c, 0x7614, 0x72a3,
+	0x6ec1, 0x6a79, 0x65d5, 0x60e0, 0x5ba7, 0x5636, 0x509b, 0x4ae4,
+	0x451f, 0x3f59, 0x39a2, 0x3407, 0x2e96, 0x295d, 0x2468, 0x1fc4,
+	0x1b7c, 0x179b, 0x142a, 0x1131, 0x0eb9, 0x0cc6, 0x0b5f, 0x0a86,
+};
+
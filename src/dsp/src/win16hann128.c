@@ -0,0 +1,22 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16hann128[128] =
+{
+	0x0000, 0x0014, 0x004f, 0x00b1, 0x013b, 0x01eb, 0x02c1, 0x03be,
+	0x04df, 0x0625, 0x078f, 0x091b, 0x0ac9, 0x0c98, 0x0e87, 0x1094,
+	0x12bf, 0x1505, 0x1766, 0x19e0, 0x1c72, 0x1f19, 0x21d5, 0x24a3,
+	0x2782, 0x2a70, 0x2d6c, 0x3073, 0x3384, 0x369c, 0x39ba, 0x3cdc,
+	0x4000, 0x4324, 0x4646, 0x4964, 0x4c7c, 0x4f8d, 0x5294, 0x5590,
+	0x587e, 0x5b5d, 0x5e2b, 0x60e7, 0x638e, 0x6620, 0x689a, 0x6afb,
+	0x6d41, 0x6f6c, 0x7179, 0x7368, 0x7537, 0x76e5, 0x7871, 0x79db,
+	0x7b21, 0x7c42, 0x7d3f, 0x7e15, 0x7ec5, 0x7f4f, 0x7fb1, 0x7fec,
+	0x7fff, 0x7fec, 0x7fb1, 0x7f4f, 0x7ec5, 0x7e15, 0x7d3f, 0x7c42,
+	0x7b21, 0x79db, 0x7871, 0x76e5, 0x7537, 0x7368, 0x7179, 0x6f6c,
+	0x6d41, 0x6afb, 0x689a, 0x6620, 0x638e, 0x60e7, 0x5e2b, 0x5b5d,
+	0x587e, 0x5590, 0x5294, 0x4f8d, 0x4c7c, 0x4964, 0x4646, 0x4324,
+	0x4000, 0x3cdc, 0x39ba, 0x369c, 0x3384, 0x3073, 0x2d6c, 0x2a70,
+	0x2782, 0x24a3, 0x21d5, 0x1f19, 0x1c72, 0x19e0, 0x1766, 0x1505,
+	0x12bf, 0x1094, 0x0e87, 0x0c98, 0x0ac9, 0x091b, 0x078f, 0x0625,
+	0x04df, 0x03be, 0x02c1, 0x01eb, 0x013b, 0x00b1, 0x004f, 0x0014,
+};
+
@@ -0,0 +1,38 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16hann256[256] =
+{
+	0x0000, 0x0005, 0x0014, 0x002c, 0x004f, 0x007b, 0x00b1, 0x00f1,
+	0x013b, 0x018e, 0x01eb, 0x0251, 0x02c1, 0x033b, 0x03be, 0x044a,
+	0x04df, 0x057e, 0x0625, 0x06d5, 0x078f, 0x0850, 0x091b, 0x09ee,
+	0x0ac9, 0x0bad, 0x0c98, 0x0d8c, 0x0e87, 0x0f8a, 0x1094, 0x11a6,
+	0x12bf, 0x13df, 0x1505, 0x1632, 0x1766, 0x18a0, 0x19e0, 0x1b26,
+	0x1c72, 0x1dc3, 0x1f19, 0x2074, 0x21d5, 0x233a, 0x24a3, 0x2611,
+	0x2782, 0x28f7, 0x2a70, 0x2bed, 0x2d6c, 0x2eee, 0x3073, 0x31fa,
+	0x3384, 0x350f, 0x369c, 0x382a, 0x39ba, 0x3b4b, 0x3cdc, 0x3e6e,
+	0x4000, 0x4192, 0x4324, 0x44b5, 0x4646, 0x47d6, 0x4964, 0x4af1,
+	0x4c7c, 0x4e06, 0x4f8d, 0x5112, 0x5294, 0x5413, 0x5590, 0x5709,
+	0x587e, 0x59ef, 0x5b5d, 0x5cc6, 0x5e2b, 0x5f8c, 0x60e7, 0x623d,
+	0x638e, 0x64da, 0x6620, 0x6760, 0x689a, 0x69ce, 0x6afb, 0x6c21,
+	0x6d41, 0x6e5a, 0x6f6c, 0x7076, 0x7179, 0x7274, 0x7368, 0x7453,
+	0x7537, 0x7612, 0x76e5, 0x77b0, 0x7871, 0x792b, 0x79db, 0x7a82,
+	0x7b21, 0x7bb6, 0x7c42, 0x7cc5, 0x7d3f, 0x7daf, 0x7e15, 0x7e72,
+	0x7ec5, 0x7f0f, 0x7f4f, 0x7f85, 0x7fb1, 0x7fd4, 0x7fec, 0x7ffb,
+	0x7fff, 0x7ffb, 0x7fec, 0x7fd4, 0x7fb1, 0x7f85, 0x7f4f, 0x7f0f,
+	0x7ec5, 0x7e72, 0x7e15, 0x7daf, 0x7d3f, 0x7cc5, 0x7c42, 0x7bb6,
+	0x7b21, 0x7a82, 0x79db, 0x792b, 0x7871, 0x77b0, 0x76e5, 0x7612,
+	0x7537, 0x7453, 0x7368, 0x7274, 0x7179, 0x7076, 0x6f6c, 0x6e5a,
+	0x6d41, 0x6c21, 0x6afb, 0x69ce, 0x689a, 0x6760, 0x6620, 0x64da,
+	0x638e, 0x623d, 0x60e7, 0x5f8c, 0x5e2b, 0x5cc6, 0x5b5d, 0x59ef,
+	0x587e, 0x5709, 0x5590, 0x5413, 0x5294, 0x5112, 0x4f8d, 0x4e06,
+	0x4c7c, 0x4af1, 0x4964, 0x47d6, 0x4646, 0x44b5, 0x4324, 0x4192,
+	0x4000, 0x3e6e, 0x3cdc, 0x3b4b, 0x39ba, 0x382a, 0x369c, 0x350f,
+	0x3384, 0x31fa, 0x3073, 0x2eee, 0x2d6c, 0x2bed, 0x2a70, 0x28f7,
+	0x2782, 0x2611, 0x24a3, 0x233a, 0x21d5, 0x2074, 0x1f19, 0x1dc3,
+	0x1c72, 0x1b26, 0x19e0, 0x18a0, 0x1766, 0x1632, 0x1505, 0x13df,
+	0x12bf, 0x11a6, 0x1094, 0x0f8a, 0x0e87, 0x0d8c, 0x0c98, 0x0bad,
+	0x0ac9, 0x09ee, 0x091b, 0x0850, 0x078f, 0x06d5, 0x0625, 0x057e,
+	0x04df, 0x044a, 0x03be, 0x033b, 0x02c1, 0x0251, 0x01eb, 0x018e,
+	0x013b, 0x00f1, 0x00b1, 0x007b, 0x004f, 0x002c, 0x0014, 0x0005,
+};
+
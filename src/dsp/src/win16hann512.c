@@ -0,0 +1,70 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16hann512[512] =
+{
+	0x0000, 0x0001, 0x0005, 0x000b, 0x0014, 0x001f, 0x002c, 0x003c,
+	0x004f, 0x0064, 0x007b, 0x0095, 0x00b1, 0x00d0, 0x00f1, 0x0115,
+	0x013b, 0x0163, 0x018e, 0x01bb, 0x01eb, 0x021d, 0x0251, 0x0288,
+	0x02c1, 0x02fd, 0x033b, 0x037b, 0x03be, 0x0403, 0x044a, 0x0493,
+	0x04df, 0x052d, 0x057e, 0x05d0, 0x0625, 0x067c, 0x06d5, 0x0731,
+	0x078f, 0x07ee, 0x0850, 0x08b5, 0x091b, 0x0983, 0x09ee, 0x0a5b,
+	0x0ac9, 0x0b3a, 0x0bad, 0x0c21, 0x0c98, 0x0d11, 0x0d8c, 0x0e08,
+	0x0e87, 0x0f07, 0x0f8a, 0x100e, 0x1094, 0x111c, 0x11a6, 0x1231,
+	0x12bf, 0x134e, 0x13df, 0x1471, 0x1505, 0x159b, 0x1632, 0x16cb,
+	0x1766, 0x1802, 0x18a0, 0x193f, 0x19e0, 0x1a82, 0x1b26, 0x1bcb,
+	0x1c72, 0x1d19, 0x1dc3, 0x1e6d, 0x1f19, 0x1fc6, 0x2074, 0x2124,
+	0x21d5, 0x2287, 0x233a, 0x23ee, 0x24a3, 0x2559, 0x2611, 0x26c9,
+	0x2782, 0x283c, 0x28f7, 0x29b4, 0x2a70, 0x2b2e, 0x2bed, 0x2cac,
+	0x2d6c, 0x2e2d, 0x2eee, 0x2fb0, 0x3073, 0x3136, 0x31fa, 0x32bf,
+	0x3384, 0x3449, 0x350f, 0x35d5, 0x369c, 0x3763, 0x382a, 0x38f2,
+	0x39ba, 0x3a82, 0x3b4b, 0x3c13, 0x3cdc, 0x3da5, 0x3e6e, 0x3f37,
+	0x4000, 0x40c9, 0x4192, 0x425b, 0x4324, 0x43ed, 0x44b5, 0x457e,
+	0x4646, 0x470e, 0x47d6, 0x489d, 0x4964, 0x4a2b, 0x4af1, 0x4bb7,
+	0x4c7c, 0x4d41, 0x4e06, 0x4eca, 0x4f8d, 0x5050, 0x5112, 0x51d3,
+	0x5294, 0x5354, 0x5413, 0x54d2, 0x5590, 0x564c, 0x5709, 0x57c4,
+	0x587e, 0x5937, 0x59ef, 0x5aa7, 0x5b5d, 0x5c12, 0x5cc6, 0x5d79,
+	0x5e2b, 0x5edc, 0x5f8c, 0x603a, 0x60e7, 0x6193, 0x623d, 0x62e7,
+	0x638e, 0x6435, 0x64da, 0x657e, 0x6620, 0x66c1, 0x6760, 0x67fe,
+	0x689a, 0x6935, 0x69ce, 0x6a65, 0x6afb, 0x6b8f, 0x6c21, 0x6cb2,
+	0x6d41, 0x6dcf, 0x6e5a, 0x6ee4, 0x6f6c, 0x6ff2, 0x7076, 0x70f9,
+	0x7179, 0x71f8, 0x7274, 0x72ef, 0x7368, 0x73df, 0x7453, 0x74c6,
+	0x7537, 0x75a5, 0x7612, 0x767d, 0x76e5, 0x774b, 0x77b0, 0x7812,
+	0x7871, 0x78cf, 0x792b, 0x7984, 0x79db, 0x7a30, 0x7a82, 0x7ad3,
+	0x7b21, 0x7b6d, 0x7bb6, 0x7bfd, 0x7c42, 0x7c85, 0x7cc5, 0x7d03,
+	0x7d3f, 0x7d78, 0x7daf, 0x7de3, 0x7e15, 0x7e45, 0x7e72, 0x7e9d,
+	0x7ec5, 0x7eeb, 0x7f0f, 0x7f30, 0x7f4f, 0x7f6b, 0x7f85, 0x7f9c,
+	0x7fb1, 0x7fc4, 0x7fd4, 0x7fe1, 0x7fec, 0x7ff5, 0x7ffb, 0x7fff,
+	0x7fff, 0x7fff, 0x7ffb, 0x7ff5, 0x7fec, 0x7fe1, 0x7fd4, 0x7fc4,
+	0x7fb1, 0x7f9c, 0x7f85, 0x7f6b, 0x7f4f, 0x7f30, 0x7f0f, 0x7eeb,
+	0x7ec5, 0x7e9d, 0x7e72, 0x7e45, 0x7e15, 0x7de3, 0x7daf, 0x7d78,
+	0x7d3f, 0x7d03, 0x7cc5, 0x7c85, 0x7c42, 0x7bfd, 0x7bb6, 0x7b6d,
+	0x7b21, 0x7ad3, 0x7a82, 0x7a30, 0x79db, 0x7984, 0x792b, 0x78cf,
+	0x7871, 0x7812, 0x77b0, 0x774b, 0x76e5, 0x767d, 0x7612, 0x75a5,
+	0x7537, 0x74c6, 0x7453, 0x73df, 0x7368, 0x72ef, 0x7274, 0x71f8,
+	0x7179, 0x70f9, 0x7076, 0x6ff2, 0x6f6c, 0x6ee4, 0x6e5a, 0x6dcf,
+	0x6d41, 0x6cb2, 0x6c21, 0x6b8f, 0x6afb, 0x6a65, 0x69ce, 0x6935,
+	0x689a, 0x67fe, 0x6760, 0x66c1, 0x6620, 0x657e, 0x64da, 0x6435,
+	0x638e, 0x62e7, 0x623d, 0x6193, 0x60e7, 0x603a, 0x5f8c, 0x5edc,
+	0x5e2b, 0x5d79, 0x5cc6, 0x5c12, 0x5b5d, 0x5aa7, 0x59ef, 0x5937,
+	0x587e, 0x57c4, 0x5709, 0x564c, 0x5590, 0x54d2, 0x5413, 0x5354,
+	0x5294, 0x51d3, 0x5112, 0x5050, 0x4f8d, 0x4eca, 0x4e06, 0x4d41,
+	0x4c7c, 0x4bb7, 0x4af1, 0x4a2b, 0x4964, 0x489d, 0x47d6, 0x470e,
+	0x4646, 0x457e, 0x44b5, 0x43ed, 0x4324, 0x425b, 0x4192, 0x40c9,
+	0x4000, 0x3f37, 0x3e6e, 0x3da5, 0x3cdc, 0x3c13, 0x3b4b, 0x3a82,
+	0x39ba, 0x38f2, 0x382a, 0x3763, 0x369c, 0x35d5, 0x350f, 0x3449,
+	0x3384, 0x32bf, 0x31fa, 0x3136, 0x3073, 0x2fb0, 0x2eee, 0x2e2d,
+	0x2d6c, 0x2cac, 0x2bed, 0x2b2e, 0x2a70, 0x29b4, 0x28f7, 0x283c,
+	0x2782, 0x26c9, 0x2611, 0x2559, 0x24a3, 0x23ee, 0x233a, 0x2287,
+	0x21d5, 0x2124, 0x2074, 0x1fc6, 0x1f19, 0x1e6d, 0x1dc3, 0x1d19,
+	0x1c72, 0x1bcb, 0x1b26, 0x1a82, 0x19e0, 0x193f, 0x18a0, 0x1802,
+	0x1766, 0x16cb, 0x1632, 0x159b, 0x1505, 0x1471, 0x13df, 0x134e,
+	0x12bf, 0x1231, 0x11a6, 0x111c, 0x1094, 0x100e, 0x0f8a, 0x0f07,
+	0x0e87, 0x0e08, 0x0d8c, 0x0d11, 0x0c98, 0x0c21, 0x0bad, 0x0b3a,
+	0x0ac9, 0x0a5b, 0x09ee, 0x0983, 0x091b, 0x08b5, 0x0850, 0x07ee,
+	0x078f, 0x0731, 0x06d5, 0x067c, 0x0625, 0x05d0, 0x057e, 0x052d,
+	0x04df, 0x0493, 0x044a, 0x0403, 0x03be, 0x037b, 0x033b, 0x02fd,
+	0x02c1, 0x0288, 0x0251, 0x021d, 0x01eb, 0x01bb, 0x018e, 0x0163,
+	0x013b, 0x0115, 0x00f1, 0x00d0, 0x00b1, 0x0095, 0x007b, 0x0064,
+	0x004f, 0x003c, 0x002c, 0x001f, 0x0014, 0x000b, 0x0005, 0x0001,
+};
+
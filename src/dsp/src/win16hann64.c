@@ -0,0 +1,14 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int16 win16hann64[64] =
+{
+	0x0000, 0x004f, 0x013b, 0x02c1, 0x04df, 0x078f, 0x0ac9, 0x0e87,
+	0x12bf, 0x1766, 0x1c72, 0x21d5, 0x2782, 0x2d6c, 0x3384, 0x39ba,
+	0x4000, 0x4646, 0x4c7c, 0x5294, 0x587e, 0x5e2b, 0x638e, 0x689a,
+	0x6d41, 0x7179, 0x7537, 0x7871, 0x7b21, 0x7d3f, 0x7ec5, 0x7fb1,
+	0x7fff, 0x7fb1, 0x7ec5, 0x7d3f, 0x7b21, 0x7871, 0x7537, 0x7179,
+	0x6d41, 0x689a, 0x638e, 0x5e2b, 0x587e, 0x5294, 0x4c7c, 0x4646,
+	0x4000, 0x39ba, 0x3384, 0x2d6c, 0x2782, 0x21d5, 0x1c72, 0x1766,
+	0x12bf, 0x0e87, 0x0ac9, 0x078f, 0x04df, 0x02c1, 0x013b, 0x004f,
+};
+
@@ -0,0 +1,262 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32bharris1024[1024] =
+{
+	0x0001f751, 0x0001fbc9, 0x00020931, 0x00021f8e,
+	0x00023ee6, 0x00026742, 0x000298ac, 0x0002d333,
+	0x000316e8, 0x000363dc, 0x0003ba26, 0x000419dd,
+	0x0004831b, 0x0004f5fe, 0x000572a5, 0x0005f932,
+	0x000689ca, 0x00072493, 0x0007c9b6, 0x00087961,
+	0x000933c1, 0x0009f907, 0x000ac967, 0x000ba518,
+	0x000c8c50, 0x000d7f4d, 0x000e7e4a, 0x000f8989,
+	0x0010a14c, 0x0011c5d8, 0x0012f775, 0x0014366c,
+	0x0015830b, 0x0016dda0, 0x0018467e, 0x0019bdf8,
+	0x001b4465, 0x001cda1e, 0x001e7f80, 0x002034e7,
+	0x0021fab5, 0x0023d14c, 0x0025b913, 0x0027b272,
+	0x0029bdd3, 0x002bdba3, 0x002e0c52, 0x00305051,
+	0x0032a817, 0x00351419, 0x003794d1, 0x003a2abb,
+	0x003cd655, 0x003f9821, 0x004270a1, 0x0045605c,
+	0x004867d9, 0x004b87a4, 0x004ec049, 0x00521258,
+	0x00557e64, 0x00590500, 0x005ca6c3, 0x00606446,
+	0x00643e26, 0x00683500, 0x006c4975, 0x00707c28,
+	0x0074cdbd, 0x00793edc, 0x007dd02f, 0x00828263,
+	0x00875626, 0x008c4c29, 0x0091651f, 0x0096a1be,
+	0x009c02bd, 0x00a188d8, 0x00a734ca, 0x00ad0751,
+	0x00b30130, 0x00b92329, 0x00bf6e02, 0x00c5e282,
+	0x00cc8173, 0x00d34ba1, 0x00da41da, 0x00e164f0,
+	0x00e8b5b3, 0x00f034fa, 0x00f7e39a, 0x00ffc26d,
+	0x0107d24d, 0x01101418, 0x011888ac, 0x012130eb,
+	0x012a0db7, 0x01331ff6, 0x013c688e, 0x0145e869,
+	0x014fa072, 0x01599194, 0x0163bcbf, 0x016e22e3,
+	0x0178c4f2, 0x0183a3e1, 0x018ec0a5, 0x019a1c36,
+	0x01a5b78d, 0x01b193a5, 0x01bdb17b, 0x01ca120d,
+	0x01d6b65b, 0x01e39f67, 0x01f0ce33, 0x01fe43c5,
+	0x020c0122, 0x021a0752, 0x0228575d, 0x0236f24f,
+	0x0245d932, 0x02550d14, 0x02648f03, 0x0274600f,
+	0x02848148, 0x0294f3c0, 0x02a5b88b, 0x02b6d0bd,
+	0x02c83d6b, 0x02d9ffaa, 0x02ec1894, 0x02fe893f,
+	0x031152c5, 0x03247640, 0x0337f4ca, 0x034bcf80,
+	0x0360077d, 0x03749ddf, 0x038993c3, 0x039eea47,
+	0x03b4a28b, 0x03cabdad, 0x03e13ccd, 0x03f8210c,
+	0x040f6b89, 0x04271d66, 0x043f37c4, 0x0457bbc3,
+	0x0470aa86, 0x048a052e, 0x04a3ccdc, 0x04be02b2,
+	0x04d8a7d1, 0x04f3bd5b, 0x050f4471, 0x052b3e34,
+	0x0547abc4, 0x05648e43, 0x0581e6cf, 0x059fb688,
+	0x05bdfe8e, 0x05dcbfff, 0x05fbfbf8, 0x061bb397,
+	0x063be7f7, 0x065c9a35, 0x067dcb6b, 0x069f7cb2,
+	0x06c1af24, 0x06e463d8, 0x07079be4, 0x072b585d,
+	0x074f9a59, 0x077462e8, 0x0799b31e, 0x07bf8c09,
+	0x07e5eeb7, 0x080cdc36, 0x08345591, 0x085c5bd1,
+	0x0884effd, 0x08ae131b, 0x08d7c62f, 0x09020a3b,
+	0x092ce03e, 0x09584936, 0x0984461f, 0x09b0d7f1,
+	0x09ddffa2, 0x0a0bbe29, 0x0a3a1475, 0x0a690377,
+	0x0a988c1b, 0x0ac8af4b, 0x0af96dee, 0x0b2ac8e8,
+	0x0b5cc11c, 0x0b8f5766, 0x0bc28ca3, 0x0bf661ab,
+	0x0c2ad753, 0x0c5fee6c, 0x0c95a7c5, 0x0ccc0428,
+	0x0d03045e, 0x0d3aa92b, 0x0d72f34d, 0x0dabe382,
+	0x0de57a84, 0x0e1fb905, 0x0e5a9fb9, 0x0e962f4a,
+	0x0ed26864, 0x0f0f4ba9, 0x0f4cd9bb, 0x0f8b1337,
+	0x0fc9f8b3, 0x10098ac3, 0x1049c9f7, 0x108ab6d9,
+	0x10cc51ef, 0x110e9bb9, 0x115194b4, 0x11953d58,
+	0x11d99617, 0x121e9f5f, 0x12645997, 0x12aac525,
+	0x12f1e265, 0x1339b1b1, 0x1382335d, 0x13cb67b6,
+	0x14154f06, 0x145fe990, 0x14ab3792, 0x14f73944,
+	0x1543eed8, 0x1591587b, 0x15df7654, 0x162e4884,
+	0x167dcf26, 0x16ce0a4f, 0x171efa0d, 0x17709e6b,
+	0x17c2f76a, 0x18160508, 0x1869c739, 0x18be3dee,
+	0x19136911, 0x19694885, 0x19bfdc25, 0x1a1723c8,
+	0x1a6f1f3e, 0x1ac7ce4f, 0x1b2130bc, 0x1b7b4642,
+	0x1bd60e95, 0x1c318962, 0x1c8db650, 0x1cea94ff,
+	0x1d482508, 0x1da665fd, 0x1e055769, 0x1e64f8ce,
+	0x1ec549ab, 0x1f264973, 0x1f87f796, 0x1fea537b,
+	0x204d5c81, 0x20b11201, 0x2115734c, 0x217a7fab,
+	0x21e03661, 0x224696a9, 0x22ad9fb7, 0x231550b6,
+	0x237da8cb, 0x23e6a714, 0x24504aa5, 0x24ba928d,
+	0x25257dd2, 0x25910b73, 0x25fd3a67, 0x266a099e,
+	0x26d77800, 0x2745846d, 0x27b42dbe, 0x282372c4,
+	0x28935248, 0x2903cb0d, 0x2974dbcb, 0x29e68337,
+	0x2a58bffa, 0x2acb90b7, 0x2b3ef40b, 0x2bb2e888,
+	0x2c276cbb, 0x2c9c7f28, 0x2d121e4c, 0x2d88489d,
+	0x2dfefc87, 0x2e763871, 0x2eedfab9, 0x2f6641b5,
+	0x2fdf0bb6, 0x30585703, 0x30d221dc, 0x314c6a79,
+	0x31c72f0c, 0x32426dbe, 0x32be24b3, 0x333a5204,
+	0x33b6f3c6, 0x34340805, 0x34b18cc6, 0x352f8006,
+	0x35addfbd, 0x362ca9d9, 0x36abdc42, 0x372b74db,
+	0x37ab717c, 0x382bcff9, 0x38ac8e1f, 0x392da9b1,
+	0x39af2070, 0x3a30f011, 0x3ab31647, 0x3b3590bb,
+	0x3bb85d10, 0x3c3b78e4, 0x3cbee1cc, 0x3d42955a,
+	0x3dc69115, 0x3e4ad282, 0x3ecf571c, 0x3f541c5c,
+	0x3fd91fb1, 0x405e5e86, 0x40e3d640, 0x4169843c,
+	0x41ef65d5, 0x4275785c, 0x42fbb91f, 0x43822566,
+	0x4408ba73, 0x448f7583, 0x451653cc, 0x459d5282,
+	0x46246ed1, 0x46aba5e1, 0x4732f4d5, 0x47ba58cb,
+	0x4841cedb, 0x48c9541b, 0x4950e599, 0x49d88062,
+	0x4a60217b, 0x4ae7c5e8, 0x4b6f6aa7, 0x4bf70cb1,
+	0x4c7ea8fc, 0x4d063c7c, 0x4d8dc41d, 0x4e153ccb,
+	0x4e9ca36c, 0x4f23f4e4, 0x4fab2e13, 0x50324bd6,
+	0x50b94b06, 0x5140287b, 0x51c6e106, 0x524d717a,
+	0x52d3d6a5, 0x535a0d51, 0x53e01248, 0x5465e251,
+	0x54eb7a2f, 0x5570d6a7, 0x55f5f476, 0x567ad05d,
+	0x56ff6718, 0x5783b562, 0x5807b7f4, 0x588b6b88,
+	0x590eccd3, 0x5991d88c, 0x5a148b67, 0x5a96e21a,
+	0x5b18d956, 0x5b9a6dcf, 0x5c1b9c37, 0x5c9c6141,
+	0x5d1cb99c, 0x5d9ca1fd, 0x5e1c1713, 0x5e9b1591,
+	0x5f199a29, 0x5f97a18e, 0x60152874, 0x60922b8d,
+	0x610ea790, 0x618a9931, 0x6205fd29, 0x6280d02f,
+	0x62fb0efc, 0x6374b64d, 0x63edc2dd, 0x6466316d,
+	0x64ddfebc, 0x6555278c, 0x65cba8a5, 0x66417ecb,
+	0x66b6a6ca, 0x672b1d6d, 0x679edf84, 0x6811e9e2,
+	0x6884395a, 0x68f5cac7, 0x69669b02, 0x69d6a6eb,
+	0x6a45eb65, 0x6ab46557, 0x6b2211aa, 0x6b8eed4c,
+	0x6bfaf531, 0x6c66264e, 0x6cd07d9e, 0x6d39f821,
+	0x6da292db, 0x6e0a4ad4, 0x6e711d1c, 0x6ed706c3,
+	0x6f3c04e2, 0x6fa01497, 0x70033304, 0x70655d51,
+	0x70c690ac, 0x7126ca49, 0x71860760, 0x71e44533,
+	0x72418107, 0x729db827, 0x72f8e7e6, 0x73530d9d,
+	0x73ac26ac, 0x74043079, 0x745b2872, 0x74b10c0a,
+	0x7505d8be, 0x75598c0f, 0x75ac2388, 0x75fd9cba,
+	0x764df53f, 0x769d2ab6, 0x76eb3ac9, 0x77382327,
+	0x7783e189, 0x77ce73af, 0x7817d762, 0x78600a73,
+	0x78a70abc, 0x78ecd61d, 0x79316a81, 0x7974c5dd,
+	0x79b6e62a, 0x79f7c96f, 0x7a376db8, 0x7a75d11d,
+	0x7ab2f1be, 0x7aeecdc3, 0x7b296360, 0x7b62b0d0,
+	0x7b9ab459, 0x7bd16c49, 0x7c06d6f9, 0x7c3af2cc,
+	0x7c6dbe2d, 0x7c9f3793, 0x7ccf5d7d, 0x7cfe2e76,
+	0x7d2ba911, 0x7d57cbec, 0x7d8295b1, 0x7dac0511,
+	0x7dd418ca, 0x7dfacfa3, 0x7e20286d, 0x7e442205,
+	0x7e66bb53, 0x7e87f346, 0x7ea7c8dd, 0x7ec63b1c,
+	0x7ee34917, 0x7efef1e9, 0x7f1934ba, 0x7f3210bb,
+	0x7f49852a, 0x7f5f914f, 0x7f74347c, 0x7f876e10,
+	0x7f993d74, 0x7fa9a21b, 0x7fb89b86, 0x7fc6293d,
+	0x7fd24ad7, 0x7fdcfff5, 0x7fe64841, 0x7fee2373,
+	0x7ff4914e, 0x7ff9919e, 0x7ffd243d, 0x7fff490e,
+	0x7fffffff, 0x7fff490e, 0x7ffd243d, 0x7ff9919e,
+	0x7ff4914e, 0x7fee2373, 0x7fe64841, 0x7fdcfff5,
+	0x7fd24ad7, 0x7fc6293d, 0x7fb89b86, 0x7fa9a21b,
+	0x7f993d74, 0x7f876e10, 0x7f74347c, 0x7f5f914f,
+	0x7f49852a, 0x7f3210bb, 0x7f1934ba, 0x7efef1e9,
+	0x7ee34917, 0x7ec63b1c, 0x7ea7c8dd, 0x7e87f346,
+	0x7e66bb53, 0x7e442205, 0x7e20286d, 0x7dfacfa3,
+	0x7dd418ca, 0x7dac0511, 0x7d8295b1, 0x7d57cbec,
+	0x7d2ba911, 0x7cfe2e76, 0x7ccf5d7d, 0x7c9f3793,
+	0x7c6dbe2d, 0x7c3af2cc, 0x7c06d6f9, 0x7bd16c49,
+	0x7b9ab459, 0x7b62b0d0, 0x7b296360, 0x7aeecdc3,
+	0x7ab2f1be, 0x7a75d11d, 0x7a376db8, 0x79f7c96f,
+	0x79b6e62a, 0x7974c5dd, 0x79316a81, 0x78ecd61d,
+	0x78a70abc, 0x78600a73, 0x7817d762, 0x77ce73af,
+	0x7783e189, 0x77382327, 0x76eb3ac9, 0x769d2ab6,
+	0x764df53f, 0x75fd9cba, 0x75ac2388, 0x75598c0f,
+	0x7505d8be, 0x74b10c0a, 0x745b2872, 0x74043079,
+	0x73ac26ac, 0x73530d9d, 0x72f8e7e6, 0x729db827,
+	0x72418107, 0x71e44533, 0x71860760, 0x7126ca49,
+	0x70c690ac, 0x70655d51, 0x70033304, 0x6fa01497,
+	0x6f3c04e2, 0x6ed706c3, 0x6e711d1c, 0x6e0a4ad4,
+	0x6da292db, 0x6d39f821, 0x6cd07d9e, 0x6c66264e,
+	0x6bfaf531, 0x6b8eed4c, 0x6b2211aa, 0x6ab46557,
+	0x6a45eb65, 0x69d6a6eb, 0x69669b02, 0x68f5cac7,
+	0x6884395a, 0x6811e9e2, 0x679edf84, 0x672b1d6d,
+	0x66b6a6ca, 0x66417ecb, 0x65cba8a5, 0x6555278c,
+	0x64ddfebc, 0x6466316d, 0x63edc2dd, 0x6374b64d,
+	0x62fb0efc, 0x6280d02f, 0x6205fd29, 0x618a9931,
+	0x610ea790, 0x60922b8d, 0x60152874, 0x5f97a18e,
+	0x5f199a29, 0x5e9b1591, 0x5e1c1713, 0x5d9ca1fd,
+	0x5d1cb99c, 0x5c9c6141, 0x5c1b9c37, 0x5b9a6dcf,
+	0x5b18d956, 0x5a96e21a, 0x5a148b67, 0x5991d88c,
+	0x590eccd3, 0x588b6b88, 0x5807b7f4, 0x5783b562,
+	0x56ff6718, 0x567ad05d, 0x55f5f476, 0x5570d6a7,
+	0x54eb7a2f, 0x5465e251, 0x53e01248, 0x535a0d51,
+	0x52d3d6a5, 0x524d717a, 0x51c6e106, 0x5140287b,
+	0x50b94b06, 0x50324bd6, 0x4fab2e13, 0x4f23f4e4,
+	0x4e9ca36c, 0x4e153ccb, 0x4d8dc41d, 0x4d063c7c,
+	0x4c7ea8fc, 0x4bf70cb1, 0x4b6f6aa7, 0x4ae7c5e8,
+	0x4a60217b, 0x49d88062, 0x4950e599, 0x48c9541b,
+	0x4841cedb, 0x47ba58cb, 0x4732f4d5, 0x46aba5e1,
+	0x46246ed1, 0x459d5282, 0x451653cc, 0x448f7583,
+	0x4408ba73, 0x43822566, 0x42fbb91f, 0x4275785c,
+	0x41ef65d5, 0x4169843c, 0x40e3d640, 0x405e5e86,
+	0x3fd91fb1, 0x3f541c5c, 0x3ecf571c, 0x3e4ad282,
+	0x3dc69115, 0x3d42955a, 0x3cbee1cc, 0x3c3b78e4,
+	0x3bb85d10, 0x3b3590bb, 0x3ab31647, 0x3a30f011,
+	0x39af2070, 0x392da9b1, 0x38ac8e1f, 0x382bcff9,
+	0x37ab717c, 0x372b74db, 0x36abdc42, 0x362ca9d9,
+	0x35addfbd, 0x352f8006, 0x34b18cc6, 0x34340805,
+	0x33b6f3c6, 0x333a5204, 0x32be24b3, 0x32426dbe,
+	0x31c72f0c, 0x314c6a79, 0x30d221dc, 0x30585703,
+	0x2fdf0bb6, 0x2f6641b5, 0x2eedfab9, 0x2e763871,
+	0x2dfefc87, 0x2d88489d, 0x2d121e4c, 0x2c9c7f28,
+	0x2c276cbb, 0x2bb2e888, 0x2b3ef40b, 0x2acb90b7,
+	0x2a58bffa, 0x29e68337, 0x2974dbcb, 0x2903cb0d,
+	0x28935248, 0x282372c4, 0x27b42dbe, 0x2745846d,
+	0x26d77800, 0x266a099e, 0x25fd3a67, 0x25910b73,
+	0x25257dd2, 0x24ba928d, 0x24504aa5, 0x23e6a714,
+	0x237da8cb, 0x231550b6, 0x22ad9fb7, 0x224696a9,
+	0x21e03661, 0x217a7fab, 0x2115734c, 0x20b11201,
+	0x204d5c81, 0x1fea537b, 0x1f87f796, 0x1f264973,
+	0x1ec549ab, 0x1e64f8ce, 0x1e055769, 0x1da665fd,
+	0x1d482508, 0x1cea94ff, 0x1c8db650, 0x1c318962,
+	0x1bd60e95, 0x1b7b4642, 0x1b2130bc, 0x1ac7ce4f,
+	0x1a6f1f3e, 0x1a1723c8, 0x19bfdc25, 0x19694885,
+	0x19136911, 0x18be3dee, 0x1869c739, 0x18160508,
+	0x17c2f76a, 0x17709e6b, 0x171efa0d, 0x16ce0a4f,
+	0x167dcf26, 0x162e4884, 0x15df7654, 0x1591587b,
+	0x1543eed8, 0x14f73944, 0x14ab3792, 0x145fe990,
+	0x14154f06, 0x13cb67b6, 0x1382335d, 0x1339b1b1,
+	0x12f1e265, 0x12aac525, 0x12645997, 0x121e9f5f,
+	0x11d99617, 0x11953d58, 0x115194b4, 0x110e9bb9,
+	0x10cc51ef, 0x108ab6d9, 0x1049c9f7, 0x10098ac3,
+	0x0fc9f8b3, 0x0f8b1337, 0x0f4cd9bb, 0x0f0f4ba9,
+	0x0ed26864, 0x0e962f4a, 0x0e5a9fb9, 0x0e1fb905,
+	0x0de57a84, 0x0dabe382, 0x0d72f34d, 0x0d3aa92b,
+	0x0d03045e, 0x0ccc0428, 0x0c95a7c5, 0x0c5fee6c,
+	0x0c2ad753, 0x0bf661ab, 0x0bc28ca3, 0x0b8f5766,
+	0x0b5cc11c, 0x0b2ac8e8, 0x0af96dee, 0x0ac8af4b,
+	0x0a988c1b, 0x0a690377, 0x0a3a1475, 0x0a0bbe29,
+	0x09ddffa2, 0x09b0d7f1, 0x0984461f, 0x09584936,
+	0x092ce03e, 0x09020a3b, 0x08d7c62f, 0x08ae131b,
+	0x0884effd, 0x085c5bd1, 0x08345591, 0x080cdc36,
+	0x07e5eeb7, 0x07bf8c09, 0x0799b31e, 0x077462e8,
+	0x074f9a59, 0x072b585d, 0x07079be4, 0x06e463d8,
+	0x06c1af24, 0x069f7cb2, 0x067dcb6b, 0x065c9a35,
+	0x063be7f7, 0x061bb397, 0x05fbfbf8, 0x05dcbfff,
+	0x05bdfe8e, 0x059fb688, 0x0581e6cf, 0x05648e43,
+	0x0547abc4, 0x052b3e34, 0x050f4471, 0x04f3bd5b,
+	0x04d8a7d1, 0x04be02b2, 0x04a3ccdc, 0x048a052e,
+	0x0470aa86, 0x0457bbc3, 0x043f37c4, 0x04271d66,
+	0x040f6b89, 0x03f8210c, 0x03e13ccd, 0x03cabdad,
+	0x03b4a28b, 0x039eea47, 0x038993c3, 0x03749ddf,
+	0x0360077d, 0x034bcf80, 0x0337f4ca, 0x03247640,
+	0x031152c5, 0x02fe893f, 0x02ec1894, 0x02d9ffaa,
+	0x02c83d6b, 0x02b6d0bd, 0x02a5b88b, 0x0294f3c0,
+	0x02848148, 0x0274600f, 0x02648f03, 0x02550d14,
+	0x0245d932, 0x0236f24f, 0x0228575d, 0x021a0752,
+	0x020c0122, 0x01fe43c5, 0x01f0ce33, 0x01e39f67,
+	0x01d6b65b, 0x01ca120d, 0x01bdb17b, 0x01b193a5,
+	0x01a5b78d, 0x019a1c36, 0x018ec0a5, 0x0183a3e1,
+	0x0178c4f2, 0x016e22e3, 0x0163bcbf, 0x01599194,
+	0x014fa072, 0x0145e869, 0x013c688e, 0x01331ff6,
+	0x012a0db7, 0x012130eb, 0x011888ac, 0x01101418,
+	0x0107d24d, 0x00ffc26d, 0x00f7e39a, 0x00f034fa,
+	0x00e8b5b3, 0x00e164f0, 0x00da41da, 0x00d34ba1,
+	0x00cc8173, 0x00c5e282, 0x00bf6e02, 0x00b92329,
+	0x00b30130, 0x00ad0751, 0x00a734ca, 0x00a188d8,
+	0x009c02bd, 0x0096a1be, 0x0091651f, 0x008c4c29,
+	0x00875626, 0x00828263, 0x007dd02f, 0x00793edc,
+	0x0074cdbd, 0x00707c28, 0x006c4975, 0x00683500,
+	0x00643e26, 0x00606446, 0x005ca6c3, 0x00590500,
+	0x00557e64, 0x00521258, 0x004ec049, 0x004b87a4,
+	0x004867d9, 0x0045605c, 0x004270a1, 0x003f9821,
+	0x003cd655, 0x003a2abb, 0x003794d1, 0x00351419,
+	0x0032a817, 0x00305051, 0x002e0c52, 0x002bdba3,
+	0x0029bdd3, 0x0027b272, 0x0025b913, 0x0023d14c,
+	0x0021fab5, 0x002034e7, 0x001e7f80, 0x001cda1e,
+	0x001b4465, 0x0019bdf8, 0x0018467e, 0x0016dda0,
+	0x0015830b, 0x0014366c, 0x0012f775, 0x0011c5d8,
+	0x0010a14c, 0x000f8989, 0x000e7e4a, 0x000d7f4d,
+	0x000c8c50, 0x000ba518, 0x000ac967, 0x0009f907,
+	0x000933c1, 0x00087961, 0x0007c9b6, 0x00072493,
+	0x000689ca, 0x0005f932, 0x000572a5, 0x0004f5fe,
+	0x0004831b, 0x000419dd, 0x0003ba26, 0x000363dc,
+	0x000316e8, 0x0002d333, 0x000298ac, 0x00026742,
+	0x00023ee6, 0x00021f8e, 0x00020931, 0x0001fbc9,
+};
+
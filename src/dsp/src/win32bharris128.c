@@ -0,0 +1,38 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32bharris128[128] =
+{
+	0x0001f751, 0x000316e8, 0x000689ca, 0x000c8c50,
+	0x0015830b, 0x0021fab5, 0x0032a817, 0x004867d9,
+	0x00643e26, 0x00875626, 0x00b30130, 0x00e8b5b3,
+	0x012a0db7, 0x0178c4f2, 0x01d6b65b, 0x0245d932,
+	0x02c83d6b, 0x0360077d, 0x040f6b89, 0x04d8a7d1,
+	0x05bdfe8e, 0x06c1af24, 0x07e5eeb7, 0x092ce03e,
+	0x0a988c1b, 0x0c2ad753, 0x0de57a84, 0x0fc9f8b3,
+	0x11d99617, 0x14154f06, 0x167dcf26, 0x19136911,
+	0x1bd60e95, 0x1ec549ab, 0x21e03661, 0x25257dd2,
+	0x28935248, 0x2c276cbb, 0x2fdf0bb6, 0x33b6f3c6,
+	0x37ab717c, 0x3bb85d10, 0x3fd91fb1, 0x4408ba73,
+	0x4841cedb, 0x4c7ea8fc, 0x50b94b06, 0x54eb7a2f,
+	0x590eccd3, 0x5d1cb99c, 0x610ea790, 0x64ddfebc,
+	0x6884395a, 0x6bfaf531, 0x6f3c04e2, 0x72418107,
+	0x7505d8be, 0x7783e189, 0x79b6e62a, 0x7b9ab459,
+	0x7d2ba911, 0x7e66bb53, 0x7f49852a, 0x7fd24ad7,
+	0x7fffffff, 0x7fd24ad7, 0x7f49852a, 0x7e66bb53,
+	0x7d2ba911, 0x7b9ab459, 0x79b6e62a, 0x7783e189,
+	0x7505d8be, 0x72418107, 0x6f3c04e2, 0x6bfaf531,
+	0x6884395a, 0x64ddfebc, 0x610ea790, 0x5d1cb99c,
+	0x590eccd3, 0x54eb7a2f, 0x50b94b06, 0x4c7ea8fc,
+	0x4841cedb, 0x4408ba73, 0x3fd91fb1, 0x3bb85d10,
+	0x37ab717c, 0x33b6f3c6, 0x2fdf0bb6, 0x2c276cbb,
+	0x28935248, 0x25257dd2, 0x21e03661, 0x1ec549ab,
+	0x1bd60e95, 0x19136911, 0x167dcf26, 0x14154f06,
+	0x11d99617, 0x0fc9f8b3, 0x0de57a84, 0x0c2ad753,
+	0x0a988c1b, 0x092ce03e, 0x07e5eeb7, 0x06c1af24,
+	0x05bdfe8e, 0x04d8a7d1, 0x040f6b89, 0x0360077d,
+	0x02c83d6b, 0x0245d932, 0x01d6b65b, 0x0178c4f2,
+	0x012a0db7, 0x00e8b5b3, 0x00b30130, 0x00875626,
+	0x00643e26, 0x004867d9, 0x0032a817, 0x0021fab5,
+	0x0015830b, 0x000c8c50, 0x000689ca, 0x000316e8,
+};
+
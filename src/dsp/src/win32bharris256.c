@@ -0,0 +1,70 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32bharris256[256] =
+{
+	0x0001f751, 0x00023ee6, 0x000316e8, 0x0004831b,
+	0x000689ca, 0x000933c1, 0x000c8c50, 0x0010a14c,
+	0x0015830b, 0x001b4465, 0x0021fab5, 0x0029bdd3,
+	0x0032a817, 0x003cd655, 0x004867d9, 0x00557e64,
+	0x00643e26, 0x0074cdbd, 0x00875626, 0x009c02bd,
+	0x00b30130, 0x00cc8173, 0x00e8b5b3, 0x0107d24d,
+	0x012a0db7, 0x014fa072, 0x0178c4f2, 0x01a5b78d,
+	0x01d6b65b, 0x020c0122, 0x0245d932, 0x02848148,
+	0x02c83d6b, 0x031152c5, 0x0360077d, 0x03b4a28b,
+	0x040f6b89, 0x0470aa86, 0x04d8a7d1, 0x0547abc4,
+	0x05bdfe8e, 0x063be7f7, 0x06c1af24, 0x074f9a59,
+	0x07e5eeb7, 0x0884effd, 0x092ce03e, 0x09ddffa2,
+	0x0a988c1b, 0x0b5cc11c, 0x0c2ad753, 0x0d03045e,
+	0x0de57a84, 0x0ed26864, 0x0fc9f8b3, 0x10cc51ef,
+	0x11d99617, 0x12f1e265, 0x14154f06, 0x1543eed8,
+	0x167dcf26, 0x17c2f76a, 0x19136911, 0x1a6f1f3e,
+	0x1bd60e95, 0x1d482508, 0x1ec549ab, 0x204d5c81,
+	0x21e03661, 0x237da8cb, 0x25257dd2, 0x26d77800,
+	0x28935248, 0x2a58bffa, 0x2c276cbb, 0x2dfefc87,
+	0x2fdf0bb6, 0x31c72f0c, 0x33b6f3c6, 0x35addfbd,
+	0x37ab717c, 0x39af2070, 0x3bb85d10, 0x3dc69115,
+	0x3fd91fb1, 0x41ef65d5, 0x4408ba73, 0x46246ed1,
+	0x4841cedb, 0x4a60217b, 0x4c7ea8fc, 0x4e9ca36c,
+	0x50b94b06, 0x52d3d6a5, 0x54eb7a2f, 0x56ff6718,
+	0x590eccd3, 0x5b18d956, 0x5d1cb99c, 0x5f199a29,
+	0x610ea790, 0x62fb0efc, 0x64ddfebc, 0x66b6a6ca,
+	0x6884395a, 0x6a45eb65, 0x6bfaf531, 0x6da292db,
+	0x6f3c04e2, 0x70c690ac, 0x72418107, 0x73ac26ac,
+	0x7505d8be, 0x764df53f, 0x7783e189, 0x78a70abc,
+	0x79b6e62a, 0x7ab2f1be, 0x7b9ab459, 0x7c6dbe2d,
+	0x7d2ba911, 0x7dd418ca, 0x7e66bb53, 0x7ee34917,
+	0x7f49852a, 0x7f993d74, 0x7fd24ad7, 0x7ff4914e,
+	0x7fffffff, 0x7ff4914e, 0x7fd24ad7, 0x7f993d74,
+	0x7f49852a, 0x7ee34917, 0x7e66bb53, 0x7dd418ca,
+	0x7d2ba911, 0x7c6dbe2d, 0x7b9ab459, 0x7ab2f1be,
+	0x79b6e62a, 0x78a70abc, 0x7783e189, 0x764df53f,
+	0x7505d8be, 0x73ac26ac, 0x72418107, 0x70c690ac,
+	0x6f3c04e2, 0x6da292db, 0x6bfaf531, 0x6a45eb65,
+	0x6884395a, 0x66b6a6ca, 0x64ddfebc, 0x62fb0efc,
+	0x610ea790, 0x5f199a29, 0x5d1cb99c, 0x5b18d956,
+	0x590eccd3, 0x56ff6718, 0x54eb7a2f, 0x52d3d6a5,
+	0x50b94b06, 0x4e9ca36c, 0x4c7ea8fc, 0x4a60217b,
+	0x4841cedb, 0x46246ed1, 0x4408ba73, 0x41ef65d5,
+	0x3fd91fb1, 0x3dc69115, 0x3bb85d10, 0x39af2070,
+	0x37ab717c, 0x35addfbd, 0x33b6f3c6, 0x31c72f0c,
+	0x2fdf0bb6, 0x2dfefc87, 0x2c276cbb, 0x2a58bffa,
+	0x28935248, 0x26d77800, 0x25257dd2, 0x237da8cb,
+	0x21e03661, 0x204d5c81, 0x1ec549ab, 0x1d482508,
+	0x1bd60e95, 0x1a6f1f3e, 0x19136911, 0x17c2f76a,
+	0x167dcf26, 0x1543eed8, 0x14154f06, 0x12f1e265,
+	0x11d99617, 0x10cc51ef, 0x0fc9f8b3, 0x0ed26864,
+	0x0de57a84, 0x0d03045e, 0x0c2ad753, 0x0b5cc11c,
+	0x0a988c1b, 0x09ddffa2, 0x092ce03e, 0x0884effd,
+	0x07e5eeb7, 0x074f9a59, 0x06c1af24, 0x063be7f7,
+	0x05bdfe8e, 0x0547abc4, 0x04d8a7d1, 0x0470aa86,
+	0x040f6b89, 0x03b4a28b, 0x0360077d, 0x031152c5,
+	0x02c83d6b, 0x02848148, 0x0245d932, 0x020c0122,
+	0x01d6b65b, 0x01a5b78d, 0x0178c4f2, 0x014fa072,
+	0x012a0db7, 0x0107d24d, 0x00e8b5b3, 0x00cc8173,
+	0x00b30130, 0x009c02bd, 0x00875626, 0x0074cdbd,
+	0x00643e26, 0x00557e64, 0x004867d9, 0x003cd655,
+	0x0032a817, 0x0029bdd3, 0x0021fab5, 0x001b4465,
+	0x0015830b, 0x0010a14c, 0x000c8c50, 0x000933c1,
+	0x000689ca, 0x0004831b, 0x000316e8, 0x00023ee6,
+};
+
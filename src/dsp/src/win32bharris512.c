@@ -0,0 +1,134 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32bharris512[512] =
+{
+	0x0001f751, 0x00020931, 0x00023ee6, 0x000298ac,
+	0x000316e8, 0x0003ba26, 0x0004831b, 0x000572a5,
+	0x000689ca, 0x0007c9b6, 0x000933c1, 0x000ac967,
+	0x000c8c50, 0x000e7e4a, 0x0010a14c, 0x0012f775,
+	0x0015830b, 0x0018467e, 0x001b4465, 0x001e7f80,
+	0x0021fab5, 0x0025b913, 0x0029bdd3, 0x002e0c52,
+	0x0032a817, 0x003794d1, 0x003cd655, 0x004270a1,
+	0x004867d9, 0x004ec049, 0x00557e64, 0x005ca6c3,
+	0x00643e26, 0x006c4975, 0x0074cdbd, 0x007dd02f,
+	0x00875626, 0x0091651f, 0x009c02bd, 0x00a734ca,
+	0x00b30130, 0x00bf6e02, 0x00cc8173, 0x00da41da,
+	0x00e8b5b3, 0x00f7e39a, 0x0107d24d, 0x011888ac,
+	0x012a0db7, 0x013c688e, 0x014fa072, 0x0163bcbf,
+	0x0178c4f2, 0x018ec0a5, 0x01a5b78d, 0x01bdb17b,
+	0x01d6b65b, 0x01f0ce33, 0x020c0122, 0x0228575d,
+	0x0245d932, 0x02648f03, 0x02848148, 0x02a5b88b,
+	0x02c83d6b, 0x02ec1894, 0x031152c5, 0x0337f4ca,
+	0x0360077d, 0x038993c3, 0x03b4a28b, 0x03e13ccd,
+	0x040f6b89, 0x043f37c4, 0x0470aa86, 0x04a3ccdc,
+	0x04d8a7d1, 0x050f4471, 0x0547abc4, 0x0581e6cf,
+	0x05bdfe8e, 0x05fbfbf8, 0x063be7f7, 0x067dcb6b,
+	0x06c1af24, 0x07079be4, 0x074f9a59, 0x0799b31e,
+	0x07e5eeb7, 0x08345591, 0x0884effd, 0x08d7c62f,
+	0x092ce03e, 0x0984461f, 0x09ddffa2, 0x0a3a1475,
+	0x0a988c1b, 0x0af96dee, 0x0b5cc11c, 0x0bc28ca3,
+	0x0c2ad753, 0x0c95a7c5, 0x0d03045e, 0x0d72f34d,
+	0x0de57a84, 0x0e5a9fb9, 0x0ed26864, 0x0f4cd9bb,
+	0x0fc9f8b3, 0x1049c9f7, 0x10cc51ef, 0x115194b4,
+	0x11d99617, 0x12645997, 0x12f1e265, 0x1382335d,
+	0x14154f06, 0x14ab3792, 0x1543eed8, 0x15df7654,
+	0x167dcf26, 0x171efa0d, 0x17c2f76a, 0x1869c739,
+	0x19136911, 0x19bfdc25, 0x1a6f1f3e, 0x1b2130bc,
+	0x1bd60e95, 0x1c8db650, 0x1d482508, 0x1e055769,
+	0x1ec549ab, 0x1f87f796, 0x204d5c81, 0x2115734c,
+	0x21e03661, 0x22ad9fb7, 0x237da8cb, 0x24504aa5,
+	0x25257dd2, 0x25fd3a67, 0x26d77800, 0x27b42dbe,
+	0x28935248, 0x2974dbcb, 0x2a58bffa, 0x2b3ef40b,
+	0x2c276cbb, 0x2d121e4c, 0x2dfefc87, 0x2eedfab9,
+	0x2fdf0bb6, 0x30d221dc, 0x31c72f0c, 0x32be24b3,
+	0x33b6f3c6, 0x34b18cc6, 0x35addfbd, 0x36abdc42,
+	0x37ab717c, 0x38ac8e1f, 0x39af2070, 0x3ab31647,
+	0x3bb85d10, 0x3cbee1cc, 0x3dc69115, 0x3ecf571c,
+	0x3fd91fb1, 0x40e3d640, 0x41ef65d5, 0x42fbb91f,
+	0x4408ba73, 0x451653cc, 0x46246ed1, 0x4732f4d5,
+	0x4841cedb, 0x4950e599, 0x4a60217b, 0x4b6f6aa7,
+	0x4c7ea8fc, 0x4d8dc41d, 0x4e9ca36c, 0x4fab2e13,
+	0x50b94b06, 0x51c6e106, 0x52d3d6a5, 0x53e01248,
+	0x54eb7a2f, 0x55f5f476, 0x56ff6718, 0x5807b7f4,
+	0x590eccd3, 0x5a148b67, 0x5b18d956, 0x5c1b9c37,
+	0x5d1cb99c, 0x5e1c1713, 0x5f199a29, 0x60152874,
+	0x610ea790, 0x6205fd29, 0x62fb0efc, 0x63edc2dd,
+	0x64ddfebc, 0x65cba8a5, 0x66b6a6ca, 0x679edf84,
+	0x6884395a, 0x69669b02, 0x6a45eb65, 0x6b2211aa,
+	0x6bfaf531, 0x6cd07d9e, 0x6da292db, 0x6e711d1c,
+	0x6f3c04e2, 0x70033304, 0x70c690ac, 0x71860760,
+	0x72418107, 0x72f8e7e6, 0x73ac26ac, 0x745b2872,
+	0x7505d8be, 0x75ac2388, 0x764df53f, 0x76eb3ac9,
+	0x7783e189, 0x7817d762, 0x78a70abc, 0x79316a81,
+	0x79b6e62a, 0x7a376db8, 0x7ab2f1be, 0x7b296360,
+	0x7b9ab459, 0x7c06d6f9, 0x7c6dbe2d, 0x7ccf5d7d,
+	0x7d2ba911, 0x7d8295b1, 0x7dd418ca, 0x7e20286d,
+	0x7e66bb53, 0x7ea7c8dd, 0x7ee34917, 0x7f1934ba,
+	0x7f49852a, 0x7f74347c, 0x7f993d74, 0x7fb89b86,
+	0x7fd24ad7, 0x7fe64841, 0x7ff4914e, 0x7ffd243d,
+	0x7fffffff, 0x7ffd243d, 0x7ff4914e, 0x7fe64841,
+	0x7fd24ad7, 0x7fb89b86, 0x7f993d74, 0x7f74347c,
+	0x7f49852a, 0x7f1934ba, 0x7ee34917, 0x7ea7c8dd,
+	0x7e66bb53, 0x7e20286d, 0x7dd418ca, 0x7d8295b1,
+	0x7d2ba911, 0x7ccf5d7d, 0x7c6dbe2d, 0x7c06d6f9,
+	0x7b9ab459, 0x7b296360, 0x7ab2f1be, 0x7a376db8,
+	0x79b6e62a, 0x79316a81, 0x78a70abc, 0x7817d762,
+	0x7783e189, 0x76eb3ac9, 0x764df53f, 0x75ac2388,
+	0x7505d8be, 0x745b2872, 0x73ac26ac, 0x72f8e7e6,
+	0x72418107, 0x71860760, 0x70c690ac, 0x70033304,
+	0x6f3c04e2, 0x6e711d1c, 0x6da292db, 0x6cd07d9e,
+	0x6bfaf531, 0x6b2211aa, 0x6a45eb65, 0x69669b02,
+	0x6884395a, 0x679edf84, 0x66b6a6ca, 0x65cba8a5,
+	0x64ddfebc, 0x63edc2dd, 0x62fb0efc, 0x6205fd29,
+	0x610ea790, 0x60152874, 0x5f199a29, 0x5e1c1713,
+	0x5d1cb99c, 0x5c1b9c37, 0x5b18d956, 0x5a148b67,
+	0x590eccd3, 0x5807b7f4, 0x56ff6718, 0x55f5f476,
+	0x54eb7a2f, 0x53e01248, 0x52d3d6a5, 0x51c6e106,
+	0x50b94b06, 0x4fab2e13, 0x4e9ca36c, 0x4d8dc41d,
+	0x4c7ea8fc, 0x4b6f6aa7, 0x4a60217b, 0x4950e599,
+	0x4841cedb, 0x4732f4d5, 0x46246ed1, 0x451653cc,
+	0x4408ba73, 0x42fbb91f, 0x41ef65d5, 0x40e3d640,
+	0x3fd91fb1, 0x3ecf571c, 0x3dc69115, 0x3cbee1cc,
+	0x3bb85d10, 0x3ab31647, 0x39af2070, 0x38ac8e1f,
+	0x37ab717c, 0x36abdc42, 0x35addfbd, 0x34b18cc6,
+	0x33b6f3c6, 0x32be24b3, 0x31c72f0c, 0x30d221dc,
+	0x2fdf0bb6, 0x2eedfab9, 0x2dfefc87, 0x2d121e4c,
+	0x2c276cbb, 0x2b3ef40b, 0x2a58bffa, 0x2974dbcb,
+	0x28935248, 0x27b42dbe, 0x26d77800, 0x25fd3a67,
+	0x25257dd2, 0x24504aa5, 0x237da8cb, 0x22ad9fb7,
+	0x21e03661, 0x2115734c, 0x204d5c81, 0x1f87f796,
+	0x1ec549ab, 0x1e055769, 0x1d482508, 0x1c8db650,
+	0x1bd60e95, 0x1b2130bc, 0x1a6f1f3e, 0x19bfdc25,
+	0x19136911, 0x1869c739, 0x17c2f76a, 0x171efa0d,
+	0x167dcf26, 0x15df7654, 0x1543eed8, 0x14ab3792,
+	0x14154f06, 0x1382335d, 0x12f1e265, 0x12645997,
+	0x11d99617, 0x115194b4, 0x10cc51ef, 0x1049c9f7,
+	0x0fc9f8b3, 0x0f4cd9bb, 0x0ed26864, 0x0e5a9fb9,
+	0x0de57a84, 0x0d72f34d, 0x0d03045e, 0x0c95a7c5,
+	0x0c2ad753, 0x0bc28ca3, 0x0b5cc11c, 0x0af96dee,
+	0x0a988c1b, 0x0a3a1475, 0x09ddffa2, 0x0984461f,
+	0x092ce03e, 0x08d7c62f, 0x0884effd, 0x08345591,
+	0x07e5eeb7, 0x0799b31e, 0x074f9a59, 0x07079be4,
+	0x06c1af24, 0x067dcb6b, 0x063be7f7, 0x05fbfbf8,
+	0x05bdfe8e, 0x0581e6cf, 0x0547abc4, 0x050f4471,
+	0x04d8a7d1, 0x04a3ccdc, 0x0470aa86, 0x043f37c4,
+	0x040f6b89, 0x03e13ccd, 0x03b4a28b, 0x038993c3,
+	0x0360077d, 0x0337f4ca, 0x031152c5, 0x02ec1894,
+	0x02c83d6b, 0x02a5b88b, 0x02848148, 0x02648f03,
+	0x0245d932, 0x0228575d, 0x020c0122, 0x01f0ce33,
+	0x01d6b65b, 0x01bdb17b, 0x01a5b78d, 0x018ec0a5,
+	0x0178c4f2, 0x0163bcbf, 0x014fa072, 0x013c688e,
+	0x012a0db7, 0x011888ac, 0x0107d24d, 0x00f7e39a,
+	0x00e8b5b3, 0x00da41da, 0x00cc8173, 0x00bf6e02,
+	0x00b30130, 0x00a734ca, 0x009c02bd, 0x0091651f,
+	0x00875626, 0x007dd02f, 0x0074cdbd, 0x006c4975,
+	0x00643e26, 0x005ca6c3, 0x00557e64, 0x004ec049,
+	0x004867d9, 0x004270a1, 0x003cd655, 0x003794d1,
+	0x0032a817, 0x002e0c52, 0x0029bdd3, 0x0025b913,
+	0x0021fab5, 0x001e7f80, 0x001b4465, 0x0018467e,
+	0x0015830b, 0x0012f775, 0x0010a14c, 0x000e7e4a,
+	0x000c8c50, 0x000ac967, 0x000933c1, 0x0007c9b6,
+	0x000689ca, 0x000572a5, 0x0004831b, 0x0003ba26,
+	0x000316e8, 0x000298ac, 0x00023ee6, 0x00020931,
+};
+
@@ -0,0 +1,22 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32bharris64[64] =
+{
+	0x0001f751, 0x000689ca, 0x0015830b, 0x0032a817,
+	0x00643e26, 0x00b30130, 0x012a0db7, 0x01d6b65b,
+	0x02c83d6b, 0x040f6b89, 0x05bdfe8e, 0x07e5eeb7,
+	0x0a988c1b, 0x0de57a84, 0x11d99617, 0x167dcf26,
+	0x1bd60e95, 0x21e03661, 0x28935248, 0x2fdf0bb6,
+	0x37ab717c, 0x3fd91fb1, 0x4841cedb, 0x50b94b06,
+	0x590eccd3, 0x610ea790, 0x6884395a, 0x6f3c04e2,
+	0x7505d8be, 0x79b6e62a, 0x7d2ba911, 0x7f49852a,
+	0x7fffffff, 0x7f49852a, 0x7d2ba911, 0x79b6e62a,
+	0x7505d8be, 0x6f3c04e2, 0x6884395a, 0x610ea790,
+	0x590eccd3, 0x50b94b06, 0x4841cedb, 0x3fd91fb1,
+	0x37ab717c, 0x2fdf0bb6, 0x28935248, 0x21e03661,
+	0x1bd60e95, 0x167dcf26, 0x11d99617, 0x0de57a84,
+	0x0a988c1b, 0x07e5eeb7, 0x05bdfe8e, 0x040f6b89,
+	0x02c83d6b, 0x01d6b65b, 0x012a0db7, 0x00b30130,
+	0x00643e26, 0x0032a817, 0x0015830b, 0x000689ca,
+};
+
@@ -0,0 +1,262 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32flattop1024[1024] =
+{
+	0xfff233f8, 0xfff22bdb, 0xfff21383, 0xfff1eaec,
+	0xfff1b20e, 0xfff168e0, 0xfff10f52, 0xfff0a556,
+	0xfff02ad8, 0xffef9fc3, 0xffef03fc, 0xffee5769,
+	0xffed99eb, 0xffeccb5f, 0xffebeba3, 0xffeafa8d,
+	0xffe9f7f5, 0xffe8e3ae, 0xffe7bd88, 0xffe68550,
+	0xffe53ad3, 0xffe3ddd8, 0xffe26e26, 0xffe0eb7f,
+	0xffdf55a5, 0xffddac55, 0xffdbef4b, 0xffda1e41,
+	0xffd838ee, 0xffd63f07, 0xffd4303d, 0xffd20c41,
+	0xffcfd2c0, 0xffcd8368, 0xffcb1de1, 0xffc8a1d3,
+	0xffc60ee4, 0xffc364b8, 0xffc0a2f1, 0xffbdc92f,
+	0xffbad711, 0xffb7cc33, 0xffb4a831, 0xffb16aa5,
+	0xffae1328, 0xffaaa14f, 0xffa714b1, 0xffa36ce2,
+	0xff9fa976, 0xff9bc9ff, 0xff97ce0e, 0xff93b533,
+	0xff8f7eff, 0xff8b2aff, 0xff86b8c2, 0xff8227d6,
+	0xff7d77c8, 0xff78a824, 0xff73b877, 0xff6ea84c,
+	0xff697732, 0xff6424b2, 0xff5eb05a, 0xff5919b6,
+	0xff536053, 0xff4d83bd, 0xff478382, 0xff415f31,
+	0xff3b1659, 0xff34a888, 0xff2e154f, 0xff275c41,
+	0xff207cf0, 0xff1976ef, 0xff1249d5, 0xff0af537,
+	0xff0378af, 0xfefbd3d6, 0xfef40649, 0xfeec0fa5,
+	0xfee3ef8a, 0xfedba59a, 0xfed3317a, 0xfeca92d0,
+	0xfec1c945, 0xfeb8d486, 0xfeafb442, 0xfea66829,
+	0xfe9ceff1, 0xfe934b52, 0xfe897a06, 0xfe7f7bcd,
+	0xfe755067, 0xfe6af79c, 0xfe607134, 0xfe55bcfc,
+	0xfe4adac8, 0xfe3fca6b, 0xfe348bc0, 0xfe291ea6,
+	0xfe1d82ff, 0xfe11b8b2, 0xfe05bfae, 0xfdf997e2,
+	0xfded4146, 0xfde0bbd5, 0xfdd40790, 0xfdc7247e,
+	0xfdba12ab, 0xfdacd229, 0xfd9f630f, 0xfd91c57c,
+	0xfd83f992, 0xfd75ff7d, 0xfd67d76d, 0xfd598198,
+	0xfd4afe3c, 0xfd3c4d9d, 0xfd2d7007, 0xfd1e65cb,
+	0xfd0f2f44, 0xfcffccd1, 0xfcf03eda, 0xfce085cf,
+	0xfcd0a226, 0xfcc0945e, 0xfcb05cfe, 0xfc9ffc93,
+	0xfc8f73b4, 0xfc7ec300, 0xfc6deb1e, 0xfc5cecbc,
+	0xfc4bc893, 0xfc3a7f62, 0xfc2911f2, 0xfc178115,
+	0xfc05cda6, 0xfbf3f888, 0xfbe202a8, 0xfbcfecfb,
+	0xfbbdb880, 0xfbab6640, 0xfb98f74d, 0xfb866cc1,
+	0xfb73c7c2, 0xfb61097e, 0xfb4e332d, 0xfb3b4611,
+	0xfb284377, 0xfb152cb3, 0xfb020327, 0xfaeec83b,
+	0xfadb7d64, 0xfac82420, 0xfab4bdf7, 0xfaa14c7d,
+	0xfa8dd14e, 0xfa7a4e11, 0xfa66c478, 0xfa533640,
+	0xfa3fa52f, 0xfa2c1317, 0xfa1881d2, 0xfa04f348,
+	0xf9f16968, 0xf9dde62f, 0xf9ca6ba1, 0xf9b6fbd0,
+	0xf9a398d7, 0xf99044db, 0xf97d020b, 0xf969d2a4,
+	0xf956b8ea, 0xf943b72c, 0xf930cfc5, 0xf91e051a,
+	0xf90b5999, 0xf8f8cfbd, 0xf8e66a08, 0xf8d42b09,
+	0xf8c21558, 0xf8b02b97, 0xf89e7074, 0xf88ce6a4,
+	0xf87b90e9, 0xf86a720d, 0xf8598ce4, 0xf848e44d,
+	0xf8387b2f, 0xf828547b, 0xf818732c, 0xf808da46,
+	0xf7f98cd7, 0xf7ea8df4, 0xf7dbe0bf, 0xf7cd885e,
+	0xf7bf8802, 0xf7b1e2e7, 0xf7a49c4d, 0xf797b77f,
+	0xf78b37d0, 0xf77f209b, 0xf7737542, 0xf7683930,
+	0xf75d6fd6, 0xf7531cad, 0xf7494336, 0xf73fe6f8,
+	0xf7370b81, 0xf72eb466, 0xf726e542, 0xf71fa1b7,
+	0xf718ed6b, 0xf712cc0d, 0xf70d414d, 0xf70850e6,
+	0xf703fe92, 0xf7004e16, 0xf6fd4336, 0xf6fae1be,
+	0xf6f92d7e, 0xf6f82a48, 0xf6f7dbf2, 0xf6f84658,
+	0xf6f96d55, 0xf6fb54ca, 0xf6fe0099, 0xf70174a7,
+	0xf705b4da, 0xf70ac51c, 0xf710a956, 0xf7176572,
+	0xf71efd5e, 0xf7277504, 0xf730d052, 0xf73b1333,
+	0xf7464194, 0xf7525f60, 0xf75f7082, 0xf76d78e1,
+	0xf77c7c65, 0xf78c7ef3, 0xf79d846d, 0xf7af90b4,
+	0xf7c2a7a4, 0xf7d6cd16, 0xf7ec04e1, 0xf80252d5,
+	0xf819bac1, 0xf832406b, 0xf84be798, 0xf866b404,
+	0xf882a968, 0xf89fcb75, 0xf8be1dd6, 0xf8dda42f,
+	0xf8fe621b, 0xf9205b31, 0xf94392fc, 0xf9680d01,
+	0xf98dccbb, 0xf9b4d59c, 0xf9dd2b0e, 0xfa06d06e,
+	0xfa31c911, 0xfa5e1840, 0xfa8bc13b, 0xfabac734,
+	0xfaeb2d51, 0xfb1cf6af, 0xfb50265c, 0xfb84bf58,
+	0xfbbac498, 0xfbf23902, 0xfc2b1f6f, 0xfc657aa8,
+	0xfca14d68, 0xfcde9a5b, 0xfd1d641d, 0xfd5dad39,
+	0xfd9f782d, 0xfde2c762, 0xfe279d33, 0xfe6dfbe9,
+	0xfeb5e5ba, 0xfeff5ccc, 0xff4a6330, 0xff96fae6,
+	0xffe525db, 0x0034e5e8, 0x00863cd0, 0x00d92c46,
+	0x012db5e5, 0x0183db36, 0x01db9da9, 0x0234fe9c,
+	0x028fff56, 0x02eca107, 0x034ae4cb, 0x03aacba4,
+	0x040c5680, 0x046f8633, 0x04d45b7c, 0x053ad700,
+	0x05a2f94c, 0x060cc2d6, 0x067833fb, 0x06e54cfd,
+	0x07540e08, 0x07c4772b, 0x0836885e, 0x08aa417e,
+	0x091fa24d, 0x0996aa75, 0x0a0f5982, 0x0a89aee8,
+	0x0b05aa00, 0x0b834a05, 0x0c028e19, 0x0c837541,
+	0x0d05fe68, 0x0d8a285b, 0x0e0ff1cd, 0x0e975952,
+	0x0f205d64, 0x0faafc61, 0x10373487, 0x10c503fa,
+	0x115468c0, 0x11e560c3, 0x1277e9d0, 0x130c0195,
+	0x13a1a5a4, 0x1438d372, 0x14d18857, 0x156bc18b,
+	0x16077c2d, 0x16a4b53a, 0x17436994, 0x17e39600,
+	0x18853724, 0x19284988, 0x19ccc999, 0x1a72b3a5,
+	0x1b1a03dc, 0x1bc2b653, 0x1c6cc6fd, 0x1d1831b6,
+	0x1dc4f238, 0x1e730423, 0x1f2262f7, 0x1fd30a19,
+	0x2084f4d2, 0x21381e4c, 0x21ec8197, 0x22a219a6,
+	0x2358e14e, 0x2410d349, 0x24c9ea37, 0x25842099,
+	0x263f70d7, 0x26fbd53e, 0x27b947fd, 0x2877c32b,
+	0x293740c4, 0x29f7baa8, 0x2ab92a9e, 0x2b7b8a53,
+	0x2c3ed35c, 0x2d02ff32, 0x2dc80736, 0x2e8de4b1,
+	0x2f5490d3, 0x301c04b4, 0x30e43954, 0x31ad279d,
+	0x3276c860, 0x33411458, 0x340c042a, 0x34d79065,
+	0x35a3b182, 0x36705fe5, 0x373d93de, 0x380b45a8,
+	0x38d96d69, 0x39a80336, 0x3a76ff0d, 0x3b4658de,
+	0x3c160884, 0x3ce605c8, 0x3db64864, 0x3e86c7fe,
+	0x3f577c2f, 0x40285c7e, 0x40f96063, 0x41ca7f47,
+	0x429bb087, 0x436ceb70, 0x443e2740, 0x450f5b2d,
+	0x45e07e5d, 0x46b187ec, 0x47826eea, 0x48532a5d,
+	0x4923b142, 0x49f3fa8a, 0x4ac3fd1f, 0x4b93afe3,
+	0x4c6309af, 0x4d320157, 0x4e008da5, 0x4ecea561,
+	0x4f9c3f4c, 0x50695221, 0x5135d498, 0x5201bd67,
+	0x52cd033f, 0x53979cd0, 0x546180c7, 0x552aa5d1,
+	0x55f3029b, 0x56ba8dd2, 0x57813e23, 0x58470a3e,
+	0x590be8d4, 0x59cfd098, 0x5a92b843, 0x5b549691,
+	0x5c156240, 0x5cd51219, 0x5d939ce5, 0x5e50f977,
+	0x5f0d1eaa, 0x5fc8035e, 0x60819e7e, 0x6139e6fd,
+	0x61f0d3d8, 0x62a65c17, 0x635a76cd, 0x640d1b19,
+	0x64be4024, 0x656ddd29, 0x661be96b, 0x66c85c3f,
+	0x67732d09, 0x681c533a, 0x68c3c654, 0x69697ded,
+	0x6a0d71a7, 0x6aaf993a, 0x6b4fec70, 0x6bee6324,
+	0x6c8af548, 0x6d259ae0, 0x6dbe4c05, 0x6e5500e8,
+	0x6ee9b1cd, 0x6f7c5711, 0x700ce928, 0x709b609c,
+	0x7127b611, 0x71b1e245, 0x7239de0c, 0x72bfa258,
+	0x73432833, 0x73c468c3, 0x74435d49, 0x74bfff22,
+	0x753a47ca, 0x75b230d6, 0x7627b3fc, 0x769acb0f,
+	0x770b6fff, 0x77799cdd, 0x77e54bd8, 0x784e7741,
+	0x78b51986, 0x79192d38, 0x797aad0a, 0x79d993cd,
+	0x7a35dc78, 0x7a8f8221, 0x7ae68003, 0x7b3ad17a,
+	0x7b8c7208, 0x7bdb5d50, 0x7c278f1b, 0x7c710355,
+	0x7cb7b610, 0x7cfba383, 0x7d3cc808, 0x7d7b2023,
+	0x7db6a879, 0x7def5dd7, 0x7e253d33, 0x7e5843a6,
+	0x7e886e70, 0x7eb5bafb, 0x7ee026d5, 0x7f07afb6,
+	0x7f2c537b, 0x7f4e102a, 0x7f6ce3f3, 0x7f88cd2a,
+	0x7fa1ca4e, 0x7fb7da05, 0x7fcafb1f, 0x7fdb2c92,
+	0x7fe86d80, 0x7ff2bd30, 0x7ffa1b13, 0x7ffe86c5,
+	0x7fffffff, 0x7ffe86c5, 0x7ffa1b13, 0x7ff2bd30,
+	0x7fe86d80, 0x7fdb2c92, 0x7fcafb1f, 0x7fb7da05,
+	0x7fa1ca4e, 0x7f88cd2a, 0x7f6ce3f3, 0x7f4e102a,
+	0x7f2c537b, 0x7f07afb6, 0x7ee026d5, 0x7eb5bafb,
+	0x7e886e70, 0x7e5843a6, 0x7e253d33, 0x7def5dd7,
+	0x7db6a879, 0x7d7b2023, 0x7d3cc808, 0x7cfba383,
+	0x7cb7b610, 0x7c710355, 0x7c278f1b, 0x7bdb5d50,
+	0x7b8c7208, 0x7b3ad17a, 0x7ae68003, 0x7a8f8221,
+	0x7a35dc78, 0x79d993cd, 0x797aad0a, 0x79192d38,
+	0x78b51986, 0x784e7741, 0x77e54bd8, 0x77799cdd,
+	0x770b6fff, 0x769acb0f, 0x7627b3fc, 0x75b230d6,
+	0x753a47ca, 0x74bfff22, 0x74435d49, 0x73c468c3,
+	0x73432833, 0x72bfa258, 0x7239de0c, 0x71b1e245,
+	0x7127b611, 0x709b609c, 0x700ce928, 0x6f7c5711,
+	0x6ee9b1cd, 0x6e5500e8, 0x6dbe4c05, 0x6d259ae0,
+	0x6c8af548, 0x6bee6324, 0x6b4fec70, 0x6aaf993a,
+	0x6a0d71a7, 0x69697ded, 0x68c3c654, 0x681c533a,
+	0x67732d09, 0x66c85c3f, 0x661be96b, 0x656ddd29,
+	0x64be4024, 0x640d1b19, 0x635a76cd, 0x62a65c17,
+	0x61f0d3d8, 0x6139e6fd, 0x60819e7e, 0x5fc8035e,
+	0x5f0d1eaa, 0x5e50f977, 0x5d939ce5, 0x5cd51219,
+	0x5c156240, 0x5b549691, 0x5a92b843, 0x59cfd098,
+	0x590be8d4, 0x58470a3e, 0x57813e23, 0x56ba8dd2,
+	0x55f3029b, 0x552aa5d1, 0x546180c7, 0x53979cd0,
+	0x52cd033f, 0x5201bd67, 0x5135d498, 0x50695221,
+	0x4f9c3f4c, 0x4ecea561, 0x4e008da5, 0x4d320157,
+	0x4c6309af, 0x4b93afe3, 0x4ac3fd1f, 0x49f3fa8a,
+	0x4923b142, 0x48532a5d, 0x47826eea, 0x46b187ec,
+	0x45e07e5d, 0x450f5b2d, 0x443e2740, 0x436ceb70,
+	0x429bb087, 0x41ca7f47, 0x40f96063, 0x40285c7e,
+	0x3f577c2f, 0x3e86c7fe, 0x3db64864, 0x3ce605c8,
+	0x3c160884, 0x3b4658de, 0x3a76ff0d, 0x39a80336,
+	0x38d96d69, 0x380b45a8, 0x373d93de, 0x36705fe5,
+	0x35a3b182, 0x34d79065, 0x340c042a, 0x33411458,
+	0x3276c860, 0x31ad279d, 0x30e43954, 0x301c04b4,
+	0x2f5490d3, 0x2e8de4b1, 0x2dc80736, 0x2d02ff32,
+	0x2c3ed35c, 0x2b7b8a53, 0x2ab92a9e, 0x29f7baa8,
+	0x293740c4, 0x2877c32b, 0x27b947fd, 0x26fbd53e,
+	0x263f70d7, 0x25842099, 0x24c9ea37, 0x2410d349,
+	0x2358e14e, 0x22a219a6, 0x21ec8197, 0x21381e4c,
+	0x2084f4d2, 0x1fd30a19, 0x1f2262f7, 0x1e730423,
+	0x1dc4f238, 0x1d1831b6, 0x1c6cc6fd, 0x1bc2b653,
+	0x1b1a03dc, 0x1a72b3a5, 0x19ccc999, 0x19284988,
+	0x18853724, 0x17e39600, 0x17436994, 0x16a4b53a,
+	0x16077c2d, 0x156bc18b, 0x14d18857, 0x1438d372,
+	0x13a1a5a4, 0x130c0195, 0x1277e9d0, 0x11e560c3,
+	0x115468c0, 0x10c503fa, 0x10373487, 0x0faafc61,
+	0x0f205d64, 0x0e975952, 0x0e0ff1cd, 0x0d8a285b,
+	0x0d05fe68, 0x0c837541, 0x0c028e19, 0x0b834a05,
+	0x0b05aa00, 0x0a89aee8, 0x0a0f5982, 0x0996aa75,
+	0x091fa24d, 0x08aa417e, 0x0836885e, 0x07c4772b,
+	0x07540e08, 0x06e54cfd, 0x067833fb, 0x060cc2d6,
+	0x05a2f94c, 0x053ad700, 0x04d45b7c, 0x046f8633,
+	0x040c5680, 0x03aacba4, 0x034ae4cb, 0x02eca107,
+	0x028fff56, 0x0234fe9c, 0x01db9da9, 0x0183db36,
+	0x012db5e5, 0x00d92c46, 0x00863cd0, 0x0034e5e8,
+	0xffe525db, 0xff96fae6, 0xff4a6330, 0xfeff5ccc,
+	0xfeb5e5ba, 0xfe6dfbe9, 0xfe279d33, 0xfde2c762,
+	0xfd9f782d, 0xfd5dad39, 0xfd1d641d, 0xfcde9a5b,
+	0xfca14d68, 0xfc657aa8, 0xfc2b1f6f, 0xfbf23902,
+	0xfbbac498, 0xfb84bf58, 0xfb50265c, 0xfb1cf6af,
+	0xfaeb2d51, 0xfabac734, 0xfa8bc13b, 0xfa5e1840,
+	0xfa31c911, 0xfa06d06e, 0xf9dd2b0e, 0xf9b4d59c,
+	0xf98dccbb, 0xf9680d01, 0xf94392fc, 0xf9205b31,
+	0xf8fe621b, 0xf8dda42f, 0xf8be1dd6, 0xf89fcb75,
+	0xf882a968, 0xf866b404, 0xf84be798, 0xf832406b,
+	0xf819bac1, 0xf80252d5, 0xf7ec04e1, 0xf7d6cd16,
+	0xf7c2a7a4, 0xf7af90b4, 0xf79d846d, 0xf78c7ef3,
+	0xf77c7c65, 0xf76d78e1, 0xf75f7082, 0xf7525f60,
+	0xf7464194, 0xf73b1333, 0xf730d052, 0xf7277504,
+	0xf71efd5e, 0xf7176572, 0xf710a956, 0xf70ac51c,
+	0xf705b4da, 0xf70174a7, 0xf6fe0099, 0xf6fb54ca,
+	0xf6f96d55, 0xf6f84658, 0xf6f7dbf2, 0xf6f82a48,
+	0xf6f92d7e, 0xf6fae1be, 0xf6fd4336, 0xf7004e16,
+	0xf703fe92, 0xf70850e6, 0xf70d414d, 0xf712cc0d,
+	0xf718ed6b, 0xf71fa1b7, 0xf726e542, 0xf72eb466,
+	0xf7370b81, 0xf73fe6f8, 0xf7494336, 0xf7531cad,
+	0xf75d6fd6, 0xf7683930, 0xf7737542, 0xf77f209b,
+	0xf78b37d0, 0xf797b77f, 0xf7a49c4d, 0xf7b1e2e7,
+	0xf7bf8802, 0xf7cd885e, 0xf7dbe0bf, 0xf7ea8df4,
+	0xf7f98cd7, 0xf808da46, 0xf818732c, 0xf828547b,
+	0xf8387b2f, 0xf848e44d, 0xf8598ce4, 0xf86a720d,
+	0xf87b90e9, 0xf88ce6a4, 0xf89e7074, 0xf8b02b97,
+	0xf8c21558, 0xf8d42b09, 0xf8e66a08, 0xf8f8cfbd,
+	0xf90b5999, 0xf91e051a, 0xf930cfc5, 0xf943b72c,
+	0xf956b8ea, 0xf969d2a4, 0xf97d020b, 0xf99044db,
+	0xf9a398d7, 0xf9b6fbd0, 0xf9ca6ba1, 0xf9dde62f,
+	0xf9f16968, 0xfa04f348, 0xfa1881d2, 0xfa2c1317,
+	0xfa3fa52f, 0xfa533640, 0xfa66c478, 0xfa7a4e11,
+	0xfa8dd14e, 0xfaa14c7d, 0xfab4bdf7, 0xfac82420,
+	0xfadb7d64, 0xfaeec83b, 0xfb020327, 0xfb152cb3,
+	0xfb284377, 0xfb3b4611, 0xfb4e332d, 0xfb61097e,
+	0xfb73c7c2, 0xfb866cc1, 0xfb98f74d, 0xfbab6640,
+	0xfbbdb880, 0xfbcfecfb, 0xfbe202a8, 0xfbf3f888,
+	0xfc05cda6, 0xfc178115, 0xfc2911f2, 0xfc3a7f62,
+	0xfc4bc893, 0xfc5cecbc, 0xfc6deb1e, 0xfc7ec300,
+	0xfc8f73b4, 0xfc9ffc93, 0xfcb05cfe, 0xfcc0945e,
+	0xfcd0a226, 0xfce085cf, 0xfcf03eda, 0xfcffccd1,
+	0xfd0f2f44, 0xfd1e65cb, 0xfd2d7007, 0xfd3c4d9d,
+	0xfd4afe3c, 0xfd598198, 0xfd67d76d, 0xfd75ff7d,
+	0xfd83f992, 0xfd91c57c, 0xfd9f630f, 0xfdacd229,
+	0xfdba12ab, 0xfdc7247e, 0xfdd40790, 0xfde0bbd5,
+	0xfded4146, 0xfdf997e2, 0xfe05bfae, 0xfe11b8b2,
+	0xfe1d82ff, 0xfe291ea6, 0xfe348bc0, 0xfe3fca6b,
+	0xfe4adac8, 0xfe55bcfc, 0xfe607134, 0xfe6af79c,
+	0xfe755067, 0xfe7f7bcd, 0xfe897a06, 0xfe934b52,
+	0xfe9ceff1, 0xfea66829, 0xfeafb442, 0xfeb8d486,
+	0xfec1c945, 0xfeca92d0, 0xfed3317a, 0xfedba59a,
+	0xfee3ef8a, 0xfeec0fa5, 0xfef40649, 0xfefbd3d6,
+	0xff0378af, 0xff0af537, 0xff1249d5, 0xff1976ef,
+	0xff207cf0, 0xff275c41, 0xff2e154f, 0xff34a888,
+	0xff3b1659, 0xff415f31, 0xff478382, 0xff4d83bd,
+	0xff536053, 0xff5919b6, 0xff5eb05a, 0xff6424b2,
+	0xff697732, 0xff6ea84c, 0xff73b877, 0xff78a824,
+	0xff7d77c8, 0xff8227d6, 0xff86b8c2, 0xff8b2aff,
+	0xff8f7eff, 0xff93b533, 0xff97ce0e, 0xff9bc9ff,
+	0xff9fa976, 0xffa36ce2, 0xffa714b1, 0xffaaa14f,
+	0xffae1328, 0xffb16aa5, 0xffb4a831, 0xffb7cc33,
+	0xffbad711, 0xffbdc92f, 0xffc0a2f1, 0xffc364b8,
+	0xffc60ee4, 0xffc8a1d3, 0xffcb1de1, 0xffcd8368,
+	0xffcfd2c0, 0xffd20c41, 0xffd4303d, 0xffd63f07,
+	0xffd838ee, 0xffda1e41, 0xffdbef4b, 0xffddac55,
+	0xffdf55a5, 0xffe0eb7f, 0xffe26e26, 0xffe3ddd8,
+	0xffe53ad3, 0xffe68550, 0xffe7bd88, 0xffe8e3ae,
+	0xffe9f7f5, 0xffeafa8d, 0xffebeba3, 0xffeccb5f,
+	0xffed99eb, 0xffee5769, 0xffef03fc, 0xffef9fc3,
+	0xfff02ad8, 0xfff0a556, 0xfff10f52, 0xfff168e0,
+	0xfff1b20e, 0xfff1eaec, 0xfff21383, 0xfff22bdb,
+};
+
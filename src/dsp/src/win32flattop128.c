@@ -0,0 +1,38 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32flattop128[128] =
+{
+	0xfff233f8, 0xfff02ad8, 0xffe9f7f5, 0xffdf55a5,
+	0xffcfd2c0, 0xffbad711, 0xff9fa976, 0xff7d77c8,
+	0xff536053, 0xff207cf0, 0xfee3ef8a, 0xfe9ceff1,
+	0xfe4adac8, 0xfded4146, 0xfd83f992, 0xfd0f2f44,
+	0xfc8f73b4, 0xfc05cda6, 0xfb73c7c2, 0xfadb7d64,
+	0xfa3fa52f, 0xf9a398d7, 0xf90b5999, 0xf87b90e9,
+	0xf7f98cd7, 0xf78b37d0, 0xf7370b81, 0xf703fe92,
+	0xf6f96d55, 0xf71efd5e, 0xf77c7c65, 0xf819bac1,
+	0xf8fe621b, 0xfa31c911, 0xfbbac498, 0xfd9f782d,
+	0xffe525db, 0x028fff56, 0x05a2f94c, 0x091fa24d,
+	0x0d05fe68, 0x115468c0, 0x16077c2d, 0x1b1a03dc,
+	0x2084f4d2, 0x263f70d7, 0x2c3ed35c, 0x3276c860,
+	0x38d96d69, 0x3f577c2f, 0x45e07e5d, 0x4c6309af,
+	0x52cd033f, 0x590be8d4, 0x5f0d1eaa, 0x64be4024,
+	0x6a0d71a7, 0x6ee9b1cd, 0x73432833, 0x770b6fff,
+	0x7a35dc78, 0x7cb7b610, 0x7e886e70, 0x7fa1ca4e,
+	0x7fffffff, 0x7fa1ca4e, 0x7e886e70, 0x7cb7b610,
+	0x7a35dc78, 0x770b6fff, 0x73432833, 0x6ee9b1cd,
+	0x6a0d71a7, 0x64be4024, 0x5f0d1eaa, 0x590be8d4,
+	0x52cd033f, 0x4c6309af, 0x45e07e5d, 0x3f577c2f,
+	0x38d96d69, 0x3276c860, 0x2c3ed35c, 0x263f70d7,
+	0x2084f4d2, 0x1b1a03dc, 0x16077c2d, 0x115468c0,
+	0x0d05fe68, 0x091fa24d, 0x05a2f94c, 0x028fff56,
+	0xffe525db, 0xfd9f782d, 0xfbbac498, 0xfa31c911,
+	0xf8fe621b, 0xf819bac1, 0xf77c7c65, 0xf71efd5e,
+	0xf6f96d55, 0xf703fe92, 0xf7370b81, 0xf78b37d0,
+	0xf7f98cd7, 0xf87b90e9, 0xf90b5999, 0xf9a398d7,
+	0xfa3fa52f, 0xfadb7d64, 0xfb73c7c2, 0xfc05cda6,
+	0xfc8f73b4, 0xfd0f2f44, 0xfd83f992, 0xfded4146,
+	0xfe4adac8, 0xfe9ceff1, 0xfee3ef8a, 0xff207cf0,
+	0xff536053, 0xff7d77c8, 0xff9fa976, 0xffbad711,
+	0xffcfd2c0, 0xffdf55a5, 0xffe9f7f5, 0xfff02ad8,
+};
+
@@ -0,0 +1,70 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32flattop256[256] =
+{
+	0xfff233f8, 0xfff1b20e, 0xfff02ad8, 0xffed99eb,
+	0xffe9f7f5, 0xffe53ad3, 0xffdf55a5, 0xffd838ee,
+	0xffcfd2c0, 0xffc60ee4, 0xffbad711, 0xffae1328,
+	0xff9fa976, 0xff8f7eff, 0xff7d77c8, 0xff697732,
+	0xff536053, 0xff3b1659, 0xff207cf0, 0xff0378af,
+	0xfee3ef8a, 0xfec1c945, 0xfe9ceff1, 0xfe755067,
+	0xfe4adac8, 0xfe1d82ff, 0xfded4146, 0xfdba12ab,
+	0xfd83f992, 0xfd4afe3c, 0xfd0f2f44, 0xfcd0a226,
+	0xfc8f73b4, 0xfc4bc893, 0xfc05cda6, 0xfbbdb880,
+	0xfb73c7c2, 0xfb284377, 0xfadb7d64, 0xfa8dd14e,
+	0xfa3fa52f, 0xf9f16968, 0xf9a398d7, 0xf956b8ea,
+	0xf90b5999, 0xf8c21558, 0xf87b90e9, 0xf8387b2f,
+	0xf7f98cd7, 0xf7bf8802, 0xf78b37d0, 0xf75d6fd6,
+	0xf7370b81, 0xf718ed6b, 0xf703fe92, 0xf6f92d7e,
+	0xf6f96d55, 0xf705b4da, 0xf71efd5e, 0xf7464194,
+	0xf77c7c65, 0xf7c2a7a4, 0xf819bac1, 0xf882a968,
+	0xf8fe621b, 0xf98dccbb, 0xfa31c911, 0xfaeb2d51,
+	0xfbbac498, 0xfca14d68, 0xfd9f782d, 0xfeb5e5ba,
+	0xffe525db, 0x012db5e5, 0x028fff56, 0x040c5680,
+	0x05a2f94c, 0x07540e08, 0x091fa24d, 0x0b05aa00,
+	0x0d05fe68, 0x0f205d64, 0x115468c0, 0x13a1a5a4,
+	0x16077c2d, 0x18853724, 0x1b1a03dc, 0x1dc4f238,
+	0x2084f4d2, 0x2358e14e, 0x263f70d7, 0x293740c4,
+	0x2c3ed35c, 0x2f5490d3, 0x3276c860, 0x35a3b182,
+	0x38d96d69, 0x3c160884, 0x3f577c2f, 0x429bb087,
+	0x45e07e5d, 0x4923b142, 0x4c6309af, 0x4f9c3f4c,
+	0x52cd033f, 0x55f3029b, 0x590be8d4, 0x5c156240,
+	0x5f0d1eaa, 0x61f0d3d8, 0x64be4024, 0x67732d09,
+	0x6a0d71a7, 0x6c8af548, 0x6ee9b1cd, 0x7127b611,
+	0x73432833, 0x753a47ca, 0x770b6fff, 0x78b51986,
+	0x7a35dc78, 0x7b8c7208, 0x7cb7b610, 0x7db6a879,
+	0x7e886e70, 0x7f2c537b, 0x7fa1ca4e, 0x7fe86d80,
+	0x7fffffff, 0x7fe86d80, 0x7fa1ca4e, 0x7f2c537b,
+	0x7e886e70, 0x7db6a879, 0x7cb7b610, 0x7b8c7208,
+	0x7a35dc78, 0x78b51986, 0x770b6fff, 0x753a47ca,
+	0x73432833, 0x7127b611, 0x6ee9b1cd, 0x6c8af548,
+	0x6a0d71a7, 0x67732d09, 0x64be4024, 0x61f0d3d8,
+	0x5f0d1eaa, 0x5c156240, 0x590be8d4, 0x55f3029b,
+	0x52cd033f, 0x4f9c3f4c, 0x4c6309af, 0x4923b142,
+	0x45e07e5d, 0x429bb087, 0x3f577c2f, 0x3c160884,
+	0x38d96d69, 0x35a3b182, 0x3276c860, 0x2f5490d3,
+	0x2c3ed35c, 0x293740c4, 0x263f70d7, 0x2358e14e,
+	0x2084f4d2, 0x1dc4f238, 0x1b1a03dc, 0x18853724,
+	0x16077c2d, 0x13a1a5a4, 0x115468c0, 0x0f205d64,
+	0x0d05fe68, 0x0b05aa00, 0x091fa24d, 0x07540e08,
+	0x05a2f94c, 0x040c5680, 0x028fff56, 0x012db5e5,
+	0xffe525db, 0xfeb5e5ba, 0xfd9f782d, 0xfca14d68,
+	0xfbbac498, 0xfaeb2d51, 0xfa31c911, 0xf98dccbb,
+	0xf8fe621b, 0xf882a968, 0xf819bac1, 0xf7c2a7a4,
+	0xf77c7c65, 0xf7464194, 0xf71efd5e, 0xf705b4da,
+	0xf6f96d55, 0xf6f92d7e, 0xf703fe92, 0xf718ed6b,
+	0xf7370b81, 0xf75d6fd6, 0xf78b37d0, 0xf7bf8802,
+	0xf7f98cd7, 0xf8387b2f, 0xf87b90e9, 0xf8c21558,
+	0xf90b5999, 0xf956b8ea, 0xf9a398d7, 0xf9f16968,
+	0xfa3fa52f, 0xfa8dd14e, 0xfadb7d64, 0xfb284377,
+	0xfb73c7c2, 0xfbbdb880, 0xfc05cda6, 0xfc4bc893,
+	0xfc8f73b4, 0xfcd0a226, 0xfd0f2f44, 0xfd4afe3c,
+	0xfd83f992, 0xfdba12ab, 0xfded4146, 0xfe1d82ff,
+	0xfe4adac8, 0xfe755067, 0xfe9ceff1, 0xfec1c945,
+	0xfee3ef8a, 0xff0378af, 0xff207cf0, 0xff3b1659,
+	0xff536053, 0xff697732, 0xff7d77c8, 0xff8f7eff,
+	0xff9fa976, 0xffae1328, 0xffbad711, 0xffc60ee4,
+	0xffcfd2c0, 0xffd838ee, 0xffdf55a5, 0xffe53ad3,
+	0xffe9f7f5, 0xffed99eb, 0xfff02ad8, 0xfff1b20e,
+};
+
@@ -0,0 +1,134 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32flattop512[512] =
+{
+	0xfff233f8, 0xfff21383, 0xfff1b20e, 0xfff10f52,
+	0xfff02ad8, 0xffef03fc, 0xffed99eb, 0xffebeba3,
+	0xffe9f7f5, 0xffe7bd88, 0xffe53ad3, 0xffe26e26,
+	0xffdf55a5, 0xffdbef4b, 0xffd838ee, 0xffd4303d,
+	0xffcfd2c0, 0xffcb1de1, 0xffc60ee4, 0xffc0a2f1,
+	0xffbad711, 0xffb4a831, 0xffae1328, 0xffa714b1,
+	0xff9fa976, 0xff97ce0e, 0xff8f7eff, 0xff86b8c2,
+	0xff7d77c8, 0xff73b877, 0xff697732, 0xff5eb05a,
+	0xff536053, 0xff478382, 0xff3b1659, 0xff2e154f,
+	0xff207cf0, 0xff1249d5, 0xff0378af, 0xfef40649,
+	0xfee3ef8a, 0xfed3317a, 0xfec1c945, 0xfeafb442,
+	0xfe9ceff1, 0xfe897a06, 0xfe755067, 0xfe607134,
+	0xfe4adac8, 0xfe348bc0, 0xfe1d82ff, 0xfe05bfae,
+	0xfded4146, 0xfdd40790, 0xfdba12ab, 0xfd9f630f,
+	0xfd83f992, 0xfd67d76d, 0xfd4afe3c, 0xfd2d7007,
+	0xfd0f2f44, 0xfcf03eda, 0xfcd0a226, 0xfcb05cfe,
+	0xfc8f73b4, 0xfc6deb1e, 0xfc4bc893, 0xfc2911f2,
+	0xfc05cda6, 0xfbe202a8, 0xfbbdb880, 0xfb98f74d,
+	0xfb73c7c2, 0xfb4e332d, 0xfb284377, 0xfb020327,
+	0xfadb7d64, 0xfab4bdf7, 0xfa8dd14e, 0xfa66c478,
+	0xfa3fa52f, 0xfa1881d2, 0xf9f16968, 0xf9ca6ba1,
+	0xf9a398d7, 0xf97d020b, 0xf956b8ea, 0xf930cfc5,
+	0xf90b5999, 0xf8e66a08, 0xf8c21558, 0xf89e7074,
+	0xf87b90e9, 0xf8598ce4, 0xf8387b2f, 0xf818732c,
+	0xf7f98cd7, 0xf7dbe0bf, 0xf7bf8802, 0xf7a49c4d,
+	0xf78b37d0, 0xf7737542, 0xf75d6fd6, 0xf7494336,
+	0xf7370b81, 0xf726e542, 0xf718ed6b, 0xf70d414d,
+	0xf703fe92, 0xf6fd4336, 0xf6f92d7e, 0xf6f7dbf2,
+	0xf6f96d55, 0xf6fe0099, 0xf705b4da, 0xf710a956,
+	0xf71efd5e, 0xf730d052, 0xf7464194, 0xf75f7082,
+	0xf77c7c65, 0xf79d846d, 0xf7c2a7a4, 0xf7ec04e1,
+	0xf819bac1, 0xf84be798, 0xf882a968, 0xf8be1dd6,
+	0xf8fe621b, 0xf94392fc, 0xf98dccbb, 0xf9dd2b0e,
+	0xfa31c911, 0xfa8bc13b, 0xfaeb2d51, 0xfb50265c,
+	0xfbbac498, 0xfc2b1f6f, 0xfca14d68, 0xfd1d641d,
+	0xfd9f782d, 0xfe279d33, 0xfeb5e5ba, 0xff4a6330,
+	0xffe525db, 0x00863cd0, 0x012db5e5, 0x01db9da9,
+	0x028fff56, 0x034ae4cb, 0x040c5680, 0x04d45b7c,
+	0x05a2f94c, 0x067833fb, 0x07540e08, 0x0836885e,
+	0x091fa24d, 0x0a0f5982, 0x0b05aa00, 0x0c028e19,
+	0x0d05fe68, 0x0e0ff1cd, 0x0f205d64, 0x10373487,
+	0x115468c0, 0x1277e9d0, 0x13a1a5a4, 0x14d18857,
+	0x16077c2d, 0x17436994, 0x18853724, 0x19ccc999,
+	0x1b1a03dc, 0x1c6cc6fd, 0x1dc4f238, 0x1f2262f7,
+	0x2084f4d2, 0x21ec8197, 0x2358e14e, 0x24c9ea37,
+	0x263f70d7, 0x27b947fd, 0x293740c4, 0x2ab92a9e,
+	0x2c3ed35c, 0x2dc80736, 0x2f5490d3, 0x30e43954,
+	0x3276c860, 0x340c042a, 0x35a3b182, 0x373d93de,
+	0x38d96d69, 0x3a76ff0d, 0x3c160884, 0x3db64864,
+	0x3f577c2f, 0x40f96063, 0x429bb087, 0x443e2740,
+	0x45e07e5d, 0x47826eea, 0x4923b142, 0x4ac3fd1f,
+	0x4c6309af, 0x4e008da5, 0x4f9c3f4c, 0x5135d498,
+	0x52cd033f, 0x546180c7, 0x55f3029b, 0x57813e23,
+	0x590be8d4, 0x5a92b843, 0x5c156240, 0x5d939ce5,
+	0x5f0d1eaa, 0x60819e7e, 0x61f0d3d8, 0x635a76cd,
+	0x64be4024, 0x661be96b, 0x67732d09, 0x68c3c654,
+	0x6a0d71a7, 0x6b4fec70, 0x6c8af548, 0x6dbe4c05,
+	0x6ee9b1cd, 0x700ce928, 0x7127b611, 0x7239de0c,
+	0x73432833, 0x74435d49, 0x753a47ca, 0x7627b3fc,
+	0x770b6fff, 0x77e54bd8, 0x78b51986, 0x797aad0a,
+	0x7a35dc78, 0x7ae68003, 0x7b8c7208, 0x7c278f1b,
+	0x7cb7b610, 0x7d3cc808, 0x7db6a879, 0x7e253d33,
+	0x7e886e70, 0x7ee026d5, 0x7f2c537b, 0x7f6ce3f3,
+	0x7fa1ca4e, 0x7fcafb1f, 0x7fe86d80, 0x7ffa1b13,
+	0x7fffffff, 0x7ffa1b13, 0x7fe86d80, 0x7fcafb1f,
+	0x7fa1ca4e, 0x7f6ce3f3, 0x7f2c537b, 0x7ee026d5,
+	0x7e886e70, 0x7e253d33, 0x7db6a879, 0x7d3cc808,
+	0x7cb7b610, 0x7c278f1b, 0x7b8c7208, 0x7ae68003,
+	0x7a35dc78, 0x797aad0a, 0x78b51986, 0x77e54bd8,
+	0x770b6fff, 0x7627b3fc, 0x753a47ca, 0x74435d49,
+	0x73432833, 0x7239de0c, 0x7127b611, 0x700ce928,
+	0x6ee9b1cd, 0x6dbe4c05, 0x6c8af548, 0x6b4fec70,
+	0x6a0d71a7, 0x68c3c654, 0x67732d09, 0x661be96b,
+	0x64be4024, 0x635a76cd, 0x61f0d3d8, 0x60819e7e,
+	0x5f0d1eaa, 0x5d939ce5, 0x5c156240, 0x5a92b843,
+	0x590be8d4, 0x57813e23, 0x55f3029b, 0x546180c7,
+	0x52cd033f, 0x5135d498, 0x4f9c3f4c, 0x4e008da5,
+	0x4c6309af, 0x4ac3fd1f, 0x4923b142, 0x47826eea,
+	0x45e07e5d, 0x443e2740, 0x429bb087, 0x40f96063,
+	0x3f577c2f, 0x3db64864, 0x3c160884, 0x3a76ff0d,
+	0x38d96d69, 0x373d93de, 0x35a3b182, 0x340c042a,
+	0x3276c860, 0x30e43954, 0x2f5490d3, 0x2dc80736,
+	0x2c3ed35c, 0x2ab92a9e, 0x293740c4, 0x27b947fd,
+	0x263f70d7, 0x24c9ea37, 0x2358e14e, 0x21ec8197,
+	0x2084f4d2, 0x1f2262f7, 0x1dc4f238, 0x1c6cc6fd,
+	0x1b1a03dc, 0x19ccc999, 0x18853724, 0x17436994,
+	0x16077c2d, 0x14d18857, 0x13a1a5a4, 0x1277e9d0,
+	0x115468c0, 0x10373487, 0x0f205d64, 0x0e0ff1cd,
+	0x0d05fe68, 0x0c028e19, 0x0b05aa00, 0x0a0f5982,
+	0x091fa24d, 0x0836885e, 0x07540e08, 0x067833fb,
+	0x05a2f94c, 0x04d45b7c, 0x040c5680, 0x034ae4cb,
+	0x028fff56, 0x01db9da9, 0x012db5e5, 0x00863cd0,
+	0xffe525db, 0xff4a6330, 0xfeb5e5ba, 0xfe279d33,
+	0xfd9f782d, 0xfd1d641d, 0xfca14d68, 0xfc2b1f6f,
+	0xfbbac498, 0xfb50265c, 0xfaeb2d51, 0xfa8bc13b,
+	0xfa31c911, 0xf9dd2b0e, 0xf98dccbb, 0xf94392fc,
+	0xf8fe621b, 0xf8be1dd6, 0xf882a968, 0xf84be798,
+	0xf819bac1, 0xf7ec04e1, 0xf7c2a7a4, 0xf79d846d,
+	0xf77c7c65, 0xf75f7082, 0xf7464194, 0xf730d052,
+	0xf71efd5e, 0xf710a956, 0xf705b4da, 0xf6fe0099,
+	0xf6f96d55, 0xf6f7dbf2, 0xf6f92d7e, 0xf6fd4336,
+	0xf703fe92, 0xf70d414d, 0xf718ed6b, 0xf726e542,
+	0xf7370b81, 0xf7494336, 0xf75d6fd6, 0xf7737542,
+	0xf78b37d0, 0xf7a49c4d, 0xf7bf8802, 0xf7dbe0bf,
+	0xf7f98cd7, 0xf818732c, 0xf8387b2f, 0xf8598ce4,
+	0xf87b90e9, 0xf89e7074, 0xf8c21558, 0xf8e66a08,
+	0xf90b5999, 0xf930cfc5, 0xf956b8ea, 0xf97d020b,
+	0xf9a398d7, 0xf9ca6ba1, 0xf9f16968, 0xfa1881d2,
+	0xfa3fa52f, 0xfa66c478, 0xfa8dd14e, 0xfab4bdf7,
+	0xfadb7d64, 0xfb020327, 0xfb284377, 0xfb4e332d,
+	0xfb73c7c2, 0xfb98f74d, 0xfbbdb880, 0xfbe202a8,
+	0xfc05cda6, 0xfc2911f2, 0xfc4bc893, 0xfc6deb1e,
+	0xfc8f73b4, 0xfcb05cfe, 0xfcd0a226, 0xfcf03eda,
+	0xfd0f2f44, 0xfd2d7007, 0xfd4afe3c, 0xfd67d76d,
+	0xfd83f992, 0xfd9f630f, 0xfdba12ab, 0xfdd40790,
+	0xfded4146, 0xfe05bfae, 0xfe1d82ff, 0xfe348bc0,
+	0xfe4adac8, 0xfe607134, 0xfe755067, 0xfe897a06,
+	0xfe9ceff1, 0xfeafb442, 0xfec1c945, 0xfed3317a,
+	0xfee3ef8a, 0xfef40649, 0xff0378af, 0xff1249d5,
+	0xff207cf0, 0xff2e154f, 0xff3b1659, 0xff478382,
+	0xff536053, 0xff5eb05a, 0xff697732, 0xff73b877,
+	0xff7d77c8, 0xff86b8c2, 0xff8f7eff, 0xff97ce0e,
+	0xff9fa976, 0xffa714b1, 0xffae1328, 0xffb4a831,
+	0xffbad711, 0xffc0a2f1, 0xffc60ee4, 0xffcb1de1,
+	0xffcfd2c0, 0xffd4303d, 0xffd838ee, 0xffdbef4b,
+	0xffdf55a5, 0xffe26e26, 0xffe53ad3, 0xffe7bd88,
+	0xffe9f7f5, 0xffebeba3, 0xffed99eb, 0xffef03fc,
+	0xfff02ad8, 0xfff10f52, 0xfff1b20e, 0xfff21383,
+};
+
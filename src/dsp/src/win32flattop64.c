@@ -0,0 +1,22 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32flattop64[64] =
+{
+	0xfff233f8, 0xffe9f7f5, 0xffcfd2c0, 0xff9fa976,
+	0xff536053, 0xfee3ef8a, 0xfe4adac8, 0xfd83f992,
+	0xfc8f73b4, 0xfb73c7c2, 0xfa3fa52f, 0xf90b5999,
+	0xf7f98cd7, 0xf7370b81, 0xf6f96d55, 0xf77c7c65,
+	0xf8fe621b, 0xfbbac498, 0xffe525db, 0x05a2f94c,
+	0x0d05fe68, 0x16077c2d, 0x2084f4d2, 0x2c3ed35c,
+	0x38d96d69, 0x45e07e5d, 0x52cd033f, 0x5f0d1eaa,
+	0x6a0d71a7, 0x73432833, 0x7a35dc78, 0x7e886e70,
+	0x7fffffff, 0x7e886e70, 0x7a35dc78, 0x73432833,
+	0x6a0d71a7, 0x5f0d1eaa, 0x52cd033f, 0x45e07e5d,
+	0x38d96d69, 0x2c3ed35c, 0x2084f4d2, 0x16077c2d,
+	0x0d05fe68, 0x05a2f94c, 0xffe525db, 0xfbbac498,
+	0xf8fe621b, 0xf77c7c65, 0xf6f96d55, 0xf7370b81,
+	0xf7f98cd7, 0xf90b5999, 0xfa3fa52f, 0xfb73c7c2,
+	0xfc8f73b4, 0xfd83f992, 0xfe4adac8, 0xfee3ef8a,
+	0xff536053, 0xff9fa976, 0xffcfd2c0, 0xffe9f7f5,
+};
+
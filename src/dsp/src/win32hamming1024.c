@@ -0,0 +1,262 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32hamming1024[1024] =
+{
+	0x0a3d70a4, 0x0a3db948, 0x0a3e9333, 0x0a3ffe62,
+	0x0a41fad4, 0x0a448881, 0x0a47a765, 0x0a4b5778,
+	0x0a4f98af, 0x0a546b02, 0x0a59ce64, 0x0a5fc2c7,
+	0x0a66481e, 0x0a6d5e57, 0x0a750562, 0x0a7d3d2c,
+	0x0a86059f, 0x0a8f5ea8, 0x0a99482e, 0x0aa3c219,
+	0x0aaecc4f, 0x0aba66b5, 0x0ac6912f, 0x0ad34b9e,
+	0x0ae095e3, 0x0aee6fdd, 0x0afcd96a, 0x0b0bd267,
+	0x0b1b5aae, 0x0b2b7219, 0x0b3c1881, 0x0b4d4dbc,
+	0x0b5f11a0, 0x0b716401, 0x0b8444b2, 0x0b97b384,
+	0x0babb048, 0x0bc03acc, 0x0bd552dd, 0x0beaf847,
+	0x0c012ad5, 0x0c17ea50, 0x0c2f3681, 0x0c470f2c,
+	0x0c5f7419, 0x0c78650a, 0x0c91e1c2, 0x0cabea02,
+	0x0cc67d89, 0x0ce19c17, 0x0cfd4569, 0x0d197939,
+	0x0d363743, 0x0d537f3f, 0x0d7150e6, 0x0d8fabee,
+	0x0dae900b, 0x0dcdfcf2, 0x0dedf256, 0x0e0e6fe6,
+	0x0e2f7553, 0x0e51024d, 0x0e73167e, 0x0e95b195,
+	0x0eb8d33b, 0x0edc7b1a, 0x0f00a8d9, 0x0f255c20,
+	0x0f4a9493, 0x0f7051d8, 0x0f969391, 0x0fbd595f,
+	0x0fe4a2e2, 0x100c6fbb, 0x1034bf87, 0x105d91e1,
+	0x1086e667, 0x10b0bcb1, 0x10db1458, 0x1105ecf4,
+	0x1131461b, 0x115d1f62, 0x1189785d, 0x11b6509f,
+	0x11e3a7b8, 0x12117d3a, 0x123fd0b3, 0x126ea1b0,
+	0x129defbe, 0x12cdba69, 0x12fe013a, 0x132ec3bb,
+	0x13600172, 0x1391b9e8, 0x13c3eca0, 0x13f6991f,
+	0x1429bee8, 0x145d5d7c, 0x1491745e, 0x14c6030b,
+	0x14fb0902, 0x153085c1, 0x156678c3, 0x159ce183,
+	0x15d3bf7c, 0x160b1225, 0x1642d8f6, 0x167b1366,
+	0x16b3c0e9, 0x16ece0f5, 0x172672fb, 0x1760766f,
+	0x179aeac0, 0x17d5cf5f, 0x181123ba, 0x184ce73f,
+	0x1889195b, 0x18c5b978, 0x1902c702, 0x19404161,
+	0x197e27fe, 0x19bc7a41, 0x19fb378f, 0x1a3a5f4d,
+	0x1a79f0e1, 0x1ab9ebac, 0x1afa4f12, 0x1b3b1a73,
+	0x1b7c4d2f, 0x1bbde6a6, 0x1bffe635, 0x1c424b3a,
+	0x1c851511, 0x1cc84316, 0x1d0bd4a2, 0x1d4fc90e,
+	0x1d941fb4, 0x1dd8d7ea, 0x1e1df107, 0x1e636a60,
+	0x1ea9434a, 0x1eef7b19, 0x1f36111f, 0x1f7d04af,
+	0x1fc45518, 0x200c01ac, 0x205409b9, 0x209c6c8d,
+	0x20e52977, 0x212e3fc2, 0x2177aeba, 0x21c175ab,
+	0x220b93dd, 0x2256089a, 0x22a0d32b, 0x22ebf2d6,
+	0x233766e3, 0x23832e97, 0x23cf4938, 0x241bb609,
+	0x2468744e, 0x24b5834a, 0x2502e23e, 0x2550906c,
+	0x259e8d13, 0x25ecd774, 0x263b6ece, 0x268a525e,
+	0x26d98161, 0x2728fb15, 0x2778beb5, 0x27c8cb7d,
+	0x281920a6, 0x2869bd6c, 0x28baa106, 0x290bcaad,
+	0x295d3999, 0x29aeed02, 0x2a00e41c, 0x2a531e1f,
+	0x2aa59a40, 0x2af857b2, 0x2b4b55aa, 0x2b9e935b,
+	0x2bf20ff7, 0x2c45cab1, 0x2c99c2b9, 0x2cedf742,
+	0x2d42677a, 0x2d971292, 0x2debf7b9, 0x2e41161d,
+	0x2e966cec, 0x2eebfb54, 0x2f41c081, 0x2f97bba0,
+	0x2fedebdd, 0x30445063, 0x309ae85d, 0x30f1b2f6,
+	0x3148af56, 0x319fdca8, 0x31f73a15, 0x324ec6c4,
+	0x32a681de, 0x32fe6a8b, 0x33567ff1, 0x33aec137,
+	0x34072d83, 0x345fc3fc, 0x34b883c6, 0x35116c07,
+	0x356a7be3, 0x35c3b27e, 0x361d0efd, 0x36769083,
+	0x36d03633, 0x3729ff30, 0x3783ea9c, 0x37ddf799,
+	0x3838254a, 0x389272cf, 0x38ecdf4b, 0x394769dd,
+	0x39a211a7, 0x39fcd5c8, 0x3a57b561, 0x3ab2af92,
+	0x3b0dc37a, 0x3b68f038, 0x3bc434ec, 0x3c1f90b4,
+	0x3c7b02ae, 0x3cd689fa, 0x3d3225b5, 0x3d8dd4fe,
+	0x3de996f1, 0x3e456aad, 0x3ea14f50, 0x3efd43f5,
+	0x3f5947bb, 0x3fb559bf, 0x4011791c, 0x406da4f1,
+	0x40c9dc59, 0x41261e71, 0x41826a56, 0x41debf23,
+	0x423b1bf5, 0x42977fe8, 0x42f3ea18, 0x435059a0,
+	0x43accd9e, 0x4409452c, 0x4465bf67, 0x44c23b6a,
+	0x451eb852, 0x457b3539, 0x45d7b13d, 0x46342b78,
+	0x4690a306, 0x46ed1704, 0x4749868c, 0x47a5f0bc,
+	0x480254af, 0x485eb181, 0x48bb064e, 0x49175233,
+	0x4973944b, 0x49cfcbb3, 0x4a2bf788, 0x4a8816e5,
+	0x4ae428e9, 0x4b402caf, 0x4b9c2154, 0x4bf805f7,
+	0x4c53d9b3, 0x4caf9ba6, 0x4d0b4aef, 0x4d66e6aa,
+	0x4dc26df5, 0x4e1ddff0, 0x4e793bb8, 0x4ed4806c,
+	0x4f2fad2a, 0x4f8ac112, 0x4fe5bb42, 0x50409adc,
+	0x509b5efd, 0x50f606c7, 0x51509159, 0x51aafdd4,
+	0x52054b5a, 0x525f790b, 0x52b98608, 0x53137174,
+	0x536d3a71, 0x53c6e021, 0x542061a7, 0x5479be26,
+	0x54d2f4c1, 0x552c049d, 0x5584ecde, 0x55ddaca8,
+	0x56364321, 0x568eaf6d, 0x56e6f0b3, 0x573f0619,
+	0x5796eec6, 0x57eea9e0, 0x5846368f, 0x589d93fc,
+	0x58f4c14e, 0x594bbdae, 0x59a28846, 0x59f92041,
+	0x5a4f84c7, 0x5aa5b504, 0x5afbb023, 0x5b517550,
+	0x5ba703b8, 0x5bfc5a87, 0x5c5178eb, 0x5ca65e12,
+	0x5cfb092a, 0x5d4f7962, 0x5da3adeb, 0x5df7a5f3,
+	0x5e4b60ad, 0x5e9edd49, 0x5ef21afa, 0x5f4518f2,
+	0x5f97d664, 0x5fea5284, 0x603c8c87, 0x608e83a2,
+	0x60e0370b, 0x6131a5f7, 0x6182cf9e, 0x61d3b338,
+	0x62244ffe, 0x6274a527, 0x62c4b1ef, 0x6314758f,
+	0x6363ef43, 0x63b31e46, 0x640201d6, 0x6450992f,
+	0x649ee391, 0x64ece038, 0x653a8e66, 0x6587ed5a,
+	0x65d4fc56, 0x6621ba9b, 0x666e276c, 0x66ba420c,
+	0x670609c1, 0x67517dce, 0x679c9d79, 0x67e7680a,
+	0x6831dcc7, 0x687bfaf9, 0x68c5c1ea, 0x690f30e2,
+	0x6958472d, 0x69a10417, 0x69e966eb, 0x6a316ef8,
+	0x6a791b8c, 0x6ac06bf5, 0x6b075f85, 0x6b4df58b,
+	0x6b942d5a, 0x6bda0644, 0x6c1f7f9d, 0x6c6498ba,
+	0x6ca950f0, 0x6ceda796, 0x6d319c02, 0x6d752d8e,
+	0x6db85b92, 0x6dfb256a, 0x6e3d8a6f, 0x6e7f89fe,
+	0x6ec12375, 0x6f025631, 0x6f432192, 0x6f8384f8,
+	0x6fc37fc3, 0x70031157, 0x70423915, 0x7080f663,
+	0x70bf48a6, 0x70fd2f43, 0x713aa9a2, 0x7177b72c,
+	0x71b45749, 0x71f08965, 0x722c4cea, 0x7267a145,
+	0x72a285e4, 0x72dcfa35, 0x7316fda9, 0x73508faf,
+	0x7389afbb, 0x73c25d3e, 0x73fa97ae, 0x74325e7f,
+	0x7469b128, 0x74a08f21, 0x74d6f7e1, 0x750ceae3,
+	0x754267a2, 0x75776d99, 0x75abfc46, 0x75e01327,
+	0x7613b1bc, 0x7646d785, 0x76798404, 0x76abb6bc,
+	0x76dd6f31, 0x770eace9, 0x773f6f6a, 0x776fb63b,
+	0x779f80e6, 0x77cecef4, 0x77fd9ff1, 0x782bf36a,
+	0x7859c8eb, 0x78872005, 0x78b3f847, 0x78e05142,
+	0x790c2a89, 0x793783b0, 0x79625c4c, 0x798cb3f3,
+	0x79b68a3d, 0x79dfdec2, 0x7a08b11d, 0x7a3100e9,
+	0x7a58cdc1, 0x7a801745, 0x7aa6dd13, 0x7acd1ecc,
+	0x7af2dc10, 0x7b181484, 0x7b3cc7cb, 0x7b60f58a,
+	0x7b849d69, 0x7ba7bf0f, 0x7bca5a25, 0x7bec6e57,
+	0x7c0dfb50, 0x7c2f00be, 0x7c4f7e4e, 0x7c6f73b1,
+	0x7c8ee098, 0x7cadc4b6, 0x7ccc1fbe, 0x7ce9f164,
+	0x7d073961, 0x7d23f76b, 0x7d402b3b, 0x7d5bd48d,
+	0x7d76f31b, 0x7d9186a2, 0x7dab8ee2, 0x7dc50b9a,
+	0x7dddfc8b, 0x7df66178, 0x7e0e3a23, 0x7e258654,
+	0x7e3c45cf, 0x7e52785d, 0x7e681dc7, 0x7e7d35d8,
+	0x7e91c05c, 0x7ea5bd20, 0x7eb92bf2, 0x7ecc0ca3,
+	0x7ede5f04, 0x7ef022e8, 0x7f015823, 0x7f11fe8b,
+	0x7f2215f6, 0x7f319e3d, 0x7f409739, 0x7f4f00c7,
+	0x7f5cdac1, 0x7f6a2506, 0x7f76df75, 0x7f8309ef,
+	0x7f8ea455, 0x7f99ae8b, 0x7fa42876, 0x7fae11fc,
+	0x7fb76b04, 0x7fc03378, 0x7fc86b42, 0x7fd0124d,
+	0x7fd72886, 0x7fddaddd, 0x7fe3a240, 0x7fe905a2,
+	0x7fedd7f4, 0x7ff2192c, 0x7ff5c93f, 0x7ff8e823,
+	0x7ffb75d0, 0x7ffd7242, 0x7ffedd71, 0x7fffb75c,
+	0x7fffffff, 0x7fffb75c, 0x7ffedd71, 0x7ffd7242,
+	0x7ffb75d0, 0x7ff8e823, 0x7ff5c93f, 0x7ff2192c,
+	0x7fedd7f4, 0x7fe905a2, 0x7fe3a240, 0x7fddaddd,
+	0x7fd72886, 0x7fd0124d, 0x7fc86b42, 0x7fc03378,
+	0x7fb76b04, 0x7fae11fc, 0x7fa42876, 0x7f99ae8b,
+	0x7f8ea455, 0x7f8309ef, 0x7f76df75, 0x7f6a2506,
+	0x7f5cdac1, 0x7f4f00c7, 0x7f409739, 0x7f319e3d,
+	0x7f2215f6, 0x7f11fe8b, 0x7f015823, 0x7ef022e8,
+	0x7ede5f04, 0x7ecc0ca3, 0x7eb92bf2, 0x7ea5bd20,
+	0x7e91c05c, 0x7e7d35d8, 0x7e681dc7, 0x7e52785d,
+	0x7e3c45cf, 0x7e258654, 0x7e0e3a23, 0x7df66178,
+	0x7dddfc8b, 0x7dc50b9a, 0x7dab8ee2, 0x7d9186a2,
+	0x7d76f31b, 0x7d5bd48d, 0x7d402b3b, 0x7d23f76b,
+	0x7d073961, 0x7ce9f164, 0x7ccc1fbe, 0x7cadc4b6,
+	0x7c8ee098, 0x7c6f73b1, 0x7c4f7e4e, 0x7c2f00be,
+	0x7c0dfb50, 0x7bec6e57, 0x7bca5a25, 0x7ba7bf0f,
+	0x7b849d69, 0x7b60f58a, 0x7b3cc7cb, 0x7b181484,
+	0x7af2dc10, 0x7acd1ecc, 0x7aa6dd13, 0x7a801745,
+	0x7a58cdc1, 0x7a3100e9, 0x7a08b11d, 0x79dfdec2,
+	0x79b68a3d, 0x798cb3f3, 0x79625c4c, 0x793783b0,
+	0x790c2a89, 0x78e05142, 0x78b3f847, 0x78872005,
+	0x7859c8eb, 0x782bf36a, 0x77fd9ff1, 0x77cecef4,
+	0x779f80e6, 0x776fb63b, 0x773f6f6a, 0x770eace9,
+	0x76dd6f31, 0x76abb6bc, 0x76798404, 0x7646d785,
+	0x7613b1bc, 0x75e01327, 0x75abfc46, 0x75776d99,
+	0x754267a2, 0x750ceae3, 0x74d6f7e1, 0x74a08f21,
+	0x7469b128, 0x74325e7f, 0x73fa97ae, 0x73c25d3e,
+	0x7389afbb, 0x73508faf, 0x7316fda9, 0x72dcfa35,
+	0x72a285e4, 0x7267a145, 0x722c4cea, 0x71f08965,
+	0x71b45749, 0x7177b72c, 0x713aa9a2, 0x70fd2f43,
+	0x70bf48a6, 0x7080f663, 0x70423915, 0x70031157,
+	0x6fc37fc3, 0x6f8384f8, 0x6f432192, 0x6f025631,
+	0x6ec12375, 0x6e7f89fe, 0x6e3d8a6f, 0x6dfb256a,
+	0x6db85b92, 0x6d752d8e, 0x6d319c02, 0x6ceda796,
+	0x6ca950f0, 0x6c6498ba, 0x6c1f7f9d, 0x6bda0644,
+	0x6b942d5a, 0x6b4df58b, 0x6b075f85, 0x6ac06bf5,
+	0x6a791b8c, 0x6a316ef8, 0x69e966eb, 0x69a10417,
+	0x6958472d, 0x690f30e2, 0x68c5c1ea, 0x687bfaf9,
+	0x6831dcc7, 0x67e7680a, 0x679c9d79, 0x67517dce,
+	0x670609c1, 0x66ba420c, 0x666e276c, 0x6621ba9b,
+	0x65d4fc56, 0x6587ed5a, 0x653a8e66, 0x64ece038,
+	0x649ee391, 0x6450992f, 0x640201d6, 0x63b31e46,
+	0x6363ef43, 0x6314758f, 0x62c4b1ef, 0x6274a527,
+	0x62244ffe, 0x61d3b338, 0x6182cf9e, 0x6131a5f7,
+	0x60e0370b, 0x608e83a2, 0x603c8c87, 0x5fea5284,
+	0x5f97d664, 0x5f4518f2, 0x5ef21afa, 0x5e9edd49,
+	0x5e4b60ad, 0x5df7a5f3, 0x5da3adeb, 0x5d4f7962,
+	0x5cfb092a, 0x5ca65e12, 0x5c5178eb, 0x5bfc5a87,
+	0x5ba703b8, 0x5b517550, 0x5afbb023, 0x5aa5b504,
+	0x5a4f84c7, 0x59f92041, 0x59a28846, 0x594bbdae,
+	0x58f4c14e, 0x589d93fc, 0x5846368f, 0x57eea9e0,
+	0x5796eec6, 0x573f0619, 0x56e6f0b3, 0x568eaf6d,
+	0x56364321, 0x55ddaca8, 0x5584ecde, 0x552c049d,
+	0x54d2f4c1, 0x5479be26, 0x542061a7, 0x53c6e021,
+	0x536d3a71, 0x53137174, 0x52b98608, 0x525f790b,
+	0x52054b5a, 0x51aafdd4, 0x51509159, 0x50f606c7,
+	0x509b5efd, 0x50409adc, 0x4fe5bb42, 0x4f8ac112,
+	0x4f2fad2a, 0x4ed4806c, 0x4e793bb8, 0x4e1ddff0,
+	0x4dc26df5, 0x4d66e6aa, 0x4d0b4aef, 0x4caf9ba6,
+	0x4c53d9b3, 0x4bf805f7, 0x4b9c2154, 0x4b402caf,
+	0x4ae428e9, 0x4a8816e5, 0x4a2bf788, 0x49cfcbb3,
+	0x4973944b, 0x49175233, 0x48bb064e, 0x485eb181,
+	0x480254af, 0x47a5f0bc, 0x4749868c, 0x46ed1704,
+	0x4690a306, 0x46342b78, 0x45d7b13d, 0x457b3539,
+	0x451eb852, 0x44c23b6a, 0x4465bf67, 0x4409452c,
+	0x43accd9e, 0x435059a0, 0x42f3ea18, 0x42977fe8,
+	0x423b1bf5, 0x41debf23, 0x41826a56, 0x41261e71,
+	0x40c9dc59, 0x406da4f1, 0x4011791c, 0x3fb559bf,
+	0x3f5947bb, 0x3efd43f5, 0x3ea14f50, 0x3e456aad,
+	0x3de996f1, 0x3d8dd4fe, 0x3d3225b5, 0x3cd689fa,
+	0x3c7b02ae, 0x3c1f90b4, 0x3bc434ec, 0x3b68f038,
+	0x3b0dc37a, 0x3ab2af92, 0x3a57b561, 0x39fcd5c8,
+	0x39a211a7, 0x394769dd, 0x38ecdf4b, 0x389272cf,
+	0x3838254a, 0x37ddf799, 0x3783ea9c, 0x3729ff30,
+	0x36d03633, 0x36769083, 0x361d0efd, 0x35c3b27e,
+	0x356a7be3, 0x35116c07, 0x34b883c6, 0x345fc3fc,
+	0x34072d83, 0x33aec137, 0x33567ff1, 0x32fe6a8b,
+	0x32a681de, 0x324ec6c4, 0x31f73a15, 0x319fdca8,
+	0x3148af56, 0x30f1b2f6, 0x309ae85d, 0x30445063,
+	0x2fedebdd, 0x2f97bba0, 0x2f41c081, 0x2eebfb54,
+	0x2e966cec, 0x2e41161d, 0x2debf7b9, 0x2d971292,
+	0x2d42677a, 0x2cedf742, 0x2c99c2b9, 0x2c45cab1,
+	0x2bf20ff7, 0x2b9e935b, 0x2b4b55aa, 0x2af857b2,
+	0x2aa59a40, 0x2a531e1f, 0x2a00e41c, 0x29aeed02,
+	0x295d3999, 0x290bcaad, 0x28baa106, 0x2869bd6c,
+	0x281920a6, 0x27c8cb7d, 0x2778beb5, 0x2728fb15,
+	0x26d98161, 0x268a525e, 0x263b6ece, 0x25ecd774,
+	0x259e8d13, 0x2550906c, 0x2502e23e, 0x24b5834a,
+	0x2468744e, 0x241bb609, 0x23cf4938, 0x23832e97,
+	0x233766e3, 0x22ebf2d6, 0x22a0d32b, 0x2256089a,
+	0x220b93dd, 0x21c175ab, 0x2177aeba, 0x212e3fc2,
+	0x20e52977, 0x209c6c8d, 0x205409b9, 0x200c01ac,
+	0x1fc45518, 0x1f7d04af, 0x1f36111f, 0x1eef7b19,
+	0x1ea9434a, 0x1e636a60, 0x1e1df107, 0x1dd8d7ea,
+	0x1d941fb4, 0x1d4fc90e, 0x1d0bd4a2, 0x1cc84316,
+	0x1c851511, 0x1c424b3a, 0x1bffe635, 0x1bbde6a6,
+	0x1b7c4d2f, 0x1b3b1a73, 0x1afa4f12, 0x1ab9ebac,
+	0x1a79f0e1, 0x1a3a5f4d, 0x19fb378f, 0x19bc7a41,
+	0x197e27fe, 0x19404161, 0x1902c702, 0x18c5b978,
+	0x1889195b, 0x184ce73f, 0x181123ba, 0x17d5cf5f,
+	0x179aeac0, 0x1760766f, 0x172672fb, 0x16ece0f5,
+	0x16b3c0e9, 0x167b1366, 0x1642d8f6, 0x160b1225,
+	0x15d3bf7c, 0x159ce183, 0x156678c3, 0x153085c1,
+	0x14fb0902, 0x14c6030b, 0x1491745e, 0x145d5d7c,
+	0x1429bee8, 0x13f6991f, 0x13c3eca0, 0x1391b9e8,
+	0x13600172, 0x132ec3bb, 0x12fe013a, 0x12cdba69,
+	0x129defbe, 0x126ea1b0, 0x123fd0b3, 0x12117d3a,
+	0x11e3a7b8, 0x11b6509f, 0x1189785d, 0x115d1f62,
+	0x1131461b, 0x1105ecf4, 0x10db1458, 0x10b0bcb1,
+	0x1086e667, 0x105d91e1, 0x1034bf87, 0x100c6fbb,
+	0x0fe4a2e2, 0x0fbd595f, 0x0f969391, 0x0f7051d8,
+	0x0f4a9493, 0x0f255c20, 0x0f00a8d9, 0x0edc7b1a,
+	0x0eb8d33b, 0x0e95b195, 0x0e73167e, 0x0e51024d,
+	0x0e2f7553, 0x0e0e6fe6, 0x0dedf256, 0x0dcdfcf2,
+	0x0dae900b, 0x0d8fabee, 0x0d7150e6, 0x0d537f3f,
+	0x0d363743, 0x0d197939, 0x0cfd4569, 0x0ce19c17,
+	0x0cc67d89, 0x0cabea02, 0x0c91e1c2, 0x0c78650a,
+	0x0c5f7419, 0x0c470f2c, 0x0c2f3681, 0x0c17ea50,
+	0x0c012ad5, 0x0beaf847, 0x0bd552dd, 0x0bc03acc,
+	0x0babb048, 0x0b97b384, 0x0b8444b2, 0x0b716401,
+	0x0b5f11a0, 0x0b4d4dbc, 0x0b3c1881, 0x0b2b7219,
+	0x0b1b5aae, 0x0b0bd267, 0x0afcd96a, 0x0aee6fdd,
+	0x0ae095e3, 0x0ad34b9e, 0x0ac6912f, 0x0aba66b5,
+	0x0aaecc4f, 0x0aa3c219, 0x0a99482e, 0x0a8f5ea8,
+	0x0a86059f, 0x0a7d3d2c, 0x0a750562, 0x0a6d5e57,
+	0x0a66481e, 0x0a5fc2c7, 0x0a59ce64, 0x0a546b02,
+	0x0a4f98af, 0x0a4b5778, 0x0a47a765, 0x0a448881,
+	0x0a41fad4, 0x0a3ffe62, 0x0a3e9333, 0x0a3db948,
+};
+
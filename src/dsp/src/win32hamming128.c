@@ -0,0 +1,38 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32hamming128[128] =
+{
+	0x0a3d70a4, 0x0a4f98af, 0x0a86059f, 0x0ae095e3,
+	0x0b5f11a0, 0x0c012ad5, 0x0cc67d89, 0x0dae900b,
+	0x0eb8d33b, 0x0fe4a2e2, 0x1131461b, 0x129defbe,
+	0x1429bee8, 0x15d3bf7c, 0x179aeac0, 0x197e27fe,
+	0x1b7c4d2f, 0x1d941fb4, 0x1fc45518, 0x220b93dd,
+	0x2468744e, 0x26d98161, 0x295d3999, 0x2bf20ff7,
+	0x2e966cec, 0x3148af56, 0x34072d83, 0x36d03633,
+	0x39a211a7, 0x3c7b02ae, 0x3f5947bb, 0x423b1bf5,
+	0x451eb852, 0x480254af, 0x4ae428e9, 0x4dc26df5,
+	0x509b5efd, 0x536d3a71, 0x56364321, 0x58f4c14e,
+	0x5ba703b8, 0x5e4b60ad, 0x60e0370b, 0x6363ef43,
+	0x65d4fc56, 0x6831dcc7, 0x6a791b8c, 0x6ca950f0,
+	0x6ec12375, 0x70bf48a6, 0x72a285e4, 0x7469b128,
+	0x7613b1bc, 0x779f80e6, 0x790c2a89, 0x7a58cdc1,
+	0x7b849d69, 0x7c8ee098, 0x7d76f31b, 0x7e3c45cf,
+	0x7ede5f04, 0x7f5cdac1, 0x7fb76b04, 0x7fedd7f4,
+	0x7fffffff, 0x7fedd7f4, 0x7fb76b04, 0x7f5cdac1,
+	0x7ede5f04, 0x7e3c45cf, 0x7d76f31b, 0x7c8ee098,
+	0x7b849d69, 0x7a58cdc1, 0x790c2a89, 0x779f80e6,
+	0x7613b1bc, 0x7469b128, 0x72a285e4, 0x70bf48a6,
+	0x6ec12375, 0x6ca950f0, 0x6a791b8c, 0x6831dcc7,
+	0x65d4fc56, 0x6363ef43, 0x60e0370b, 0x5e4b60ad,
+	0x5ba703b8, 0x58f4c14e, 0x56364321, 0x536d3a71,
+	0x509b5efd, 0x4dc26df5, 0x4ae428e9, 0x480254af,
+	0x451eb852, 0x423b1bf5, 0x3f5947bb, 0x3c7b02ae,
+	0x39a211a7, 0x36d03633, 0x34072d83, 0x3148af56,
+	0x2e966cec, 0x2bf20ff7, 0x295d3999, 0x26d98161,
+	0x2468744e, 0x220b93dd, 0x1fc45518, 0x1d941fb4,
+	0x1b7c4d2f, 0x197e27fe, 0x179aeac0, 0x15d3bf7c,
+	0x1429bee8, 0x129defbe, 0x1131461b, 0x0fe4a2e2,
+	0x0eb8d33b, 0x0dae900b, 0x0cc67d89, 0x0c012ad5,
+	0x0b5f11a0, 0x0ae095e3, 0x0a86059f, 0x0a4f98af,
+};
+
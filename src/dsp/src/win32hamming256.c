@@ -0,0 +1,70 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32hamming256[256] =
+{
+	0x0a3d70a4, 0x0a41fad4, 0x0a4f98af, 0x0a66481e,
+	0x0a86059f, 0x0aaecc4f, 0x0ae095e3, 0x0b1b5aae,
+	0x0b5f11a0, 0x0babb048, 0x0c012ad5, 0x0c5f7419,
+	0x0cc67d89, 0x0d363743, 0x0dae900b, 0x0e2f7553,
+	0x0eb8d33b, 0x0f4a9493, 0x0fe4a2e2, 0x1086e667,
+	0x1131461b, 0x11e3a7b8, 0x129defbe, 0x13600172,
+	0x1429bee8, 0x14fb0902, 0x15d3bf7c, 0x16b3c0e9,
+	0x179aeac0, 0x1889195b, 0x197e27fe, 0x1a79f0e1,
+	0x1b7c4d2f, 0x1c851511, 0x1d941fb4, 0x1ea9434a,
+	0x1fc45518, 0x20e52977, 0x220b93dd, 0x233766e3,
+	0x2468744e, 0x259e8d13, 0x26d98161, 0x281920a6,
+	0x295d3999, 0x2aa59a40, 0x2bf20ff7, 0x2d42677a,
+	0x2e966cec, 0x2fedebdd, 0x3148af56, 0x32a681de,
+	0x34072d83, 0x356a7be3, 0x36d03633, 0x3838254a,
+	0x39a211a7, 0x3b0dc37a, 0x3c7b02ae, 0x3de996f1,
+	0x3f5947bb, 0x40c9dc59, 0x423b1bf5, 0x43accd9e,
+	0x451eb852, 0x4690a306, 0x480254af, 0x4973944b,
+	0x4ae428e9, 0x4c53d9b3, 0x4dc26df5, 0x4f2fad2a,
+	0x509b5efd, 0x52054b5a, 0x536d3a71, 0x54d2f4c1,
+	0x56364321, 0x5796eec6, 0x58f4c14e, 0x5a4f84c7,
+	0x5ba703b8, 0x5cfb092a, 0x5e4b60ad, 0x5f97d664,
+	0x60e0370b, 0x62244ffe, 0x6363ef43, 0x649ee391,
+	0x65d4fc56, 0x670609c1, 0x6831dcc7, 0x6958472d,
+	0x6a791b8c, 0x6b942d5a, 0x6ca950f0, 0x6db85b92,
+	0x6ec12375, 0x6fc37fc3, 0x70bf48a6, 0x71b45749,
+	0x72a285e4, 0x7389afbb, 0x7469b128, 0x754267a2,
+	0x7613b1bc, 0x76dd6f31, 0x779f80e6, 0x7859c8eb,
+	0x790c2a89, 0x79b68a3d, 0x7a58cdc1, 0x7af2dc10,
+	0x7b849d69, 0x7c0dfb50, 0x7c8ee098, 0x7d073961,
+	0x7d76f31b, 0x7dddfc8b, 0x7e3c45cf, 0x7e91c05c,
+	0x7ede5f04, 0x7f2215f6, 0x7f5cdac1, 0x7f8ea455,
+	0x7fb76b04, 0x7fd72886, 0x7fedd7f4, 0x7ffb75d0,
+	0x7fffffff, 0x7ffb75d0, 0x7fedd7f4, 0x7fd72886,
+	0x7fb76b04, 0x7f8ea455, 0x7f5cdac1, 0x7f2215f6,
+	0x7ede5f04, 0x7e91c05c, 0x7e3c45cf, 0x7dddfc8b,
+	0x7d76f31b, 0x7d073961, 0x7c8ee098, 0x7c0dfb50,
+	0x7b849d69, 0x7af2dc10, 0x7a58cdc1, 0x79b68a3d,
+	0x790c2a89, 0x7859c8eb, 0x779f80e6, 0x76dd6f31,
+	0x7613b1bc, 0x754267a2, 0x7469b128, 0x7389afbb,
+	0x72a285e4, 0x71b45749, 0x70bf48a6, 0x6fc37fc3,
+	0x6ec12375, 0x6db85b92, 0x6ca950f0, 0x6b942d5a,
+	0x6a791b8c, 0x6958472d, 0x6831dcc7, 0x670609c1,
+	0x65d4fc56, 0x649ee391, 0x6363ef43, 0x62244ffe,
+	0x60e0370b, 0x5f97d664, 0x5e4b60ad, 0x5cfb092a,
+	0x5ba703b8, 0x5a4f84c7, 0x58f4c14e, 0x5796eec6,
+	0x56364321, 0x54d2f4c1, 0x536d3a71, 0x52054b5a,
+	0x509b5efd, 0x4f2fad2a, 0x4dc26df5, 0x4c53d9b3,
+	0x4ae428e9, 0x4973944b, 0x480254af, 0x4690a306,
+	0x451eb852, 0x43accd9e, 0x423b1bf5, 0x40c9dc59,
+	0x3f5947bb, 0x3de996f1, 0x3c7b02ae, 0x3b0dc37a,
+	0x39a211a7, 0x3838254a, 0x36d03633, 0x356a7be3,
+	0x34072d83, 0x32a681de, 0x3148af56, 0x2fedebdd,
+	0x2e966cec, 0x2d42677a, 0x2bf20ff7, 0x2aa59a40,
+	0x295d3999, 0x281920a6, 0x26d98161, 0x259e8d13,
+	0x2468744e, 0x233766e3, 0x220b93dd, 0x20e52977,
+	0x1fc45518, 0x1ea9434a, 0x1d941fb4, 0x1c851511,
+	0x1b7c4d2f, 0x1a79f0e1, 0x197e27fe, 0x1889195b,
+	0x179aeac0, 0x16b3c0e9, 0x15d3bf7c, 0x14fb0902,
+	0x1429bee8, 0x13600172, 0x129defbe, 0x11e3a7b8,
+	0x1131461b, 0x1086e667, 0x0fe4a2e2, 0x0f4a9493,
+	0x0eb8d33b, 0x0e2f7553, 0x0dae900b, 0x0d363743,
+	0x0cc67d89, 0x0c5f7419, 0x0c012ad5, 0x0babb048,
+	0x0b5f11a0, 0x0b1b5aae, 0x0ae095e3, 0x0aaecc4f,
+	0x0a86059f, 0x0a66481e, 0x0a4f98af, 0x0a41fad4,
+};
+
@@ -0,0 +1,134 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32hamming512[512] =
+{
+	0x0a3d70a4, 0x0a3e9333, 0x0a41fad4, 0x0a47a765,
+	0x0a4f98af, 0x0a59ce64, 0x0a66481e, 0x0a750562,
+	0x0a86059f, 0x0a99482e, 0x0aaecc4f, 0x0ac6912f,
+	0x0ae095e3, 0x0afcd96a, 0x0b1b5aae, 0x0b3c1881,
+	0x0b5f11a0, 0x0b8444b2, 0x0babb048, 0x0bd552dd,
+	0x0c012ad5, 0x0c2f3681, 0x0c5f7419, 0x0c91e1c2,
+	0x0cc67d89, 0x0cfd4569, 0x0d363743, 0x0d7150e6,
+	0x0dae900b, 0x0dedf256, 0x0e2f7553, 0x0e73167e,
+	0x0eb8d33b, 0x0f00a8d9, 0x0f4a9493, 0x0f969391,
+	0x0fe4a2e2, 0x1034bf87, 0x1086e667, 0x10db1458,
+	0x1131461b, 0x1189785d, 0x11e3a7b8, 0x123fd0b3,
+	0x129defbe, 0x12fe013a, 0x13600172, 0x13c3eca0,
+	0x1429bee8, 0x1491745e, 0x14fb0902, 0x156678c3,
+	0x15d3bf7c, 0x1642d8f6, 0x16b3c0e9, 0x172672fb,
+	0x179aeac0, 0x181123ba, 0x1889195b, 0x1902c702,
+	0x197e27fe, 0x19fb378f, 0x1a79f0e1, 0x1afa4f12,
+	0x1b7c4d2f, 0x1bffe635, 0x1c851511, 0x1d0bd4a2,
+	0x1d941fb4, 0x1e1df107, 0x1ea9434a, 0x1f36111f,
+	0x1fc45518, 0x205409b9, 0x20e52977, 0x2177aeba,
+	0x220b93dd, 0x22a0d32b, 0x233766e3, 0x23cf4938,
+	0x2468744e, 0x2502e23e, 0x259e8d13, 0x263b6ece,
+	0x26d98161, 0x2778beb5, 0x281920a6, 0x28baa106,
+	0x295d3999, 0x2a00e41c, 0x2aa59a40, 0x2b4b55aa,
+	0x2bf20ff7, 0x2c99c2b9, 0x2d42677a, 0x2debf7b9,
+	0x2e966cec, 0x2f41c081, 0x2fedebdd, 0x309ae85d,
+	0x3148af56, 0x31f73a15, 0x32a681de, 0x33567ff1,
+	0x34072d83, 0x34b883c6, 0x356a7be3, 0x361d0efd,
+	0x36d03633, 0x3783ea9c, 0x3838254a, 0x38ecdf4b,
+	0x39a211a7, 0x3a57b561, 0x3b0dc37a, 0x3bc434ec,
+	0x3c7b02ae, 0x3d3225b5, 0x3de996f1, 0x3ea14f50,
+	0x3f5947bb, 0x4011791c, 0x40c9dc59, 0x41826a56,
+	0x423b1bf5, 0x42f3ea18, 0x43accd9e, 0x4465bf67,
+	0x451eb852, 0x45d7b13d, 0x4690a306, 0x4749868c,
+	0x480254af, 0x48bb064e, 0x4973944b, 0x4a2bf788,
+	0x4ae428e9, 0x4b9c2154, 0x4c53d9b3, 0x4d0b4aef,
+	0x4dc26df5, 0x4e793bb8, 0x4f2fad2a, 0x4fe5bb42,
+	0x509b5efd, 0x51509159, 0x52054b5a, 0x52b98608,
+	0x536d3a71, 0x542061a7, 0x54d2f4c1, 0x5584ecde,
+	0x56364321, 0x56e6f0b3, 0x5796eec6, 0x5846368f,
+	0x58f4c14e, 0x59a28846, 0x5a4f84c7, 0x5afbb023,
+	0x5ba703b8, 0x5c5178eb, 0x5cfb092a, 0x5da3adeb,
+	0x5e4b60ad, 0x5ef21afa, 0x5f97d664, 0x603c8c87,
+	0x60e0370b, 0x6182cf9e, 0x62244ffe, 0x62c4b1ef,
+	0x6363ef43, 0x640201d6, 0x649ee391, 0x653a8e66,
+	0x65d4fc56, 0x666e276c, 0x670609c1, 0x679c9d79,
+	0x6831dcc7, 0x68c5c1ea, 0x6958472d, 0x69e966eb,
+	0x6a791b8c, 0x6b075f85, 0x6b942d5a, 0x6c1f7f9d,
+	0x6ca950f0, 0x6d319c02, 0x6db85b92, 0x6e3d8a6f,
+	0x6ec12375, 0x6f432192, 0x6fc37fc3, 0x70423915,
+	0x70bf48a6, 0x713aa9a2, 0x71b45749, 0x722c4cea,
+	0x72a285e4, 0x7316fda9, 0x7389afbb, 0x73fa97ae,
+	0x7469b128, 0x74d6f7e1, 0x754267a2, 0x75abfc46,
+	0x7613b1bc, 0x76798404, 0x76dd6f31, 0x773f6f6a,
+	0x779f80e6, 0x77fd9ff1, 0x7859c8eb, 0x78b3f847,
+	0x790c2a89, 0x79625c4c, 0x79b68a3d, 0x7a08b11d,
+	0x7a58cdc1, 0x7aa6dd13, 0x7af2dc10, 0x7b3cc7cb,
+	0x7b849d69, 0x7bca5a25, 0x7c0dfb50, 0x7c4f7e4e,
+	0x7c8ee098, 0x7ccc1fbe, 0x7d073961, 0x7d402b3b,
+	0x7d76f31b, 0x7dab8ee2, 0x7dddfc8b, 0x7e0e3a23,
+	0x7e3c45cf, 0x7e681dc7, 0x7e91c05c, 0x7eb92bf2,
+	0x7ede5f04, 0x7f015823, 0x7f2215f6, 0x7f409739,
+	0x7f5cdac1, 0x7f76df75, 0x7f8ea455, 0x7fa42876,
+	0x7fb76b04, 0x7fc86b42, 0x7fd72886, 0x7fe3a240,
+	0x7fedd7f4, 0x7ff5c93f, 0x7ffb75d0, 0x7ffedd71,
+	0x7fffffff, 0x7ffedd71, 0x7ffb75d0, 0x7ff5c93f,
+	0x7fedd7f4, 0x7fe3a240, 0x7fd72886, 0x7fc86b42,
+	0x7fb76b04, 0x7fa42876, 0x7f8ea455, 0x7f76df75,
+	0x7f5cdac1, 0x7f409739, 0x7f2215f6, 0x7f015823,
+	0x7ede5f04, 0x7eb92bf2, 0x7e91c05c, 0x7e681dc7,
+	0x7e3c45cf, 0x7e0e3a23, 0x7dddfc8b, 0x7dab8ee2,
+	0x7d76f31b, 0x7d402b3b, 0x7d073961, 0x7ccc1fbe,
+	0x7c8ee098, 0x7c4f7e4e, 0x7c0dfb50, 0x7bca5a25,
+	0x7b849d69, 0x7b3cc7cb, 0x7af2dc10, 0x7aa6dd13,
+	0x7a58cdc1, 0x7a08b11d, 0x79b68a3d, 0x79625c4c,
+	0x790c2a89, 0x78b3f847, 0x7859c8eb, 0x77fd9ff1,
+	0x779f80e6, 0x773f6f6a, 0x76dd6f31, 0x76798404,
+	0x7613b1bc, 0x75abfc46, 0x754267a2, 0x74d6f7e1,
+	0x7469b128, 0x73fa97ae, 0x7389afbb, 0x7316fda9,
+	0x72a285e4, 0x722c4cea, 0x71b45749, 0x713aa9a2,
+	0x70bf48a6, 0x70423915, 0x6fc37fc3, 0x6f432192,
+	0x6ec12375, 0x6e3d8a6f, 0x6db85b92, 0x6d319c02,
+	0x6ca950f0, 0x6c1f7f9d, 0x6b942d5a, 0x6b075f85,
+	0x6a791b8c, 0x69e966eb, 0x6958472d, 0x68c5c1ea,
+	0x6831dcc7, 0x679c9d79, 0x670609c1, 0x666e276c,
+	0x65d4fc56, 0x653a8e66, 0x649ee391, 0x640201d6,
+	0x6363ef43, 0x62c4b1ef, 0x62244ffe, 0x6182cf9e,
+	0x60e0370b, 0x603c8c87, 0x5f97d664, 0x5ef21afa,
+	0x5e4b60ad, 0x5da3adeb, 0x5cfb092a, 0x5c5178eb,
+	0x5ba703b8, 0x5afbb023, 0x5a4f84c7, 0x59a28846,
+	0x58f4c14e, 0x5846368f, 0x5796eec6, 0x56e6f0b3,
+	0x56364321, 0x5584ecde, 0x54d2f4c1, 0x542061a7,
+	0x536d3a71, 0x52b98608, 0x52054b5a, 0x51509159,
+	0x509b5efd, 0x4fe5bb42, 0x4f2fad2a, 0x4e793bb8,
+	0x4dc26df5, 0x4d0b4aef, 0x4c53d9b3, 0x4b9c2154,
+	0x4ae428e9, 0x4a2bf788, 0x4973944b, 0x48bb064e,
+	0x480254af, 0x4749868c, 0x4690a306, 0x45d7b13d,
+	0x451eb852, 0x4465bf67, 0x43accd9e, 0x42f3ea18,
+	0x423b1bf5, 0x41826a56, 0x40c9dc59, 0x4011791c,
+	0x3f5947bb, 0x3ea14f50, 0x3de996f1, 0x3d3225b5,
+	0x3c7b02ae, 0x3bc434ec, 0x3b0dc37a, 0x3a57b561,
+	0x39a211a7, 0x38ecdf4b, 0x3838254a, 0x3783ea9c,
+	0x36d03633, 0x361d0efd, 0x356a7be3, 0x34b883c6,
+	0x34072d83, 0x33567ff1, 0x32a681de, 0x31f73a15,
+	0x3148af56, 0x309ae85d, 0x2fedebdd, 0x2f41c081,
+	0x2e966cec, 0x2debf7b9, 0x2d42677a, 0x2c99c2b9,
+	0x2bf20ff7, 0x2b4b55aa, 0x2aa59a40, 0x2a00e41c,
+	0x295d3999, 0x28baa106, 0x281920a6, 0x2778beb5,
+	0x26d98161, 0x263b6ece, 0x259e8d13, 0x2502e23e,
+	0x2468744e, 0x23cf4938, 0x233766e3, 0x22a0d32b,
+	0x220b93dd, 0x2177aeba, 0x20e52977, 0x205409b9,
+	0x1fc45518, 0x1f36111f, 0x1ea9434a, 0x1e1df107,
+	0x1d941fb4, 0x1d0bd4a2, 0x1c851511, 0x1bffe635,
+	0x1b7c4d2f, 0x1afa4f12, 0x1a79f0e1, 0x19fb378f,
+	0x197e27fe, 0x1902c702, 0x1889195b, 0x181123ba,
+	0x179aeac0, 0x172672fb, 0x16b3c0e9, 0x1642d8f6,
+	0x15d3bf7c, 0x156678c3, 0x14fb0902, 0x1491745e,
+	0x1429bee8, 0x13c3eca0, 0x13600172, 0x12fe013a,
+	0x129defbe, 0x123fd0b3, 0x11e3a7b8, 0x1189785d,
+	0x1131461b, 0x10db1458, 0x1086e667, 0x1034bf87,
+	0x0fe4a2e2, 0x0f969391, 0x0f4a9493, 0x0f00a8d9,
+	0x0eb8d33b, 0x0e73167e, 0x0e2f7553, 0x0dedf256,
+	0x0dae900b, 0x0d7150e6, 0x0d363743, 0x0cfd4569,
+	0x0cc67d89, 0x0c91e1c2, 0x0c5f7419, 0x0c2f3681,
+	0x0c012ad5, 0x0bd552dd, 0x0babb048, 0x0b8444b2,
+	0x0b5f11a0, 0x0b3c1881, 0x0b1b5aae, 0x0afcd96a,
+	0x0ae095e3, 0x0ac6912f, 0x0aaecc4f, 0x0a99482e,
+	0x0a86059f, 0x0a750562, 0x0a66481e, 0x0a59ce64,
+	0x0a4f98af, 0x0a47a765, 0x0a41fad4, 0x0a3e9333,
+};
+
@@ -0,0 +1,22 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32hamming64[64] =
+{
+	0x0a3d70a4, 0x0a86059f, 0x0b5f11a0, 0x0cc67d89,
+	0x0eb8d33b, 0x1131461b, 0x1429bee8, 0x179aeac0,
+	0x1b7c4d2f, 0x1fc45518, 0x2468744e, 0x295d3999,
+	0x2e966cec, 0x34072d83, 0x39a211a7, 0x3f5947bb,
+	0x451eb852, 0x4ae428e9, 0x509b5efd, 0x56364321,
+	0x5ba703b8, 0x60e0370b, 0x65d4fc56, 0x6a791b8c,
+	0x6ec12375, 0x72a285e4, 0x7613b1bc, 0x790c2a89,
+	0x7b849d69, 0x7d76f31b, 0x7ede5f04, 0x7fb76b04,
+	0x7fffffff, 0x7fb76b04, 0x7ede5f04, 0x7d76f31b,
+	0x7b849d69, 0x790c2a89, 0x7613b1bc, 0x72a285e4,
+	0x6ec12375, 0x6a791b8c, 0x65d4fc56, 0x60e0370b,
+	0x5ba703b8, 0x56364321, 0x509b5efd, 0x4ae428e9,
+	0x451eb852, 0x3f5947bb, 0x39a211a7, 0x34072d83,
+	0x2e966cec, 0x295d3999, 0x2468744e, 0x1fc45518,
+	0x1b7c4d2f, 0x179aeac0, 0x1429bee8, 0x1131461b,
+	0x0eb8d33b, 0x0cc67d89, 0x0b5f11a0, 0x0a86059f,
+};
+
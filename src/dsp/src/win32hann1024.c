@@ -0,0 +1,262 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32hann1024[1024] =
+{
+	0x00000000, 0x00004ef5, 0x00013bd3, 0x0002c697,
+	0x0004ef3f, 0x0007b5c4, 0x000b1a20, 0x000f1c4a,
+	0x0013bc39, 0x0018f9e1, 0x001ed535, 0x00254e27,
+	0x002c64a6, 0x003418a2, 0x003c6a07, 0x004558c0,
+	0x004ee4b8, 0x00590dd8, 0x0063d405, 0x006f3726,
+	0x007b371e, 0x0087d3d0, 0x00950d1d, 0x00a2e2e3,
+	0x00b15502, 0x00c06355, 0x00d00db6, 0x00e05401,
+	0x00f1360b, 0x0102b3ac, 0x0114ccb9, 0x01278104,
+	0x013ad060, 0x014eba9d, 0x01633f8a, 0x01785ef4,
+	0x018e18a7, 0x01a46c6e, 0x01bb5a11, 0x01d2e158,
+	0x01eb0209, 0x0203bbe8, 0x021d0eb8, 0x0236fa3b,
+	0x02517e31, 0x026c9a58, 0x02884e6e, 0x02a49a2e,
+	0x02c17d52, 0x02def794, 0x02fd08a9, 0x031bb049,
+	0x033aee27, 0x035ac1f7, 0x037b2b6a, 0x039c2a2f,
+	0x03bdbdf6, 0x03dfe66c, 0x0402a33c, 0x0425f410,
+	0x0449d892, 0x046e5069, 0x04935b3c, 0x04b8f8ad,
+	0x04df2862, 0x0505e9fb, 0x052d3d18, 0x0555215a,
+	0x057d965d, 0x05a69bbe, 0x05d03118, 0x05fa5603,
+	0x06250a18, 0x06504ced, 0x067c1e18, 0x06a87d2d,
+	0x06d569be, 0x0702e35c, 0x0730e997, 0x075f7bfe,
+	0x078e9a1d, 0x07be4381, 0x07ee77b3, 0x081f363d,
+	0x08507ea7, 0x08825077, 0x08b4ab32, 0x08e78e5b,
+	0x091af976, 0x094eec03, 0x09836582, 0x09b86572,
+	0x09edeb50, 0x0a23f698, 0x0a5a86c4, 0x0a919b4e,
+	0x0ac933ae, 0x0b014f5b, 0x0b39edca, 0x0b730e70,
+	0x0bacb0bf, 0x0be6d42b, 0x0c217822, 0x0c5c9c14,
+	0x0c983f70, 0x0cd461a2, 0x0d110216, 0x0d4e2037,
+	0x0d8bbb6d, 0x0dc9d320, 0x0e0866b8, 0x0e47759a,
+	0x0e86ff2a, 0x0ec702cb, 0x0f077fe1, 0x0f4875ca,
+	0x0f89e3e8, 0x0fcbc999, 0x100e2639, 0x1050f926,
+	0x109441bb, 0x10d7ff51, 0x111c3142, 0x1160d6e5,
+	0x11a5ef90, 0x11eb7a9a, 0x12317756, 0x1277e518,
+	0x12bec333, 0x130610f7, 0x134dcdb4, 0x1395f8ba,
+	0x13de9156, 0x142796d5, 0x14710883, 0x14bae5ab,
+	0x15052d97, 0x154fdf8f, 0x159afadb, 0x15e67ec1,
+	0x16326a88, 0x167ebd74, 0x16cb76c9, 0x171895c9,
+	0x176619b6, 0x17b401d1, 0x18024d59, 0x1850fb8e,
+	0x18a00bae, 0x18ef7cf4, 0x193f4e9e, 0x198f7fe6,
+	0x19e01006, 0x1a30fe38, 0x1a8249b4, 0x1ad3f1b1,
+	0x1b25f566, 0x1b785409, 0x1bcb0cce, 0x1c1e1ee9,
+	0x1c71898d, 0x1cc54bec, 0x1d196538, 0x1d6dd4a2,
+	0x1dc29958, 0x1e17b28a, 0x1e6d1f65, 0x1ec2df18,
+	0x1f18f0ce, 0x1f6f53b3, 0x1fc606f1, 0x201d09b4,
+	0x20745b24, 0x20cbfa6a, 0x2123e6ad, 0x217c1f15,
+	0x21d4a2c8, 0x222d70eb, 0x228688a4, 0x22dfe917,
+	0x23399167, 0x239380b6, 0x23edb628, 0x244830dd,
+	0x24a2eff6, 0x24fdf294, 0x255937d5, 0x25b4bed8,
+	0x261086bc, 0x266c8e9f, 0x26c8d59c, 0x27255ad1,
+	0x27821d59, 0x27df1c50, 0x283c56cf, 0x2899cbf1,
+	0x28f77acf, 0x29556282, 0x29b38223, 0x2a11d8c8,
+	0x2a70658a, 0x2acf277f, 0x2b2e1dbe, 0x2b8d475b,
+	0x2beca36c, 0x2c4c3106, 0x2cabef3d, 0x2d0bdd25,
+	0x2d6bf9d1, 0x2dcc4454, 0x2e2cbbc1, 0x2e8d5f29,
+	0x2eee2d9d, 0x2f4f2630, 0x2fb047f2, 0x301191f3,
+	0x30730342, 0x30d49af1, 0x3136580d, 0x319839a6,
+	0x31fa3ecb, 0x325c6688, 0x32beafed, 0x33211a07,
+	0x3383a3e2, 0x33e64c8c, 0x34491311, 0x34abf67e,
+	0x350ef5de, 0x3572103d, 0x35d544a7, 0x36389228,
+	0x369bf7c9, 0x36ff7496, 0x37630799, 0x37c6afdc,
+	0x382a6c6a, 0x388e3c4d, 0x38f21e8e, 0x39561237,
+	0x39ba1651, 0x3a1e29e5, 0x3a824bfd, 0x3ae67ba2,
+	0x3b4ab7db, 0x3baeffb3, 0x3c135231, 0x3c77ae5e,
+	0x3cdc1342, 0x3d407fe6, 0x3da4f351, 0x3e096c8d,
+	0x3e6deaa1, 0x3ed26c94, 0x3f36f170, 0x3f9b783c,
+	0x40000000, 0x406487c4, 0x40c90e90, 0x412d936c,
+	0x4192155f, 0x41f69373, 0x425b0caf, 0x42bf801a,
+	0x4323ecbe, 0x438851a2, 0x43ecadcf, 0x4451004d,
+	0x44b54825, 0x4519845e, 0x457db403, 0x45e1d61b,
+	0x4645e9af, 0x46a9edc9, 0x470de172, 0x4771c3b3,
+	0x47d59396, 0x48395024, 0x489cf867, 0x49008b6a,
+	0x49640837, 0x49c76dd8, 0x4a2abb59, 0x4a8defc3,
+	0x4af10a22, 0x4b540982, 0x4bb6ecef, 0x4c19b374,
+	0x4c7c5c1e, 0x4cdee5f9, 0x4d415013, 0x4da39978,
+	0x4e05c135, 0x4e67c65a, 0x4ec9a7f3, 0x4f2b650f,
+	0x4f8cfcbe, 0x4fee6e0d, 0x504fb80e, 0x50b0d9d0,
+	0x5111d263, 0x5172a0d7, 0x51d3443f, 0x5233bbac,
+	0x5294062f, 0x52f422db, 0x535410c3, 0x53b3cefa,
+	0x54135c94, 0x5472b8a5, 0x54d1e242, 0x5530d881,
+	0x558f9a76, 0x55ee2738, 0x564c7ddd, 0x56aa9d7e,
+	0x57088531, 0x5766340f, 0x57c3a931, 0x5820e3b0,
+	0x587de2a7, 0x58daa52f, 0x59372a64, 0x59937161,
+	0x59ef7944, 0x5a4b4128, 0x5aa6c82b, 0x5b020d6c,
+	0x5b5d100a, 0x5bb7cf23, 0x5c1249d8, 0x5c6c7f4a,
+	0x5cc66e99, 0x5d2016e9, 0x5d79775c, 0x5dd28f15,
+	0x5e2b5d38, 0x5e83e0eb, 0x5edc1953, 0x5f340596,
+	0x5f8ba4dc, 0x5fe2f64c, 0x6039f90f, 0x6090ac4d,
+	0x60e70f32, 0x613d20e8, 0x6192e09b, 0x61e84d76,
+	0x623d66a8, 0x62922b5e, 0x62e69ac8, 0x633ab414,
+	0x638e7673, 0x63e1e117, 0x6434f332, 0x6487abf7,
+	0x64da0a9a, 0x652c0e4f, 0x657db64c, 0x65cf01c8,
+	0x661feffa, 0x6670801a, 0x66c0b162, 0x6710830c,
+	0x675ff452, 0x67af0472, 0x67fdb2a7, 0x684bfe2f,
+	0x6899e64a, 0x68e76a37, 0x69348937, 0x6981428c,
+	0x69cd9578, 0x6a19813f, 0x6a650525, 0x6ab02071,
+	0x6afad269, 0x6b451a55, 0x6b8ef77d, 0x6bd8692b,
+	0x6c216eaa, 0x6c6a0746, 0x6cb2324c, 0x6cf9ef09,
+	0x6d413ccd, 0x6d881ae8, 0x6dce88aa, 0x6e148566,
+	0x6e5a1070, 0x6e9f291b, 0x6ee3cebe, 0x6f2800af,
+	0x6f6bbe45, 0x6faf06da, 0x6ff1d9c7, 0x70343667,
+	0x70761c18, 0x70b78a36, 0x70f8801f, 0x7138fd35,
+	0x717900d6, 0x71b88a66, 0x71f79948, 0x72362ce0,
+	0x72744493, 0x72b1dfc9, 0x72eefdea, 0x732b9e5e,
+	0x7367c090, 0x73a363ec, 0x73de87de, 0x74192bd5,
+	0x74534f41, 0x748cf190, 0x74c61236, 0x74feb0a5,
+	0x7536cc52, 0x756e64b2, 0x75a5793c, 0x75dc0968,
+	0x761214b0, 0x76479a8e, 0x767c9a7e, 0x76b113fd,
+	0x76e5068a, 0x771871a5, 0x774b54ce, 0x777daf89,
+	0x77af8159, 0x77e0c9c3, 0x7811884d, 0x7841bc7f,
+	0x787165e3, 0x78a08402, 0x78cf1669, 0x78fd1ca4,
+	0x792a9642, 0x795782d3, 0x7983e1e8, 0x79afb313,
+	0x79daf5e8, 0x7a05a9fd, 0x7a2fcee8, 0x7a596442,
+	0x7a8269a3, 0x7aaadea6, 0x7ad2c2e8, 0x7afa1605,
+	0x7b20d79e, 0x7b470753, 0x7b6ca4c4, 0x7b91af97,
+	0x7bb6276e, 0x7bda0bf0, 0x7bfd5cc4, 0x7c201994,
+	0x7c42420a, 0x7c63d5d1, 0x7c84d496, 0x7ca53e09,
+	0x7cc511d9, 0x7ce44fb7, 0x7d02f757, 0x7d21086c,
+	0x7d3e82ae, 0x7d5b65d2, 0x7d77b192, 0x7d9365a8,
+	0x7dae81cf, 0x7dc905c5, 0x7de2f148, 0x7dfc4418,
+	0x7e14fdf7, 0x7e2d1ea8, 0x7e44a5ef, 0x7e5b9392,
+	0x7e71e759, 0x7e87a10c, 0x7e9cc076, 0x7eb14563,
+	0x7ec52fa0, 0x7ed87efc, 0x7eeb3347, 0x7efd4c54,
+	0x7f0ec9f5, 0x7f1fabff, 0x7f2ff24a, 0x7f3f9cab,
+	0x7f4eaafe, 0x7f5d1d1d, 0x7f6af2e3, 0x7f782c30,
+	0x7f84c8e2, 0x7f90c8da, 0x7f9c2bfb, 0x7fa6f228,
+	0x7fb11b48, 0x7fbaa740, 0x7fc395f9, 0x7fcbe75e,
+	0x7fd39b5a, 0x7fdab1d9, 0x7fe12acb, 0x7fe7061f,
+	0x7fec43c7, 0x7ff0e3b6, 0x7ff4e5e0, 0x7ff84a3c,
+	0x7ffb10c1, 0x7ffd3969, 0x7ffec42d, 0x7fffb10b,
+	0x7fffffff, 0x7fffb10b, 0x7ffec42d, 0x7ffd3969,
+	0x7ffb10c1, 0x7ff84a3c, 0x7ff4e5e0, 0x7ff0e3b6,
+	0x7fec43c7, 0x7fe7061f, 0x7fe12acb, 0x7fdab1d9,
+	0x7fd39b5a, 0x7fcbe75e, 0x7fc395f9, 0x7fbaa740,
+	0x7fb11b48, 0x7fa6f228, 0x7f9c2bfb, 0x7f90c8da,
+	0x7f84c8e2, 0x7f782c30, 0x7f6af2e3, 0x7f5d1d1d,
+	0x7f4eaafe, 0x7f3f9cab, 0x7f2ff24a, 0x7f1fabff,
+	0x7f0ec9f5, 0x7efd4c54, 0x7eeb3347, 0x7ed87efc,
+	0x7ec52fa0, 0x7eb14563, 0x7e9cc076, 0x7e87a10c,
+	0x7e71e759, 0x7e5b9392, 0x7e44a5ef, 0x7e2d1ea8,
+	0x7e14fdf7, 0x7dfc4418, 0x7de2f148, 0x7dc905c5,
+	0x7dae81cf, 0x7d9365a8, 0x7d77b192, 0x7d5b65d2,
+	0x7d3e82ae, 0x7d21086c, 0x7d02f757, 0x7ce44fb7,
+	0x7cc511d9, 0x7ca53e09, 0x7c84d496, 0x7c63d5d1,
+	0x7c42420a, 0x7c201994, 0x7bfd5cc4, 0x7bda0bf0,
+	0x7bb6276e, 0x7b91af97, 0x7b6ca4c4, 0x7b470753,
+	0x7b20d79e, 0x7afa1605, 0x7ad2c2e8, 0x7aaadea6,
+	0x7a8269a3, 0x7a596442, 0x7a2fcee8, 0x7a05a9fd,
+	0x79daf5e8, 0x79afb313, 0x7983e1e8, 0x795782d3,
+	0x792a9642, 0x78fd1ca4, 0x78cf1669, 0x78a08402,
+	0x787165e3, 0x7841bc7f, 0x7811884d, 0x77e0c9c3,
+	0x77af8159, 0x777daf89, 0x774b54ce, 0x771871a5,
+	0x76e5068a, 0x76b113fd, 0x767c9a7e, 0x76479a8e,
+	0x761214b0, 0x75dc0968, 0x75a5793c, 0x756e64b2,
+	0x7536cc52, 0x74feb0a5, 0x74c61236, 0x748cf190,
+	0x74534f41, 0x74192bd5, 0x73de87de, 0x73a363ec,
+	0x7367c090, 0x732b9e5e, 0x72eefdea, 0x72b1dfc9,
+	0x72744493, 0x72362ce0, 0x71f79948, 0x71b88a66,
+	0x717900d6, 0x7138fd35, 0x70f8801f, 0x70b78a36,
+	0x70761c18, 0x70343667, 0x6ff1d9c7, 0x6faf06da,
+	0x6f6bbe45, 0x6f2800af, 0x6ee3cebe, 0x6e9f291b,
+	0x6e5a1070, 0x6e148566, 0x6dce88aa, 0x6d881ae8,
+	0x6d413ccd, 0x6cf9ef09, 0x6cb2324c, 0x6c6a0746,
+	0x6c216eaa, 0x6bd8692b, 0x6b8ef77d, 0x6b451a55,
+	0x6afad269, 0x6ab02071, 0x6a650525, 0x6a19813f,
+	0x69cd9578, 0x6981428c, 0x69348937, 0x68e76a37,
+	0x6899e64a, 0x684bfe2f, 0x67fdb2a7, 0x67af0472,
+	0x675ff452, 0x6710830c, 0x66c0b162, 0x6670801a,
+	0x661feffa, 0x65cf01c8, 0x657db64c, 0x652c0e4f,
+	0x64da0a9a, 0x6487abf7, 0x6434f332, 0x63e1e117,
+	0x638e7673, 0x633ab414, 0x62e69ac8, 0x62922b5e,
+	0x623d66a8, 0x61e84d76, 0x6192e09b, 0x613d20e8,
+	0x60e70f32, 0x6090ac4d, 0x6039f90f, 0x5fe2f64c,
+	0x5f8ba4dc, 0x5f340596, 0x5edc1953, 0x5e83e0eb,
+	0x5e2b5d38, 0x5dd28f15, 0x5d79775c, 0x5d2016e9,
+	0x5cc66e99, 0x5c6c7f4a, 0x5c1249d8, 0x5bb7cf23,
+	0x5b5d100a, 0x5b020d6c, 0x5aa6c82b, 0x5a4b4128,
+	0x59ef7944, 0x59937161, 0x59372a64, 0x58daa52f,
+	0x587de2a7, 0x5820e3b0, 0x57c3a931, 0x5766340f,
+	0x57088531, 0x56aa9d7e, 0x564c7ddd, 0x55ee2738,
+	0x558f9a76, 0x5530d881, 0x54d1e242, 0x5472b8a5,
+	0x54135c94, 0x53b3cefa, 0x535410c3, 0x52f422db,
+	0x5294062f, 0x5233bbac, 0x51d3443f, 0x5172a0d7,
+	0x5111d263, 0x50b0d9d0, 0x504fb80e, 0x4fee6e0d,
+	0x4f8cfcbe, 0x4f2b650f, 0x4ec9a7f3, 0x4e67c65a,
+	0x4e05c135, 0x4da39978, 0x4d415013, 0x4cdee5f9,
+	0x4c7c5c1e, 0x4c19b374, 0x4bb6ecef, 0x4b540982,
+	0x4af10a22, 0x4a8defc3, 0x4a2abb59, 0x49c76dd8,
+	0x49640837, 0x49008b6a, 0x489cf867, 0x48395024,
+	0x47d59396, 0x4771c3b3, 0x470de172, 0x46a9edc9,
+	0x4645e9af, 0x45e1d61b, 0x457db403, 0x4519845e,
+	0x44b54825, 0x4451004d, 0x43ecadcf, 0x438851a2,
+	0x4323ecbe, 0x42bf801a, 0x425b0caf, 0x41f69373,
+	0x4192155f, 0x412d936c, 0x40c90e90, 0x406487c4,
+	0x40000000, 0x3f9b783c, 0x3f36f170, 0x3ed26c94,
+	0x3e6deaa1, 0x3e096c8d, 0x3da4f351, 0x3d407fe6,
+	0x3cdc1342, 0x3c77ae5e, 0x3c135231, 0x3baeffb3,
+	0x3b4ab7db, 0x3ae67ba2, 0x3a824bfd, 0x3a1e29e5,
+	0x39ba1651, 0x39561237, 0x38f21e8e, 0x388e3c4d,
+	0x382a6c6a, 0x37c6afdc, 0x37630799, 0x36ff7496,
+	0x369bf7c9, 0x36389228, 0x35d544a7, 0x3572103d,
+	0x350ef5de, 0x34abf67e, 0x34491311, 0x33e64c8c,
+	0x3383a3e2, 0x33211a07, 0x32beafed, 0x325c6688,
+	0x31fa3ecb, 0x319839a6, 0x3136580d, 0x30d49af1,
+	0x30730342, 0x301191f3, 0x2fb047f2, 0x2f4f2630,
+	0x2eee2d9d, 0x2e8d5f29, 0x2e2cbbc1, 0x2dcc4454,
+	0x2d6bf9d1, 0x2d0bdd25, 0x2cabef3d, 0x2c4c3106,
+	0x2beca36c, 0x2b8d475b, 0x2b2e1dbe, 0x2acf277f,
+	0x2a70658a, 0x2a11d8c8, 0x29b38223, 0x29556282,
+	0x28f77acf, 0x2899cbf1, 0x283c56cf, 0x27df1c50,
+	0x27821d59, 0x27255ad1, 0x26c8d59c, 0x266c8e9f,
+	0x261086bc, 0x25b4bed8, 0x255937d5, 0x24fdf294,
+	0x24a2eff6, 0x244830dd, 0x23edb628, 0x239380b6,
+	0x23399167, 0x22dfe917, 0x228688a4, 0x222d70eb,
+	0x21d4a2c8, 0x217c1f15, 0x2123e6ad, 0x20cbfa6a,
+	0x20745b24, 0x201d09b4, 0x1fc606f1, 0x1f6f53b3,
+	0x1f18f0ce, 0x1ec2df18, 0x1e6d1f65, 0x1e17b28a,
+	0x1dc29958, 0x1d6dd4a2, 0x1d196538, 0x1cc54bec,
+	0x1c71898d, 0x1c1e1ee9, 0x1bcb0cce, 0x1b785409,
+	0x1b25f566, 0x1ad3f1b1, 0x1a8249b4, 0x1a30fe38,
+	0x19e01006, 0x198f7fe6, 0x193f4e9e, 0x18ef7cf4,
+	0x18a00bae, 0x1850fb8e, 0x18024d59, 0x17b401d1,
+	0x176619b6, 0x171895c9, 0x16cb76c9, 0x167ebd74,
+	0x16326a88, 0x15e67ec1, 0x159afadb, 0x154fdf8f,
+	0x15052d97, 0x14bae5ab, 0x14710883, 0x142796d5,
+	0x13de9156, 0x1395f8ba, 0x134dcdb4, 0x130610f7,
+	0x12bec333, 0x1277e518, 0x12317756, 0x11eb7a9a,
+	0x11a5ef90, 0x1160d6e5, 0x111c3142, 0x10d7ff51,
+	0x109441bb, 0x1050f926, 0x100e2639, 0x0fcbc999,
+	0x0f89e3e8, 0x0f4875ca, 0x0f077fe1, 0x0ec702cb,
+	0x0e86ff2a, 0x0e47759a, 0x0e0866b8, 0x0dc9d320,
+	0x0d8bbb6d, 0x0d4e2037, 0x0d110216, 0x0cd461a2,
+	0x0c983f70, 0x0c5c9c14, 0x0c217822, 0x0be6d42b,
+	0x0bacb0bf, 0x0b730e70, 0x0b39edca, 0x0b014f5b,
+	0x0ac933ae, 0x0a919b4e, 0x0a5a86c4, 0x0a23f698,
+	0x09edeb50, 0x09b86572, 0x09836582, 0x094eec03,
+	0x091af976, 0x08e78e5b, 0x08b4ab32, 0x08825077,
+	0x08507ea7, 0x081f363d, 0x07ee77b3, 0x07be4381,
+	0x078e9a1d, 0x075f7bfe, 0x0730e997, 0x0702e35c,
+	0x06d569be, 0x06a87d2d, 0x067c1e18, 0x06504ced,
+	0x06250a18, 0x05fa5603, 0x05d03118, 0x05a69bbe,
+	0x057d965d, 0x0555215a, 0x052d3d18, 0x0505e9fb,
+	0x04df2862, 0x04b8f8ad, 0x04935b3c, 0x046e5069,
+	0x0449d892, 0x0425f410, 0x0402a33c, 0x03dfe66c,
+	0x03bdbdf6, 0x039c2a2f, 0x037b2b6a, 0x035ac1f7,
+	0x033aee27, 0x031bb049, 0x02fd08a9, 0x02def794,
+	0x02c17d52, 0x02a49a2e, 0x02884e6e, 0x026c9a58,
+	0x02517e31, 0x0236fa3b, 0x021d0eb8, 0x0203bbe8,
+	0x01eb0209, 0x01d2e158, 0x01bb5a11, 0x01a46c6e,
+	0x018e18a7, 0x01785ef4, 0x01633f8a, 0x014eba9d,
+	0x013ad060, 0x01278104, 0x0114ccb9, 0x0102b3ac,
+	0x00f1360b, 0x00e05401, 0x00d00db6, 0x00c06355,
+	0x00b15502, 0x00a2e2e3, 0x00950d1d, 0x0087d3d0,
+	0x007b371e, 0x006f3726, 0x0063d405, 0x00590dd8,
+	0x004ee4b8, 0x004558c0, 0x003c6a07, 0x003418a2,
+	0x002c64a6, 0x00254e27, 0x001ed535, 0x0018f9e1,
+	0x0013bc39, 0x000f1c4a, 0x000b1a20, 0x0007b5c4,
+	0x0004ef3f, 0x0002c697, 0x00013bd3, 0x00004ef5,
+};
+
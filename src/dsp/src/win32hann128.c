@@ -0,0 +1,38 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32hann128[128] =
+{
+	0x00000000, 0x0013bc39, 0x004ee4b8, 0x00b15502,
+	0x013ad060, 0x01eb0209, 0x02c17d52, 0x03bdbdf6,
+	0x04df2862, 0x06250a18, 0x078e9a1d, 0x091af976,
+	0x0ac933ae, 0x0c983f70, 0x0e86ff2a, 0x109441bb,
+	0x12bec333, 0x15052d97, 0x176619b6, 0x19e01006,
+	0x1c71898d, 0x1f18f0ce, 0x21d4a2c8, 0x24a2eff6,
+	0x27821d59, 0x2a70658a, 0x2d6bf9d1, 0x30730342,
+	0x3383a3e2, 0x369bf7c9, 0x39ba1651, 0x3cdc1342,
+	0x40000000, 0x4323ecbe, 0x4645e9af, 0x49640837,
+	0x4c7c5c1e, 0x4f8cfcbe, 0x5294062f, 0x558f9a76,
+	0x587de2a7, 0x5b5d100a, 0x5e2b5d38, 0x60e70f32,
+	0x638e7673, 0x661feffa, 0x6899e64a, 0x6afad269,
+	0x6d413ccd, 0x6f6bbe45, 0x717900d6, 0x7367c090,
+	0x7536cc52, 0x76e5068a, 0x787165e3, 0x79daf5e8,
+	0x7b20d79e, 0x7c42420a, 0x7d3e82ae, 0x7e14fdf7,
+	0x7ec52fa0, 0x7f4eaafe, 0x7fb11b48, 0x7fec43c7,
+	0x7fffffff, 0x7fec43c7, 0x7fb11b48, 0x7f4eaafe,
+	0x7ec52fa0, 0x7e14fdf7, 0x7d3e82ae, 0x7c42420a,
+	0x7b20d79e, 0x79daf5e8, 0x787165e3, 0x76e5068a,
+	0x7536cc52, 0x7367c090, 0x717900d6, 0x6f6bbe45,
+	0x6d413ccd, 0x6afad269, 0x6899e64a, 0x661feffa,
+	0x638e7673, 0x60e70f32, 0x5e2b5d38, 0x5b5d100a,
+	0x587de2a7, 0x558f9a76, 0x5294062f, 0x4f8cfcbe,
+	0x4c7c5c1e, 0x49640837, 0x4645e9af, 0x4323ecbe,
+	0x40000000, 0x3cdc1342, 0x39ba1651, 0x369bf7c9,
+	0x3383a3e2, 0x30730342, 0x2d6bf9d1, 0x2a70658a,
+	0x27821d59, 0x24a2eff6, 0x21d4a2c8, 0x1f18f0ce,
+	0x1c71898d, 0x19e01006, 0x176619b6, 0x15052d97,
+	0x12bec333, 0x109441bb, 0x0e86ff2a, 0x0c983f70,
+	0x0ac933ae, 0x091af976, 0x078e9a1d, 0x06250a18,
+	0x04df2862, 0x03bdbdf6, 0x02c17d52, 0x01eb0209,
+	0x013ad060, 0x00b15502, 0x004ee4b8, 0x0013bc39,
+};
+
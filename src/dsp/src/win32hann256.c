@@ -0,0 +1,70 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32hann256[256] =
+{
+	0x00000000, 0x0004ef3f, 0x0013bc39, 0x002c64a6,
+	0x004ee4b8, 0x007b371e, 0x00b15502, 0x00f1360b,
+	0x013ad060, 0x018e18a7, 0x01eb0209, 0x02517e31,
+	0x02c17d52, 0x033aee27, 0x03bdbdf6, 0x0449d892,
+	0x04df2862, 0x057d965d, 0x06250a18, 0x06d569be,
+	0x078e9a1d, 0x08507ea7, 0x091af976, 0x09edeb50,
+	0x0ac933ae, 0x0bacb0bf, 0x0c983f70, 0x0d8bbb6d,
+	0x0e86ff2a, 0x0f89e3e8, 0x109441bb, 0x11a5ef90,
+	0x12bec333, 0x13de9156, 0x15052d97, 0x16326a88,
+	0x176619b6, 0x18a00bae, 0x19e01006, 0x1b25f566,
+	0x1c71898d, 0x1dc29958, 0x1f18f0ce, 0x20745b24,
+	0x21d4a2c8, 0x23399167, 0x24a2eff6, 0x261086bc,
+	0x27821d59, 0x28f77acf, 0x2a70658a, 0x2beca36c,
+	0x2d6bf9d1, 0x2eee2d9d, 0x30730342, 0x31fa3ecb,
+	0x3383a3e2, 0x350ef5de, 0x369bf7c9, 0x382a6c6a,
+	0x39ba1651, 0x3b4ab7db, 0x3cdc1342, 0x3e6deaa1,
+	0x40000000, 0x4192155f, 0x4323ecbe, 0x44b54825,
+	0x4645e9af, 0x47d59396, 0x49640837, 0x4af10a22,
+	0x4c7c5c1e, 0x4e05c135, 0x4f8cfcbe, 0x5111d263,
+	0x5294062f, 0x54135c94, 0x558f9a76, 0x57088531,
+	0x587de2a7, 0x59ef7944, 0x5b5d100a, 0x5cc66e99,
+	0x5e2b5d38, 0x5f8ba4dc, 0x60e70f32, 0x623d66a8,
+	0x638e7673, 0x64da0a9a, 0x661feffa, 0x675ff452,
+	0x6899e64a, 0x69cd9578, 0x6afad269, 0x6c216eaa,
+	0x6d413ccd, 0x6e5a1070, 0x6f6bbe45, 0x70761c18,
+	0x717900d6, 0x72744493, 0x7367c090, 0x74534f41,
+	0x7536cc52, 0x761214b0, 0x76e5068a, 0x77af8159,
+	0x787165e3, 0x792a9642, 0x79daf5e8, 0x7a8269a3,
+	0x7b20d79e, 0x7bb6276e, 0x7c42420a, 0x7cc511d9,
+	0x7d3e82ae, 0x7dae81cf, 0x7e14fdf7, 0x7e71e759,
+	0x7ec52fa0, 0x7f0ec9f5, 0x7f4eaafe, 0x7f84c8e2,
+	0x7fb11b48, 0x7fd39b5a, 0x7fec43c7, 0x7ffb10c1,
+	0x7fffffff, 0x7ffb10c1, 0x7fec43c7, 0x7fd39b5a,
+	0x7fb11b48, 0x7f84c8e2, 0x7f4eaafe, 0x7f0ec9f5,
+	0x7ec52fa0, 0x7e71e759, 0x7e14fdf7, 0x7dae81cf,
+	0x7d3e82ae, 0x7cc511d9, 0x7c42420a, 0x7bb6276e,
+	0x7b20d79e, 0x7a8269a3, 0x79daf5e8, 0x792a9642,
+	0x787165e3, 0x77af8159, 0x76e5068a, 0x761214b0,
+	0x7536cc52, 0x74534f41, 0x7367c090, 0x72744493,
+	0x717900d6, 0x70761c18, 0x6f6bbe45, 0x6e5a1070,
+	0x6d413ccd, 0x6c216eaa, 0x6afad269, 0x69cd9578,
+	0x6899e64a, 0x675ff452, 0x661feffa, 0x64da0a9a,
+	0x638e7673, 0x623d66a8, 0x60e70f32, 0x5f8ba4dc,
+	0x5e2b5d38, 0x5cc66e99, 0x5b5d100a, 0x59ef7944,
+	0x587de2a7, 0x57088531, 0x558f9a76, 0x54135c94,
+	0x5294062f, 0x5111d263, 0x4f8cfcbe, 0x4e05c135,
+	0x4c7c5c1e, 0x4af10a22, 0x49640837, 0x47d59396,
+	0x4645e9af, 0x44b54825, 0x4323ecbe, 0x4192155f,
+	0x40000000, 0x3e6deaa1, 0x3cdc1342, 0x3b4ab7db,
+	0x39ba1651, 0x382a6c6a, 0x369bf7c9, 0x350ef5de,
+	0x3383a3e2, 0x31fa3ecb, 0x30730342, 0x2eee2d9d,
+	0x2d6bf9d1, 0x2beca36c, 0x2a70658a, 0x28f77acf,
+	0x27821d59, 0x261086bc, 0x24a2eff6, 0x23399167,
+	0x21d4a2c8, 0x20745b24, 0x1f18f0ce, 0x1dc29958,
+	0x1c71898d, 0x1b25f566, 0x19e01006, 0x18a00bae,
+	0x176619b6, 0x16326a88, 0x15052d97, 0x13de9156,
+	0x12bec333, 0x11a5ef90, 0x109441bb, 0x0f89e3e8,
+	0x0e86ff2a, 0x0d8bbb6d, 0x0c983f70, 0x0bacb0bf,
+	0x0ac933ae, 0x09edeb50, 0x091af976, 0x08507ea7,
+	0x078e9a1d, 0x06d569be, 0x06250a18, 0x057d965d,
+	0x04df2862, 0x0449d892, 0x03bdbdf6, 0x033aee27,
+	0x02c17d52, 0x02517e31, 0x01eb0209, 0x018e18a7,
+	0x013ad060, 0x00f1360b, 0x00b15502, 0x007b371e,
+	0x004ee4b8, 0x002c64a6, 0x0013bc39, 0x0004ef3f,
+};
+
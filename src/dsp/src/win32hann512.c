@@ -0,0 +1,134 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32hann512[512] =
+{
+	0x00000000, 0x00013bd3, 0x0004ef3f, 0x000b1a20,
+	0x0013bc39, 0x001ed535, 0x002c64a6, 0x003c6a07,
+	0x004ee4b8, 0x0063d405, 0x007b371e, 0x00950d1d,
+	0x00b15502, 0x00d00db6, 0x00f1360b, 0x0114ccb9,
+	0x013ad060, 0x01633f8a, 0x018e18a7, 0x01bb5a11,
+	0x01eb0209, 0x021d0eb8, 0x02517e31, 0x02884e6e,
+	0x02c17d52, 0x02fd08a9, 0x033aee27, 0x037b2b6a,
+	0x03bdbdf6, 0x0402a33c, 0x0449d892, 0x04935b3c,
+	0x04df2862, 0x052d3d18, 0x057d965d, 0x05d03118,
+	0x06250a18, 0x067c1e18, 0x06d569be, 0x0730e997,
+	0x078e9a1d, 0x07ee77b3, 0x08507ea7, 0x08b4ab32,
+	0x091af976, 0x09836582, 0x09edeb50, 0x0a5a86c4,
+	0x0ac933ae, 0x0b39edca, 0x0bacb0bf, 0x0c217822,
+	0x0c983f70, 0x0d110216, 0x0d8bbb6d, 0x0e0866b8,
+	0x0e86ff2a, 0x0f077fe1, 0x0f89e3e8, 0x100e2639,
+	0x109441bb, 0x111c3142, 0x11a5ef90, 0x12317756,
+	0x12bec333, 0x134dcdb4, 0x13de9156, 0x14710883,
+	0x15052d97, 0x159afadb, 0x16326a88, 0x16cb76c9,
+	0x176619b6, 0x18024d59, 0x18a00bae, 0x193f4e9e,
+	0x19e01006, 0x1a8249b4, 0x1b25f566, 0x1bcb0cce,
+	0x1c71898d, 0x1d196538, 0x1dc29958, 0x1e6d1f65,
+	0x1f18f0ce, 0x1fc606f1, 0x20745b24, 0x2123e6ad,
+	0x21d4a2c8, 0x228688a4, 0x23399167, 0x23edb628,
+	0x24a2eff6, 0x255937d5, 0x261086bc, 0x26c8d59c,
+	0x27821d59, 0x283c56cf, 0x28f77acf, 0x29b38223,
+	0x2a70658a, 0x2b2e1dbe, 0x2beca36c, 0x2cabef3d,
+	0x2d6bf9d1, 0x2e2cbbc1, 0x2eee2d9d, 0x2fb047f2,
+	0x30730342, 0x3136580d, 0x31fa3ecb, 0x32beafed,
+	0x3383a3e2, 0x34491311, 0x350ef5de, 0x35d544a7,
+	0x369bf7c9, 0x37630799, 0x382a6c6a, 0x38f21e8e,
+	0x39ba1651, 0x3a824bfd, 0x3b4ab7db, 0x3c135231,
+	0x3cdc1342, 0x3da4f351, 0x3e6deaa1, 0x3f36f170,
+	0x40000000, 0x40c90e90, 0x4192155f, 0x425b0caf,
+	0x4323ecbe, 0x43ecadcf, 0x44b54825, 0x457db403,
+	0x4645e9af, 0x470de172, 0x47d59396, 0x489cf867,
+	0x49640837, 0x4a2abb59, 0x4af10a22, 0x4bb6ecef,
+	0x4c7c5c1e, 0x4d415013, 0x4e05c135, 0x4ec9a7f3,
+	0x4f8cfcbe, 0x504fb80e, 0x5111d263, 0x51d3443f,
+	0x5294062f, 0x535410c3, 0x54135c94, 0x54d1e242,
+	0x558f9a76, 0x564c7ddd, 0x57088531, 0x57c3a931,
+	0x587de2a7, 0x59372a64, 0x59ef7944, 0x5aa6c82b,
+	0x5b5d100a, 0x5c1249d8, 0x5cc66e99, 0x5d79775c,
+	0x5e2b5d38, 0x5edc1953, 0x5f8ba4dc, 0x6039f90f,
+	0x60e70f32, 0x6192e09b, 0x623d66a8, 0x62e69ac8,
+	0x638e7673, 0x6434f332, 0x64da0a9a, 0x657db64c,
+	0x661feffa, 0x66c0b162, 0x675ff452, 0x67fdb2a7,
+	0x6899e64a, 0x69348937, 0x69cd9578, 0x6a650525,
+	0x6afad269, 0x6b8ef77d, 0x6c216eaa, 0x6cb2324c,
+	0x6d413ccd, 0x6dce88aa, 0x6e5a1070, 0x6ee3cebe,
+	0x6f6bbe45, 0x6ff1d9c7, 0x70761c18, 0x70f8801f,
+	0x717900d6, 0x71f79948, 0x72744493, 0x72eefdea,
+	0x7367c090, 0x73de87de, 0x74534f41, 0x74c61236,
+	0x7536cc52, 0x75a5793c, 0x761214b0, 0x767c9a7e,
+	0x76e5068a, 0x774b54ce, 0x77af8159, 0x7811884d,
+	0x787165e3, 0x78cf1669, 0x792a9642, 0x7983e1e8,
+	0x79daf5e8, 0x7a2fcee8, 0x7a8269a3, 0x7ad2c2e8,
+	0x7b20d79e, 0x7b6ca4c4, 0x7bb6276e, 0x7bfd5cc4,
+	0x7c42420a, 0x7c84d496, 0x7cc511d9, 0x7d02f757,
+	0x7d3e82ae, 0x7d77b192, 0x7dae81cf, 0x7de2f148,
+	0x7e14fdf7, 0x7e44a5ef, 0x7e71e759, 0x7e9cc076,
+	0x7ec52fa0, 0x7eeb3347, 0x7f0ec9f5, 0x7f2ff24a,
+	0x7f4eaafe, 0x7f6af2e3, 0x7f84c8e2, 0x7f9c2bfb,
+	0x7fb11b48, 0x7fc395f9, 0x7fd39b5a, 0x7fe12acb,
+	0x7fec43c7, 0x7ff4e5e0, 0x7ffb10c1, 0x7ffec42d,
+	0x7fffffff, 0x7ffec42d, 0x7ffb10c1, 0x7ff4e5e0,
+	0x7fec43c7, 0x7fe12acb, 0x7fd39b5a, 0x7fc395f9,
+	0x7fb11b48, 0x7f9c2bfb, 0x7f84c8e2, 0x7f6af2e3,
+	0x7f4eaafe, 0x7f2ff24a, 0x7f0ec9f5, 0x7eeb3347,
+	0x7ec52fa0, 0x7e9cc076, 0x7e71e759, 0x7e44a5ef,
+	0x7e14fdf7, 0x7de2f148, 0x7dae81cf, 0x7d77b192,
+	0x7d3e82ae, 0x7d02f757, 0x7cc511d9, 0x7c84d496,
+	0x7c42420a, 0x7bfd5cc4, 0x7bb6276e, 0x7b6ca4c4,
+	0x7b20d79e, 0x7ad2c2e8, 0x7a8269a3, 0x7a2fcee8,
+	0x79daf5e8, 0x7983e1e8, 0x792a9642, 0x78cf1669,
+	0x787165e3, 0x7811884d, 0x77af8159, 0x774b54ce,
+	0x76e5068a, 0x767c9a7e, 0x761214b0, 0x75a5793c,
+	0x7536cc52, 0x74c61236, 0x74534f41, 0x73de87de,
+	0x7367c090, 0x72eefdea, 0x72744493, 0x71f79948,
+	0x717900d6, 0x70f8801f, 0x70761c18, 0x6ff1d9c7,
+	0x6f6bbe45, 0x6ee3cebe, 0x6e5a1070, 0x6dce88aa,
+	0x6d413ccd, 0x6cb2324c, 0x6c216eaa, 0x6b8ef77d,
+	0x6afad269, 0x6a650525, 0x69cd9578, 0x69348937,
+	0x6899e64a, 0x67fdb2a7, 0x675ff452, 0x66c0b162,
+	0x661feffa, 0x657db64c, 0x64da0a9a, 0x6434f332,
+	0x638e7673, 0x62e69ac8, 0x623d66a8, 0x6192e09b,
+	0x60e70f32, 0x6039f90f, 0x5f8ba4dc, 0x5edc1953,
+	0x5e2b5d38, 0x5d79775c, 0x5cc66e99, 0x5c1249d8,
+	0x5b5d100a, 0x5aa6c82b, 0x59ef7944, 0x59372a64,
+	0x587de2a7, 0x57c3a931, 0x57088531, 0x564c7ddd,
+	0x558f9a76, 0x54d1e242, 0x54135c94, 0x535410c3,
+	0x5294062f, 0x51d3443f, 0x5111d263, 0x504fb80e,
+	0x4f8cfcbe, 0x4ec9a7f3, 0x4e05c135, 0x4d415013,
+	0x4c7c5c1e, 0x4bb6ecef, 0x4af10a22, 0x4a2abb59,
+	0x49640837, 0x489cf867, 0x47d59396, 0x470de172,
+	0x4645e9af, 0x457db403, 0x44b54825, 0x43ecadcf,
+	0x4323ecbe, 0x425b0caf, 0x4192155f, 0x40c90e90,
+	0x40000000, 0x3f36f170, 0x3e6deaa1, 0x3da4f351,
+	0x3cdc1342, 0x3c135231, 0x3b4ab7db, 0x3a824bfd,
+	0x39ba1651, 0x38f21e8e, 0x382a6c6a, 0x37630799,
+	0x369bf7c9, 0x35d544a7, 0x350ef5de, 0x34491311,
+	0x3383a3e2, 0x32beafed, 0x31fa3ecb, 0x3136580d,
+	0x30730342, 0x2fb047f2, 0x2eee2d9d, 0x2e2cbbc1,
+	0x2d6bf9d1, 0x2cabef3d, 0x2beca36c, 0x2b2e1dbe,
+	0x2a70658a, 0x29b38223, 0x28f77acf, 0x283c56cf,
+	0x27821d59, 0x26c8d59c, 0x261086bc, 0x255937d5,
+	0x24a2eff6, 0x23edb628, 0x23399167, 0x228688a4,
+	0x21d4a2c8, 0x2123e6ad, 0x20745b24, 0x1fc606f1,
+	0x1f18f0ce, 0x1e6d1f65, 0x1dc29958, 0x1d196538,
+	0x1c71898d, 0x1bcb0cce, 0x1b25f566, 0x1a8249b4,
+	0x19e01006, 0x193f4e9e, 0x18a00bae, 0x18024d59,
+	0x176619b6, 0x16cb76c9, 0x16326a88, 0x159afadb,
+	0x15052d97, 0x14710883, 0x13de9156, 0x134dcdb4,
+	0x12bec333, 0x12317756, 0x11a5ef90, 0x111c3142,
+	0x109441bb, 0x100e2639, 0x0f89e3e8, 0x0f077fe1,
+	0x0e86ff2a, 0x0e0866b8, 0x0d8bbb6d, 0x0d110216,
+	0x0c983f70, 0x0c217822, 0x0bacb0bf, 0x0b39edca,
+	0x0ac933ae, 0x0a5a86c4, 0x09edeb50, 0x09836582,
+	0x091af976, 0x08b4ab32, 0x08507ea7, 0x07ee77b3,
+	0x078e9a1d, 0x0730e997, 0x06d569be, 0x067c1e18,
+	0x06250a18, 0x05d03118, 0x057d965d, 0x052d3d18,
+	0x04df2862, 0x04935b3c, 0x0449d892, 0x0402a33c,
+	0x03bdbdf6, 0x037b2b6a, 0x033aee27, 0x02fd08a9,
+	0x02c17d52, 0x02884e6e, 0x02517e31, 0x021d0eb8,
+	0x01eb0209, 0x01bb5a11, 0x018e18a7, 0x01633f8a,
+	0x013ad060, 0x0114ccb9, 0x00f1360b, 0x00d00db6,
+	0x00b15502, 0x00950d1d, 0x007b371e, 0x0063d405,
+	0x004ee4b8, 0x003c6a07, 0x002c64a6, 0x001ed535,
+	0x0013bc39, 0x000b1a20, 0x0004ef3f, 0x00013bd3,
+};
+
@@ -0,0 +1,22 @@
+#include "../../../include/dsplib_dsp.h"
+
+const int32 win32hann64[64] =
+{
+	0x00000000, 0x004ee4b8, 0x013ad060, 0x02c17d52,
+	0x04df2862, 0x078e9a1d, 0x0ac933ae, 0x0e86ff2a,
+	0x12bec333, 0x176619b6, 0x1c71898d, 0x21d4a2c8,
+	0x27821d59, 0x2d6bf9d1, 0x3383a3e2, 0x39ba1651,
+	0x40000000, 0x4645e9af, 0x4c7c5c1e, 0x5294062f,
+	0x587de2a7, 0x5e2b5d38, 0x638e7673, 0x6899e64a,
+	0x6d413ccd, 0x717900d6, 0x7536cc52, 0x787165e3,
+	0x7b20d79e, 0x7d3e82ae, 0x7ec52fa0, 0x7fb11b48,
+	0x7fffffff, 0x7fb11b48, 0x7ec52fa0, 0x7d3e82ae,
+	0x7b20d79e, 0x787165e3, 0x7536cc52, 0x717900d6,
+	0x6d413ccd, 0x6899e64a, 0x638e7673, 0x5e2b5d38,
+	0x587de2a7, 0x5294062f, 0x4c7c5c1e, 0x4645e9af,
+	0x40000000, 0x39ba1651, 0x3383a3e2, 0x2d6bf9d1,
+	0x27821d59, 0x21d4a2c8, 0x1c71898d, 0x176619b6,
+	0x12bec333, 0x0e86ff2a, 0x0ac933ae, 0x078e9a1d,
+	0x04df2862, 0x02c17d52, 0x013ad060, 0x004ee4b8,
+};
+
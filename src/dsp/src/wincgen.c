@@ -0,0 +1,106 @@
+/*
+ * Window table generator, see fftc-README.txt for the approach.
+ *
+ * Writes one file per window, word size and length, win16<name><N>.c
+ * and win32<name><N>.c, declared in winc.h. The windows are periodic
+ * (DFT-even), w[n] = sum_k (-1)^k a[k] cos(2*pi*k*n/N), which is the
+ * form wanted in front of an N-point FFT.
+ *
+ *   gcc -o wincgen wincgen.c -lm && ./wincgen
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <assert.h>
+
+
+#define MAX16  0x00007FFF
+#define MAX32  0x7FFFFFFF
+
+
+typedef struct
+{
+  const char *name;
+  int terms;
+  double a[5];
+} window;
+
+
+static const window windows[] =
+{
+  { "hann",    2, { 0.5, 0.5 } },
+  { "hamming", 2, { 0.54, 0.46 } },
+  { "bharris", 4, { 0.35875, 0.48829, 0.14128, 0.01168 } },
+  { "flattop", 5, { 0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368 } },
+};
+
+
+static double Window(const window *w, int i, int n)
+{
+  double v = 0;
+  int k;
+
+  for (k = 0; k < w->terms; k++)
+	v += ((k & 1) ? -1 : 1) * w->a[k] * cos(2.0 * M_PI * k * i / n);
+
+  return v;
+}
+
+
+void CalcWindow(const window *w, int n)
+{
+  char filename[100];
+
+  sprintf(filename, "win16%s%d.c", w->name, n);
+  FILE *fp16 = fopen(filename, "wt");
+  assert(fp16 != NULL);
+
+  sprintf(filename, "win32%s%d.c", w->name, n);
+  FILE *fp32 = fopen(filename, "wt");
+  assert(fp32 != NULL);
+
+  fprintf(fp16, "#include \"../../../include/dsplib_dsp.h\"\n\n");
+  fprintf(fp16, "const int16 win16%s%d[%d] =\n{", w->name, n, n);
+
+  fprintf(fp32, "#include \"../../../include/dsplib_dsp.h\"\n\n");
+  fprintf(fp32, "const int32 win32%s%d[%d] =\n{", w->name, n, n);
+
+  int i;
+  for (i = 0; i < n; i++)
+  {
+	double v = Window(w, i, n);
+
+	double v16 = floor(v * 32768.0 + 0.5);
+	double v32 = floor(v * 2147483648.0 + 0.5);
+
+	int w16 = (v16 > MAX16) ? MAX16 : (int) v16;
+	int w32 = (v32 > MAX32) ? MAX32 : (int) v32;
+
+	fprintf(fp16, (i % 8) ? " 0x%04x," : "\n\t0x%04x,", w16 & 0xFFFF);
+	fprintf(fp32, (i % 4) ? " 0x%08x," : "\n\t0x%08x,", w32);
+  }
+
+  fprintf(fp16, "\n};\n\n");
+  fprintf(fp32, "\n};\n\n");
+
+  fclose(fp16);
+  fclose(fp32);
+}
+
+
+int main()
+{
+  int n, w;
+
+  /* the lengths declared in winc.h */
+
+  for (w = 0; w < (int) (sizeof(windows) / sizeof(windows[0])); w++)
+  {
+	for (n = 64; n <= 1024; n <<= 1)
+	{
+	  CalcWindow(&windows[w], n);
+	}
+  }
+
+  return 0;
+}
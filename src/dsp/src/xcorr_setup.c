@@ -0,0 +1,86 @@
+/*
+ * Setup for mips_xcorr16/32 and mips_autocorr16/32.
+ *
+ * The method is chosen once per (N, maxlag). Each lag costs one dot
+ * product over the (padded) sequence, about 4 cycles per sample on an
+ * M4K for mips_vec_dotp16 and somewhat more for the 32-bit sum in
+ * xcorr.c, which the estimate ignores; the FFT method costs two M-point mips_fft32_r4
+ * calls and a pass over the spectrum, with M = 2^log2M >= N + maxlag so
+ * that the circular correlation does not wrap into the wanted lags.
+ * The cheaper of the two estimates wins.
+ *
+ * mem:     mips_xcorr_plan_mem() int32c entries, the M/2 Q31 twiddles
+ * scratch: *scratch int32c entries as returned by mips_xcorr_plan_mem()
+ */
+
+#include <math.h>
+#include "../../../include/dsplib_dsp.h"
+
+
+static int xcorr_log2M(int N, int maxlag)
+{
+	int log2M = 3;
+	int64 direct, fft;
+
+	while ((1 << log2M) < N + maxlag)
+		log2M++;
+
+	direct = (int64) (2 * maxlag + 1) * (4 * ((N + 3) & ~3) + 40);
+	fft = (int64) (1 << log2M) * (20 * log2M + 60);
+
+	return (direct <= fft) ? 0 : log2M;
+}
+
+
+int mips_xcorr_plan_mem(int N, int maxlag, int *scratch)
+{
+	int log2M;
+
+	if (N < 1 || maxlag < 0)
+		return 0;
+
+	log2M = xcorr_log2M(N, maxlag);
+
+	if (log2M == 0)
+	{
+		if (scratch)
+			*scratch = maxlag + ((N + 3) & ~3);
+		return 0;
+	}
+
+	if (scratch)
+		*scratch = 3 << log2M;
+
+	return 1 << (log2M - 1);
+}
+
+
+int mips_xcorr_plan_setup(xcorr_plan *plan, int32c *mem, int N, int maxlag, int scale)
+{
+	int i, M;
+	double a;
+
+	if (N < 1 || maxlag < 0)
+		return -1;
+
+	plan->N = N;
+	plan->maxlag = maxlag;
+	plan->scale = scale;
+	plan->log2M = xcorr_log2M(N, maxlag);
+	plan->twiddles = 0;
+
+	if (plan->log2M == 0)
+		return 0;
+
+	M = 1 << plan->log2M;
+	plan->twiddles = mem;
+
+	for (i = 0; i < M / 2; i++)
+	{
+		a = -(2 * M_PI * i) / M;
+		mem[i].re = (int32) floor(MAX32 * cos(a) + 0.5);
+		mem[i].im = (int32) floor(MAX32 * sin(a) + 0.5);
+	}
+
+	return 0;
+}
@@ -0,0 +1,151 @@
+/*
+ * The slice-by-4/8 CRCs: check values, a bitwise reference over every
+ * length 0 .. 64 at each alignment, and cycle counts from
+ * mips_cycle_counter_read() for a 4 KB buffer against a plain one
+ * byte per lookup loop, with the flash tables and with copies in RAM.
+ *
+ * Link with the library for the target, with include/ and src/include/
+ * on the include path, and run: the report goes to stdout and main
+ * returns the number of failures.
+ */
+
+#include <stdio.h>
+#include "../../../include/dsplib_crc.h"
+#include "../../include/dsplib_util.h"
+
+#define NBENCH		4096
+
+static uint8 buf[NBENCH + 8];
+static uint32 ram32[8 * 256];
+static uint16 ram16[4 * 256];
+
+static unsigned seed = 1;
+
+
+static uint32 test_crc32_bitwise(uint32 crc, const uint8 *p, int n, uint32 poly)
+{
+	int i, b;
+
+	for (i = 0; i < n; i++)
+	{
+		crc ^= p[i];
+		for (b = 0; b < 8; b++)
+			crc = (crc >> 1) ^ ((crc & 1) ? poly : 0);
+	}
+
+	return crc;
+}
+
+
+static uint16 test_crc16_bitwise(uint16 crc, const uint8 *p, int n)
+{
+	int i, b;
+
+	for (i = 0; i < n; i++)
+	{
+		crc ^= p[i] << 8;
+		for (b = 0; b < 8; b++)
+			crc = (uint16) ((crc << 1) ^ ((crc & 0x8000) ? CRC16_CCITT_POLY : 0));
+	}
+
+	return crc;
+}
+
+
+/* the loop slice-by-N replaces: one lookup and a dependent shift per byte */
+
+static uint32 test_crc32_bytewise(uint32 crc, const uint8 *p, int n, const uint32 *table)
+{
+	while (n--)
+		crc = (crc >> 8) ^ table[(crc ^ *p++) & 0xFF];
+
+	return crc;
+}
+
+
+static int test_value(const char *name, uint32 crc, uint32 ref)
+{
+	printf("%-30s 0x%08X%s\n", name, (unsigned) crc, (crc != ref) ? "  FAIL" : "");
+	return crc != ref;
+}
+
+
+static int test_lengths()
+{
+	int off, n, fail = 0;
+
+	for (off = 0; off < 4; off++)
+		for (n = 0; n <= 64; n++)
+		{
+			fail += mips_crc32_update8(0xFFFFFFFF, buf + off, n, mips_crc32_tab)
+				!= test_crc32_bitwise(0xFFFFFFFF, buf + off, n, CRC32_POLY);
+			fail += mips_crc32_update4(0xFFFFFFFF, buf + off, n, mips_crc32_tab)
+				!= test_crc32_bitwise(0xFFFFFFFF, buf + off, n, CRC32_POLY);
+			fail += mips_crc32_update8(0xFFFFFFFF, buf + off, n, mips_crc32c_tab)
+				!= test_crc32_bitwise(0xFFFFFFFF, buf + off, n, CRC32C_POLY);
+			fail += mips_crc16_update4(0xFFFF, buf + off, n, mips_crc16_tab)
+				!= test_crc16_bitwise(0xFFFF, buf + off, n);
+		}
+
+	printf("%-30s %d mismatches\n", "lengths 0..64, offsets 0..3", fail);
+	return fail != 0;
+}
+
+
+static void test_bench(const char *name, const uint32 *t32, const uint16 *t16, int off)
+{
+	unsigned tb, t4, t8, t16c;
+
+	mips_cycle_counter_reset();
+	test_crc32_bytewise(0xFFFFFFFF, buf + off, NBENCH, t32);
+	tb = mips_cycle_counter_read();
+
+	mips_cycle_counter_reset();
+	mips_crc32_update4(0xFFFFFFFF, buf + off, NBENCH, t32);
+	t4 = mips_cycle_counter_read();
+
+	mips_cycle_counter_reset();
+	mips_crc32_update8(0xFFFFFFFF, buf + off, NBENCH, t32);
+	t8 = mips_cycle_counter_read();
+
+	mips_cycle_counter_reset();
+	mips_crc16_update4(0xFFFF, buf + off, NBENCH, t16);
+	t16c = mips_cycle_counter_read();
+
+	printf("%-10s offset %d: crc32 bytewise %7u  slice-4 %7u  slice-8 %7u  crc16 slice-4 %7u\n",
+		   name, off, tb, t4, t8, t16c);
+}
+
+
+int main()
+{
+	static const char check[] = "123456789";
+	int i, fail = 0;
+
+	for (i = 0; i < NBENCH + 8; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		buf[i] = (uint8) (seed >> 16);
+	}
+
+	fail += test_value("mips_crc32(\"123456789\")", mips_crc32(check, 9), 0xCBF43926);
+	fail += test_value("mips_crc32c(\"123456789\")", mips_crc32c(check, 9), 0xE3069283);
+	fail += test_value("mips_crc16_ccitt(\"123456789\")", mips_crc16_ccitt(check, 9), 0x29B1);
+	fail += test_lengths();
+
+	mips_crc32_table(ram32, CRC32_POLY, 8);
+	mips_crc16_table(ram16, CRC16_CCITT_POLY, 4);
+
+	for (i = 0; i < 8 * 256; i++)
+		fail += ram32[i] != mips_crc32_tab[i];
+	for (i = 0; i < 4 * 256; i++)
+		fail += ram16[i] != mips_crc16_tab[i];
+
+	test_bench("flash", mips_crc32_tab, mips_crc16_tab, 0);
+	test_bench("flash", mips_crc32_tab, mips_crc16_tab, 1);
+	test_bench("RAM", ram32, ram16, 0);
+	test_bench("RAM", ram32, ram16, 1);
+
+	printf("%d failures\n", fail);
+	return fail;
+}
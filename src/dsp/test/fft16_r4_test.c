@@ -0,0 +1,153 @@
+/*
+ * Randomized full-range test of the 16-bit radix-4 and batch FFTs
+ * against mips_fft16, with cycle counts from mips_cycle_counter_read().
+ *
+ * Each kernel transforms uniformly random input over the whole int16
+ * range and the worst case for the butterfly differences, x[0] = MAX16
+ * and x[N/2] = MIN16, for N = 16 .. 1024. An output more than TOL LSB
+ * from the radix-2 result fails. Built with -mdspr2 the DSPr2 kernels
+ * are checked against dspr2_mips_fft16 in the same way.
+ *
+ * Link with the library for the target, with include/ and src/include/
+ * on the include path, and run: the report goes to stdout and main
+ * returns the number of failures.
+ */
+
+#include <stdio.h>
+#include "../../../include/dsplib_dsp.h"
+#include "../../include/fftc.h"
+#include "../../include/dsplib_util.h"
+
+#define LOG2N_MIN	4
+#define LOG2N_MAX	10
+#define NMAX		(1 << LOG2N_MAX)
+#define M		3			/* transforms per batch */
+#define TOL		32			/* LSB */
+
+#ifdef __mips_dspr2
+void dspr2_mips_fft16(int16c *dout, int16c *din, int16c *twiddles, int16c *scratch, int log2N);
+void dspr2_mips_fft16_r4(int16c *dout, int16c *din, int16c *twiddles, int16c *scratch, int log2N);
+#endif
+
+static const int16c *fftc16[] =
+{
+	fft16c16, fft16c32, fft16c64, fft16c128, fft16c256, fft16c512, fft16c1024
+};
+
+static int16c din[M * NMAX];
+static int16c dout[M * NMAX];
+static int16c ref[M * NMAX];
+static int16c scratch[M * NMAX];
+static int16c tw[NMAX];
+
+static unsigned seed = 1;
+
+
+static int16 test_rand16()
+{
+	seed = seed * 1103515245 + 12345;
+	return (int16) (seed >> 16);
+}
+
+
+static int test_maxdiff(int16c *a, int16c *b, int n)
+{
+	int i, d, worst = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		d = a[i].re - b[i].re;
+		d = (d < 0) ? -d : d;
+		worst = (d > worst) ? d : worst;
+		d = a[i].im - b[i].im;
+		d = (d < 0) ? -d : d;
+		worst = (d > worst) ? d : worst;
+	}
+
+	return worst;
+}
+
+
+static int test_report(const char *name, int log2N, const char *input, int diff,
+					   unsigned cycles, unsigned refcycles)
+{
+	printf("%-22s N=%-5d %-6s maxdiff %5d  cycles %8u (ref %8u)%s\n", name, 1 << log2N,
+		   input, diff, cycles, refcycles, (diff > TOL) ? "  FAIL" : "");
+	return diff > TOL;
+}
+
+
+static void test_input(int log2N, int edge)
+{
+	int i, N = 1 << log2N;
+
+	for (i = 0; i < M * N; i++)
+	{
+		din[i].re = edge ? 0 : test_rand16();
+		din[i].im = edge ? 0 : test_rand16();
+	}
+
+	if (edge)
+	{
+		din[0].re = MAX16;
+		din[N / 2].re = MIN16;
+	}
+}
+
+
+int main()
+{
+	const char *input;
+	unsigned t, tref;
+	int log2N, N, edge, i, m, fail = 0;
+
+	for (log2N = LOG2N_MIN; log2N <= LOG2N_MAX; log2N++)
+		for (edge = 0; edge <= 1; edge++)
+		{
+			N = 1 << log2N;
+			input = edge ? "edge" : "random";
+			test_input(log2N, edge);
+
+			for (i = 0; i < N / 2; i++)
+				tw[i] = fftc16[log2N - LOG2N_MIN][i];
+
+			mips_cycle_counter_reset();
+			mips_fft16(ref, din, tw, scratch, log2N);
+			tref = mips_cycle_counter_read();
+			for (m = 1; m < M; m++)
+				mips_fft16(ref + m * N, din + m * N, tw, scratch, log2N);
+
+			mips_cycle_counter_reset();
+			mips_fft16_r4(dout, din, tw, scratch, log2N);
+			t = mips_cycle_counter_read();
+			fail += test_report("mips_fft16_r4", log2N, input, test_maxdiff(dout, ref, N), t, tref);
+
+			mips_cycle_counter_reset();
+			mips_fft16_batch(dout, din, tw, scratch, log2N, M);
+			t = mips_cycle_counter_read();
+			fail += test_report("mips_fft16_batch", log2N, input, test_maxdiff(dout, ref, M * N),
+								t, M * tref);
+
+#ifdef __mips_dspr2
+			/* DSPr2 twiddles: Tr Tr for N/2 entries, then Ti (-Ti) */
+			for (i = 0; i < N / 2; i++)
+			{
+				tw[i].re = tw[i].im = fftc16[log2N - LOG2N_MIN][i].re;
+				tw[N / 2 + i].re = -fftc16[log2N - LOG2N_MIN][i].im;
+				tw[N / 2 + i].im = fftc16[log2N - LOG2N_MIN][i].im;
+			}
+
+			mips_cycle_counter_reset();
+			dspr2_mips_fft16(ref, din, tw, scratch, log2N);
+			tref = mips_cycle_counter_read();
+
+			mips_cycle_counter_reset();
+			dspr2_mips_fft16_r4(dout, din, tw, scratch, log2N);
+			t = mips_cycle_counter_read();
+			fail += test_report("dspr2_mips_fft16_r4", log2N, input, test_maxdiff(dout, ref, N), t, tref);
+#endif
+		}
+
+	printf("%d failures\n", fail);
+	return fail;
+}
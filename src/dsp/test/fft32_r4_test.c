@@ -0,0 +1,201 @@
+/*
+ * Randomized full-range test of the 32-bit radix-4 and batch FFTs
+ * against a double precision FFT, with cycle counts from
+ * mips_cycle_counter_read() against mips_fft32.
+ *
+ * Each kernel transforms uniformly random input over the whole int32
+ * range, and the same input with the worst case for the butterfly
+ * differences, x[0] = MAX32 and x[N/2] = MIN32, for N = 16 .. 1024.
+ * mips_fft32 wraps on such input, so the reference is computed in
+ * double precision, scaled by 1/N and clipped to int32. An output more
+ * than TOL LSB from it fails. Built with -mdspr2, dspr2_mips_fft32_r4
+ * is checked in the same way.
+ *
+ * Link with the library for the target, with include/ and src/include/
+ * on the include path, and run: the report goes to stdout and main
+ * returns the number of failures.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "../../../include/dsplib_dsp.h"
+#include "../../include/fftc.h"
+#include "../../include/dsplib_util.h"
+
+#define LOG2N_MIN	4
+#define LOG2N_MAX	10
+#define NMAX		(1 << LOG2N_MAX)
+#define M		3			/* transforms per batch */
+#define TOL		32			/* LSB */
+
+#ifdef __mips_dspr2
+void dspr2_mips_fft32(int32c *dout, int32c *din, int32c *twiddles, int32c *scratch, int log2N);
+void dspr2_mips_fft32_r4(int32c *dout, int32c *din, int32c *twiddles, int32c *scratch, int log2N);
+#endif
+
+static const int32c *fftc32[] =
+{
+	fft32c16, fft32c32, fft32c64, fft32c128, fft32c256, fft32c512, fft32c1024
+};
+
+static int32c din[M * NMAX];
+static int32c dout[M * NMAX];
+static int32c ref[M * NMAX];
+static int32c scratch[M * NMAX];
+static int32c tw[NMAX / 2];
+static double xre[NMAX], xim[NMAX];
+
+static unsigned seed = 1;
+
+
+static int32 test_rand32()
+{
+	seed = seed * 1103515245 + 12345;
+	return (int32) seed;
+}
+
+
+static int32 test_clip(double x)
+{
+	x = floor(x + 0.5);
+	return (x > MAX32) ? MAX32 : (x < MIN32) ? MIN32 : (int32) x;
+}
+
+
+/* radix-2 FFT of x[0 .. N-1] in double precision, into y as DFT/N */
+
+static void test_fft_ref(int32c *y, const int32c *x, int log2N)
+{
+	double a, tr, ti, wr, wi;
+	int i, j, k, s, N = 1 << log2N;
+
+	for (i = 0; i < N; i++)
+	{
+		for (j = 0, k = 0; k < log2N; k++)
+			j |= ((i >> k) & 1) << (log2N - 1 - k);
+		xre[j] = x[i].re;
+		xim[j] = x[i].im;
+	}
+
+	for (s = 1; s < N; s <<= 1)
+		for (k = 0; k < s; k++)
+		{
+			a = -M_PI * k / s;
+			wr = cos(a);
+			wi = sin(a);
+			for (i = k; i < N; i += 2 * s)
+			{
+				tr = xre[i + s] * wr - xim[i + s] * wi;
+				ti = xre[i + s] * wi + xim[i + s] * wr;
+				xre[i + s] = xre[i] - tr;
+				xim[i + s] = xim[i] - ti;
+				xre[i] += tr;
+				xim[i] += ti;
+			}
+		}
+
+	for (i = 0; i < N; i++)
+	{
+		y[i].re = test_clip(xre[i] / N);
+		y[i].im = test_clip(xim[i] / N);
+	}
+}
+
+
+static int64 test_maxdiff(int32c *a, int32c *b, int n)
+{
+	int64 d, worst = 0;
+	int i;
+
+	for (i = 0; i < n; i++)
+	{
+		d = (int64) a[i].re - b[i].re;
+		d = (d < 0) ? -d : d;
+		worst = (d > worst) ? d : worst;
+		d = (int64) a[i].im - b[i].im;
+		d = (d < 0) ? -d : d;
+		worst = (d > worst) ? d : worst;
+	}
+
+	return worst;
+}
+
+
+static int test_report(const char *name, int log2N, const char *input, int64 diff,
+					   unsigned cycles, unsigned refcycles)
+{
+	printf("%-22s N=%-5d %-6s maxdiff %10lld  cycles %8u (ref %8u)%s\n", name, 1 << log2N,
+		   input, (long long) diff, cycles, refcycles, (diff > TOL) ? "  FAIL" : "");
+	return diff > TOL;
+}
+
+
+static void test_input(int log2N, int edge)
+{
+	int i, m, N = 1 << log2N;
+
+	for (i = 0; i < M * N; i++)
+	{
+		din[i].re = test_rand32();
+		din[i].im = test_rand32();
+	}
+
+	if (edge)
+		for (m = 0; m < M; m++)
+		{
+			din[m * N].re = MAX32;
+			din[m * N + N / 2].re = MIN32;
+		}
+}
+
+
+int main()
+{
+	const char *input;
+	unsigned t, tref;
+	int log2N, N, edge, i, m, fail = 0;
+
+	for (log2N = LOG2N_MIN; log2N <= LOG2N_MAX; log2N++)
+		for (edge = 0; edge <= 1; edge++)
+		{
+			N = 1 << log2N;
+			input = edge ? "edge" : "random";
+			test_input(log2N, edge);
+
+			for (m = 0; m < M; m++)
+				test_fft_ref(ref + m * N, din + m * N, log2N);
+
+			for (i = 0; i < N / 2; i++)
+				tw[i] = fftc32[log2N - LOG2N_MIN][i];
+
+			/* timing only: mips_fft32 wraps on this input */
+			mips_cycle_counter_reset();
+			mips_fft32(dout, din, tw, scratch, log2N);
+			tref = mips_cycle_counter_read();
+
+			mips_cycle_counter_reset();
+			mips_fft32_r4(dout, din, tw, scratch, log2N);
+			t = mips_cycle_counter_read();
+			fail += test_report("mips_fft32_r4", log2N, input, test_maxdiff(dout, ref, N), t, tref);
+
+			mips_cycle_counter_reset();
+			mips_fft32_batch(dout, din, tw, scratch, log2N, M);
+			t = mips_cycle_counter_read();
+			fail += test_report("mips_fft32_batch", log2N, input, test_maxdiff(dout, ref, M * N),
+								t, M * tref);
+
+#ifdef __mips_dspr2
+			mips_cycle_counter_reset();
+			dspr2_mips_fft32(dout, din, tw, scratch, log2N);
+			tref = mips_cycle_counter_read();
+
+			mips_cycle_counter_reset();
+			dspr2_mips_fft32_r4(dout, din, tw, scratch, log2N);
+			t = mips_cycle_counter_read();
+			fail += test_report("dspr2_mips_fft32_r4", log2N, input, test_maxdiff(dout, ref, N), t, tref);
+#endif
+		}
+
+	printf("%d failures\n", fail);
+	return fail;
+}
@@ -0,0 +1,148 @@
+/*
+ * The in-place FFTs against the three-buffer ones: mips_fft16_ip and
+ * mips_fft32_ip are run on random input for N = 16 .. 4096 and compared
+ * with mips_fft16 and mips_fft32, with cycle counts from
+ * mips_cycle_counter_read(). An output more than TOL LSB from the
+ * reference fails.
+ *
+ * The 16-bit input covers the whole int16 range. The 32-bit input is
+ * kept to half scale, because mips_fft32 itself wraps above that and
+ * would make a poor reference.
+ *
+ * Link with the library for the target, with include/ and src/include/
+ * on the include path, and run: the report goes to stdout and main
+ * returns the number of failures.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../../include/dsplib_dsp.h"
+#include "../../include/fftc.h"
+#include "../../include/dsplib_util.h"
+
+#define LOG2N_MIN	4
+#define LOG2N_MAX	12
+#define NMAX		(1 << LOG2N_MAX)
+#define TOL		16			/* LSB */
+
+static const int16c *fftc16[] =
+{
+	fft16c16, fft16c32, fft16c64, fft16c128, fft16c256, fft16c512, fft16c1024,
+	fft16c2048, fft16c4096
+};
+
+static const int32c *fftc32[] =
+{
+	fft32c16, fft32c32, fft32c64, fft32c128, fft32c256, fft32c512, fft32c1024,
+	fft32c2048, fft32c4096
+};
+
+static int32c din[NMAX];
+static int32c dout[NMAX];
+static int32c data[NMAX];
+static int32c scratch[NMAX];
+static int32c tw[NMAX / 2];
+
+static unsigned seed = 1;
+
+
+static int32 test_rand32()
+{
+	seed = seed * 1103515245 + 12345;
+	return (int32) seed;
+}
+
+
+static int test_report(const char *name, int log2N, int32 diff, unsigned cycles,
+					   unsigned refcycles)
+{
+	printf("%-16s N=%-5d maxdiff %5d  cycles %9u (ref %9u)%s\n", name, 1 << log2N,
+		   (int) diff, cycles, refcycles, (diff > TOL) ? "  FAIL" : "");
+	return diff > TOL;
+}
+
+
+static int test_fft16(int log2N)
+{
+	int16c *in16 = (int16c *) din, *out16 = (int16c *) dout, *data16 = (int16c *) data;
+	int16c *tw16 = (int16c *) tw;
+	unsigned t, tref;
+	int i, d, worst = 0, N = 1 << log2N;
+
+	for (i = 0; i < N; i++)
+	{
+		in16[i].re = data16[i].re = (int16) (test_rand32() >> 16);
+		in16[i].im = data16[i].im = (int16) (test_rand32() >> 16);
+	}
+
+	for (i = 0; i < N / 2; i++)
+		tw16[i] = fftc16[log2N - LOG2N_MIN][i];
+
+	mips_cycle_counter_reset();
+	mips_fft16(out16, in16, tw16, (int16c *) scratch, log2N);
+	tref = mips_cycle_counter_read();
+
+	mips_cycle_counter_reset();
+	mips_fft16_ip(data16, tw16, log2N);
+	t = mips_cycle_counter_read();
+
+	for (i = 0; i < N; i++)
+	{
+		d = abs(data16[i].re - out16[i].re);
+		worst = (d > worst) ? d : worst;
+		d = abs(data16[i].im - out16[i].im);
+		worst = (d > worst) ? d : worst;
+	}
+
+	return test_report("mips_fft16_ip", log2N, worst, t, tref);
+}
+
+
+static int test_fft32(int log2N)
+{
+	unsigned t, tref;
+	int32 d, worst = 0;
+	int i, N = 1 << log2N;
+
+	for (i = 0; i < N; i++)
+	{
+		din[i].re = data[i].re = test_rand32() >> 1;
+		din[i].im = data[i].im = test_rand32() >> 1;
+	}
+
+	for (i = 0; i < N / 2; i++)
+		tw[i] = fftc32[log2N - LOG2N_MIN][i];
+
+	mips_cycle_counter_reset();
+	mips_fft32(dout, din, tw, scratch, log2N);
+	tref = mips_cycle_counter_read();
+
+	mips_cycle_counter_reset();
+	mips_fft32_ip(data, tw, log2N);
+	t = mips_cycle_counter_read();
+
+	for (i = 0; i < N; i++)
+	{
+		d = abs(data[i].re - dout[i].re);
+		worst = (d > worst) ? d : worst;
+		d = abs(data[i].im - dout[i].im);
+		worst = (d > worst) ? d : worst;
+	}
+
+	return test_report("mips_fft32_ip", log2N, worst, t, tref);
+}
+
+
+int main()
+{
+	int log2N, fail = 0;
+
+	for (log2N = LOG2N_MIN; log2N <= LOG2N_MAX; log2N++)
+		fail += test_fft16(log2N);
+
+	for (log2N = LOG2N_MIN; log2N <= LOG2N_MAX; log2N++)
+		fail += test_fft32(log2N);
+
+	printf("%d failures\n", fail);
+	return fail;
+}
@@ -0,0 +1,97 @@
+/*
+ * Edge cases of the Q30 quaternion kernels: normalizing q = 0, tiny
+ * quaternions and the largest one (all components MIN32), and rotating
+ * vectors near the |v| < 2 bound, where t = 2 u x v reaches 4. Results
+ * are compared with double precision references; an error above TOL
+ * Q30 LSB fails.
+ *
+ * Link with the library for the target, with include/ on the include
+ * path, and run: the report goes to stdout and main returns the number
+ * of failures.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "../../../include/dsplib_dsp.h"
+
+#define TOL		4			/* Q30 LSB */
+#define Q30		1073741824.0
+
+
+static int test_check(const char *name, const int32 *out, const double *ref, int n)
+{
+	double d, worst = 0;
+	int i;
+
+	for (i = 0; i < n; i++)
+	{
+		d = fabs(out[i] - ref[i] * Q30);
+		worst = (d > worst) ? d : worst;
+	}
+
+	printf("%-40s maxerr %8.2f%s\n", name, worst, (worst > TOL) ? "  FAIL" : "");
+	return worst > TOL;
+}
+
+
+static int test_normalize(const char *name, int32 w, int32 x, int32 y, int32 z)
+{
+	quat32 q = { w, x, y, z }, out;
+	double n = sqrt((double) w * w + (double) x * x + (double) y * y + (double) z * z);
+	double ref[4] = { 0, 0, 0, 0 };
+
+	if (n > 0)
+	{
+		ref[0] = w / n;
+		ref[1] = x / n;
+		ref[2] = y / n;
+		ref[3] = z / n;
+	}
+
+	mips_quat_normalize32(&out, &q, 1);
+	return test_check(name, &out.w, ref, 4);
+}
+
+
+static int test_rotate(const char *name, double angle, double vx, double vy, double vz)
+{
+	/* rotation by angle about (1, 1, 1) / sqrt(3) */
+
+	double c = cos(angle / 2), s = sin(angle / 2) / sqrt(3.0);
+	double ca = cos(angle), sa = sin(angle), k = (vx + vy + vz) / 3;
+	quat32 q = { lrint(c * Q30), lrint(s * Q30), lrint(s * Q30), lrint(s * Q30) };
+	int32 v[3] = { lrint(vx * Q30), lrint(vy * Q30), lrint(vz * Q30) };
+	int32 out[3];
+	double ref[3];
+
+	/* Rodrigues: v cos + (k x v) sin + k (k . v) (1 - cos), k unit */
+
+	ref[0] = vx * ca + (vz - vy) / sqrt(3.0) * sa + k * (1 - ca);
+	ref[1] = vy * ca + (vx - vz) / sqrt(3.0) * sa + k * (1 - ca);
+	ref[2] = vz * ca + (vy - vx) / sqrt(3.0) * sa + k * (1 - ca);
+
+	mips_quat_rotate32(out, &q, v, 1);
+	return test_check(name, out, ref, 3);
+}
+
+
+int main()
+{
+	int fail = 0;
+
+	fail += test_normalize("normalize q = 0", 0, 0, 0, 0);
+	fail += test_normalize("normalize q = (1, 0, 0, 0) LSB", 1, 0, 0, 0);
+	fail += test_normalize("normalize q = (1, 1, 0, 0) LSB", 1, 1, 0, 0);
+	fail += test_normalize("normalize q = (-3, 1, 2, -1) LSB", -3, 1, 2, -1);
+	fail += test_normalize("normalize q = (MIN32, MIN32, MIN32, MIN32)", MIN32, MIN32, MIN32, MIN32);
+	fail += test_normalize("normalize q = (MAX32, MIN32, MAX32, MIN32)", MAX32, MIN32, MAX32, MIN32);
+	fail += test_normalize("normalize q = (0.5, -1.5, 1.25, 1)", 0x20000000, -0x60000000,
+						   0x50000000, 0x40000000);
+
+	fail += test_rotate("rotate 90 deg v = (1.9, 0, 0)", M_PI / 2, 1.9, 0, 0);
+	fail += test_rotate("rotate 180 deg v = (0, 1.4, -1.4)", M_PI, 0, 1.4, -1.4);
+	fail += test_rotate("rotate -60 deg v = (1.1, -1.1, 0.9)", -M_PI / 3, 1.1, -1.1, 0.9);
+
+	printf("%d failures\n", fail);
+	return fail;
+}
@@ -0,0 +1,94 @@
+/*
+ * Full-scale DC through the arbitrary-ratio resamplers: MAX and MIN
+ * inputs, up and down by 48000/44100, must settle to within TOL LSB of
+ * the input once the delay line is full, never wrap to the other sign.
+ *
+ * Link with the library for the target, with include/ on the include
+ * path, and run: the report goes to stdout and main returns the number
+ * of failures.
+ */
+
+#include <stdio.h>
+#include "../../../include/dsplib_dsp.h"
+
+#define K		32
+#define LOG2P		5
+#define N		256
+#define TOL		16			/* LSB, the DC gain error of the rounded taps */
+
+static int16 coeffs16[((1 << LOG2P) + 3) * K];
+static int32 coeffs32[((1 << LOG2P) + 3) * K];
+static int16 delay16[2 * K];
+static int32 delay32[2 * K];
+static int16 in16[N], out16[2 * N];
+static int32 in32[N], out32[2 * N];
+
+
+static int test_report(const char *name, uint32 fs_in, uint32 fs_out, int32 dc, double worst)
+{
+	printf("%-16s %5u -> %5u dc %11ld maxerr %12.0f%s\n", name, (unsigned) fs_in,
+		   (unsigned) fs_out, (long) dc, worst, (worst > TOL) ? "  FAIL" : "");
+	return worst > TOL;
+}
+
+
+static int test_dc16(uint32 fs_in, uint32 fs_out, int16 dc)
+{
+	resample16 st;
+	double d, worst = 0;
+	int i, n;
+
+	mips_resample16_init(&st, coeffs16, delay16, K, LOG2P, fs_in, fs_out);
+	for (i = 0; i < N; i++)
+		in16[i] = dc;
+
+	n = mips_resample16(out16, in16, &st, N);
+	for (i = 2 * K; i < n; i++)
+	{
+		d = (double) out16[i] - dc;
+		d = (d < 0) ? -d : d;
+		worst = (d > worst) ? d : worst;
+	}
+
+	return test_report("mips_resample16", fs_in, fs_out, dc, worst);
+}
+
+
+static int test_dc32(uint32 fs_in, uint32 fs_out, int32 dc)
+{
+	resample32 st;
+	double d, worst = 0;
+	int i, n;
+
+	mips_resample32_init(&st, coeffs32, delay32, K, LOG2P, fs_in, fs_out);
+	for (i = 0; i < N; i++)
+		in32[i] = dc;
+
+	n = mips_resample32(out32, in32, &st, N);
+	for (i = 2 * K; i < n; i++)
+	{
+		d = (double) out32[i] - dc;
+		d = (d < 0) ? -d : d;
+		worst = (d > worst) ? d : worst;
+	}
+
+	return test_report("mips_resample32", fs_in, fs_out, dc, worst);
+}
+
+
+int main()
+{
+	static const uint32 rates[][2] = { { 44100, 48000 }, { 48000, 44100 }, { 48000, 48000 } };
+	int r, fail = 0;
+
+	for (r = 0; r < 3; r++)
+	{
+		fail += test_dc16(rates[r][0], rates[r][1], MAX16);
+		fail += test_dc16(rates[r][0], rates[r][1], MIN16);
+		fail += test_dc32(rates[r][0], rates[r][1], MAX32);
+		fail += test_dc32(rates[r][0], rates[r][1], MIN32);
+	}
+
+	printf("%d failures\n", fail);
+	return fail;
+}
@@ -0,0 +1,66 @@
+#ifndef _WINC_H_
+#define _WINC_H_
+
+#include <dsplib_dsp.h>
+
+/*
+ * Periodic hann, hamming, bharris and flattop windows, generated by
+ * wincgen.c for N = 64, 128, 256, 512 and 1024 only; mips_winc16(hann,
+ * 256) names win16hann256. Other lengths need a table of their own.
+ */
+
+#define mips_winc16(W, N) win16##W##N 
+
+extern const int16 win16hann64[64];
+extern const int16 win16hann128[128];
+extern const int16 win16hann256[256];
+extern const int16 win16hann512[512];
+extern const int16 win16hann1024[1024];
+
+extern const int16 win16hamming64[64];
+extern const int16 win16hamming128[128];
+extern const int16 win16hamming256[256];
+extern const int16 win16hamming512[512];
+extern const int16 win16hamming1024[1024];
+
+extern const int16 win16bharris64[64];
+extern const int16 win16bharris128[128];
+extern const int16 win16bharris256[256];
+extern const int16 win16bharris512[512];
+extern const int16 win16bharris1024[1024];
+
+extern const int16 win16flattop64[64];
+extern const int16 win16flattop128[128];
+extern const int16 win16flattop256[256];
+extern const int16 win16flattop512[512];
+extern const int16 win16flattop1024[1024];
+
+
+#define mips_winc32(W, N) win32##W##N 
+
+extern const int32 win32hann64[64];
+extern const int32 win32hann128[128];
+extern const int32 win32hann256[256];
+extern const int32 win32hann512[512];
+extern const int32 win32hann1024[1024];
+
+extern const int32 win32hamming64[64];
+extern const int32 win32hamming128[128];
+extern const int32 win32hamming256[256];
+extern const int32 win32hamming512[512];
+extern const int32 win32hamming1024[1024];
+
+extern const int32 win32bharris64[64];
+extern const int32 win32bharris128[128];
+extern const int32 win32bharris256[256];
+extern const int32 win32bharris512[512];
+extern const int32 win32bharris1024[1024];
+
+extern const int32 win32flattop64[64];
+extern const int32 win32flattop128[128];
+extern const int32 win32flattop256[256];
+extern const int32 win32flattop512[512];
+extern const int32 win32flattop1024[1024];
+
+
+#endif